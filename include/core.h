@@ -0,0 +1,754 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ * 
+ */
+
+#pragma once
+#include <Arduino.h>
+#include <Clock.h>
+#include <settings.h>
+#include <DynamicArray.h>
+#include "format.h"
+#include "timezone.h"
+#include "hal.h"
+
+/*
+ * The control core: Time, Sensors and Solar managers and their settings.
+ * It reaches the hardware only through the HAL, so the native env builds it
+ * with hal_linux.cpp. data.h adds the display, the network and Blynk.
+ */
+
+/* --- Ports --- */
+#define DS18B20_PORT D4
+#define BUZZER_PORT D8
+#define CLK_PORT D5
+#define DT_PORT D6
+#define SW_PORT D7
+#define RELE_PORT D0
+#define LOOP_PORTS_COUNT 2 // the pins the wiring above leaves free, see loop_ports
+#define LOOP_PORTS_NAMES "RX,D3"
+
+/* --- Defaults --- */
+/* TimeManager */
+#define DEFAULT_NTP_FLAG true
+#define DEFAULT_GMT 0
+#define DEFAULT_TIMEZONE ""
+
+/* SensorsManager */
+#define DEFAULT_READ_DATA_TIME 5 // sec
+#define DEFAULT_DS18B20_NAME "Tn"
+#define DEFAULT_DS18B20_RESOLUTION 12
+#define DEFAULT_FILTER_MEDIAN 3 // readings
+#define DEFAULT_FILTER_RATE 20 // °C/min, collectors cool fast when the pump starts
+#define DEFAULT_FILTER_STUCK_TIME 0 // min, off, a calm boiler may read the same for hours
+#define DEFAULT_FILTER_RANGE_MIN -30
+#define DEFAULT_FILTER_RANGE_MAX 120
+
+/* SolarSystemManager */
+#define DEFAULT_SOLAR_WORK_FLAG true
+#define DEFAULT_SOLAR_ERROR_ON_FLAG true
+#define DEFAULT_SOLAR_RELE_INVERT_FLAG true
+#define DEFAULT_SOLAR_DELTA 5
+#define DEFAULT_SOLAR_MODE SOLAR_MODE_BANG_BANG
+#define DEFAULT_SOLAR_HYSTERESIS 2
+#define DEFAULT_SOLAR_MIN_ON_TIME 30 // sec
+#define DEFAULT_SOLAR_MIN_OFF_TIME 60 // sec
+#define DEFAULT_SOLAR_PID_KP 20.0 // % per °C
+#define DEFAULT_SOLAR_PID_KI 3.0 // % per °C*min
+#define DEFAULT_SOLAR_PID_KD 0.0 // % per °C/min
+#define DEFAULT_SOLAR_PID_WINDOW 300 // sec
+#define DEFAULT_SOLAR_PREDICT_FLAG false
+#define DEFAULT_SOLAR_PREDICT_TIME 2 // min
+#define DEFAULT_SOLAR_FLOW 20 // dl/min
+#define DEFAULT_SOLAR_FLUID_CP 3800 // J/(kg*K), water-glycol
+
+
+/* --- Macroces --- */
+/* TimeManager */
+#define NTP_POLL_MIN_TIME 1 // min
+#define NTP_POLL_MAX_TIME 240 // min
+#define NTP_POLL_OFFSET 250 // mls, below it the poll interval grows
+#define NTP_STEP_OFFSET 1000 // mls, larger offsets are stepped, smaller are slewed
+#define NTP_SLEW_TIME 2000 // mls of running time per 1 mls of slew (500 ppm)
+#define NTP_DRIFT_MIN_TIME 10 // min between samples used for drift
+#define NTP_DRIFT_MAX 500000 // ppb
+#define TIME_MIN_UNIX 1577836800 // 01.01.2020, older time is not set yet
+
+/* SensorsManager */
+#define MODULE_MANAGER_BLYNK_SUPPORT
+#define UNSPECIFIED_STATUS 255
+#define DS_SENSORS_MAX_COUNT 10
+#define DS_NAME_SIZE 3
+#define DS18B20_POWER_ON_RAW 10880 // 85 °C
+#define DS_HISTORY_SIZE 12 // samples, one per read
+#define DS_TREND_MIN_COUNT 4
+#define DS_MEDIAN_MAX 5 // readings, odd
+#define DS_FILTER_RATE_MAX 100 // °C/min
+#define DS_FILTER_STUCK_TIME_MAX 240 // min
+#define DS_REJECT_MAX_COUNT 3 // a step that stays this long is real
+#define DS_HEALTH_OK 0
+#define DS_HEALTH_SUSPECT 1 // reading rejected, the last good value is kept
+#define DS_HEALTH_FAULT 2
+
+/* SolarSystemManager */
+#define SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
+#define SOLAR_DELTA_MIN 3
+#define SOLAR_DELTA_MAX 10
+#define SOLAR_MODE_BANG_BANG 0
+#define SOLAR_MODE_HYSTERESIS 1
+#define SOLAR_MODE_PID 2
+#define SOLAR_BANG_BANG_HYSTERESIS 2
+#define SOLAR_HYSTERESIS_MIN 1
+#define SOLAR_HYSTERESIS_MAX 5
+#define SOLAR_DWELL_TIME_MAX 1800 // sec
+#define SOLAR_PID_GAIN_MAX 100
+#define SOLAR_PID_TIME 1000 // mls between PID updates
+#define SOLAR_PID_WINDOW_MIN 10 // sec
+#define SOLAR_PID_WINDOW_MAX 900 // sec
+#define SOLAR_PREDICT_TIME_MAX 10 // min
+#define SOLAR_PREDICT_LEAD_MAX 2 // °C, how much earlier the pump may start
+#define SOLAR_PREDICT_SETTLE_TIME 120 // sec after a switch, the trend then shows the switch itself
+#define SOLAR_LOOPS_MAX (LOOP_PORTS_COUNT + 1) // the main loop and one per free port
+#define SOLAR_MAIN_LOOP 0 // battery -> boiler on RELE_PORT, always present
+#define SOLAR_LOOP_SETTINGS_SIZE 7
+#define SOLAR_FLOW_MAX 250 // dl/min
+#define SOLAR_FLUID_CP_MIN 1000 // J/(kg*K)
+#define SOLAR_FLUID_CP_MAX 4200 // J/(kg*K)
+
+/* EnergyMeter */
+#define ENERGY_FILE "/energy.bin"
+#define ENERGY_SAVE_TIME 900 // sec
+#define ENERGY_STEP_MAX 60 // sec, a longer gap between reads is not integrated
+#define ENERGY_UNITS_PER_WH 216000000000ULL // dl/min * J/(kg*K) * centi °C * mls in 1 Wh, 1 l taken as 1 kg
+
+/* ReleJournal */
+#define RELE_JOURNAL_SIZE 16 // events in RAM, flushed to the file as one block
+#define RELE_JOURNAL_FILE_0 "/rele0.csv"
+#define RELE_JOURNAL_FILE_1 "/rele1.csv"
+#define RELE_JOURNAL_FILE_MAX 16384 // bytes, then the other file is started
+#define RELE_JOURNAL_LINE_SIZE 48
+#define RELE_JOURNAL_FLUSH_TIME 900 // sec
+#define RELE_COUNTERS_FILE "/rele.counters" // and the index of the journal file being written
+#define RELE_REASON_DELTA_ON 0
+#define RELE_REASON_DELTA_OFF 1
+#define RELE_REASON_ERROR_ON 2
+#define RELE_REASON_WEB 3
+#define RELE_REASON_BLYNK 4
+#define RELE_REASON_LCD 5
+#define RELE_REASON_SYSTEM 6 // start, work flag, loop deleted
+
+/* SafetyWatchdog */
+#define WATCHDOG_CHECK_TIME 500 // mls
+#define WATCHDOG_DEADLINE 10 // sec without a solar decision, then the relays go to the fail-safe state
+#define WATCHDOG_FILE "/watchdog.bin"
+#define WATCHDOG_RTC_OFFSET 128 // bytes, the first 128 hold the OTA command for eboot
+#define WATCHDOG_RTC_MAGIC 0x57444F47
+
+/* --- Macro functions --- */
+#define SEC_TO_MLS(TIME) ((TIME) * 1000)
+#define MIN_TO_MLS(TIME) ((TIME) * 60000)
+#define HOUR_TO_SEC(TIME) ((TIME) * 3600L)
+#define IS_EVEN_SECOND(MLS) ((MLS / 1000) % 2)
+
+// the same as DallasTemperature.h, which the core does not include
+typedef uint8_t DeviceAddress[HAL_DS_ADDRESS_SIZE];
+
+// RX is free since Serial is TX only. D3 (GPIO0) is a boot strap pin, its relay input must not pull it low
+const uint8_t loop_ports[LOOP_PORTS_COUNT] = {RX, D3};
+
+struct ds18b20_data_t {
+	void operator=(const ds18b20_data_t& other) {
+		strcpy(name, other.name);
+		memcpy(address, other.address, sizeof(DeviceAddress));
+		resolution = other.resolution;
+		correction = other.correction;
+
+		t = other.t;
+		t_centi = other.t_centi;
+		status = other.status;
+
+		memcpy(history, other.history, sizeof(history));
+		history_head = other.history_head;
+		history_count = other.history_count;
+
+		memcpy(window, other.window, sizeof(window));
+		window_head = other.window_head;
+		window_count = other.window_count;
+		reject_count = other.reject_count;
+		stuck_raw = other.stuck_raw;
+		stuck_timer = other.stuck_timer;
+		health = other.health;
+	}
+	
+	char name[DS_NAME_SIZE];
+	DeviceAddress address;
+	uint8_t resolution;
+	float correction;
+	
+	float t;
+	int16_t t_centi;
+	uint8_t status;
+
+	// last good readings for the trend, not saved
+	int16_t history[DS_HISTORY_SIZE];
+	uint8_t history_head;
+	uint8_t history_count;
+
+	// filter, not saved
+	int16_t window[DS_MEDIAN_MAX];
+	uint8_t window_head;
+	uint8_t window_count;
+	uint8_t reject_count;
+	int16_t stuck_raw;
+	uint32_t stuck_timer;
+	uint8_t health;
+};
+
+struct rele_event_t {
+	uint32_t unix; // 0 while the time is not set
+	int16_t source_centi;
+	int16_t sink_centi;
+	uint8_t loop;
+	uint8_t reason;
+	bool rele_flag;
+};
+
+struct rele_counter_t {
+	uint32_t starts;
+	uint32_t run_time; // sec
+};
+
+// RELE_COUNTERS_FILE, written with one call: LittleFS commits a file on close, a reset keeps the old one
+struct rele_counters_file_t {
+	rele_counter_t counters[SOLAR_LOOPS_MAX];
+	uint8_t file_index; // the journal file being written, the sizes can not tell it
+};
+
+struct energy_totals_t {
+	uint32_t day_energy; // Wh
+	uint32_t month_energy; // Wh
+	uint32_t lifetime_energy; // Wh
+	uint8_t day;
+	uint8_t month;
+};
+
+struct watchdog_counters_t {
+	uint32_t stall_count;
+	uint32_t reset_count; // by the hardware or software WDT and by exceptions
+	uint32_t stall_time_max; // sec
+};
+
+// stalls not yet in the file, RTC memory outlives the reset a stall may end with
+struct watchdog_rtc_t {
+	uint32_t magic;
+	uint32_t stall_count;
+	uint32_t stall_time_max; // sec
+};
+
+struct solar_pid_t {
+	float integral;
+	float last_error;
+	uint32_t update_timer;
+
+	uint32_t window_timer;
+	uint32_t on_time;
+};
+
+struct solar_loop_t {
+	void operator=(const solar_loop_t& other) {
+		source = other.source;
+		sink = other.sink;
+		delta = other.delta;
+		hysteresis = other.hysteresis;
+		mode = other.mode;
+		pin = other.pin;
+		invert_flag = other.invert_flag;
+		flow = other.flow;
+
+		rele_flag = other.rele_flag;
+		rele_switch_timer = other.rele_switch_timer;
+		output = other.output;
+		pid = other.pid;
+	}
+
+	int8_t source; // ds18b20 index, the hot side
+	int8_t sink;
+	uint8_t delta;
+	uint8_t hysteresis;
+	uint8_t mode;
+	uint8_t pin;
+	bool invert_flag;
+	uint8_t flow; // dl/min, for the energy
+
+	// runtime, not saved
+	bool rele_flag;
+	uint32_t rele_switch_timer;
+	uint8_t output; // %
+	solar_pid_t pid;
+};
+
+// the Blynk side of the core managers is in BlynkElements.cpp, it is built with the network part
+class SystemManager;
+class BlynkParam;
+struct blynk_link_t;
+typedef void (*blynk_handler_t)(SystemManager* system, const BlynkParam& param);
+
+class CoreManager;
+
+class TimeManager {
+public:
+	TimeManager();
+	void begin();
+
+	void tick();
+	void makeDefault();
+	void writeSettings(char* buffer);
+	void readSettings(char* buffer);
+#ifdef TIME_MANAGER_BLYNK_SUPPORT
+	void addBlynkElementCodes(DynamicArray<String>* array);
+	bool blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t blynkElementHandler(const char* code);
+#endif
+
+	uint8_t status();
+	uint8_t hour();
+	uint8_t minute();
+	uint8_t second();
+	uint8_t weekday();
+	uint8_t day();
+	uint8_t month();
+	uint16_t year();
+
+	void setSystemManager(CoreManager* system);
+
+	void setNtpFlag(bool ntp_flag);
+	void setGmt(int8_t gmt);
+	bool setTimezone(const char* rule);
+	void setTime(TimeT* time);
+	void setTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint16_t year);
+	void setUnix(uint32_t unix);
+	void setUnixMillis(uint64_t unix_ms);
+	void adjustUnixMillis(int64_t offset);
+
+	CoreManager* getSystemManager();
+	uint8_t getStatus();
+
+	bool getNtpFlag();
+	int8_t getGmt();
+	char* getTimezone();
+	local_time_t* getLocalTime();
+	TimeT getTime();
+	uint32_t getUnix();
+	uint64_t getUnixMillis();
+	uint8_t getNtpPollTime();
+	int32_t getDrift();
+
+private:
+	void updateModel();
+	void syncModel();
+	void updateLocalTime();
+
+	CoreManager* system;
+	Clock clk;
+
+	bool ntp_flag;
+	int8_t gmt;
+
+	// an empty rule means the plain gmt offset
+	char timezone_rule[TIMEZONE_SIZE];
+	timezone_t timezone;
+	local_time_t local_time;
+
+	uint32_t ntp_sync_timer;
+	uint8_t ntp_poll_time;
+	int32_t ntp_offset; // mls, of the last adjustUnixMillis()
+
+	// disciplined time in mls, Clock only mirrors its seconds
+	uint64_t model_ms;
+	uint32_t model_millis;
+	uint32_t model_unix;
+	int32_t drift_ppb;
+	int64_t drift_acc;
+	int32_t slew_ms;
+	uint32_t slew_acc;
+
+	bool drift_sample_flag;
+	uint32_t drift_sample_millis;
+	int32_t drift_sample_ms; // mls the clock drifted over the samples too short for the drift
+};
+
+class SensorsManager {
+public:
+	SensorsManager();
+	void begin();
+
+	void tick();
+	void makeDefault();
+	void writeSettings(char* buffer);
+	void readSettings(char* buffer);
+#ifdef MODULE_MANAGER_BLYNK_SUPPORT
+	void addBlynkElementCodes(DynamicArray<String>* array);
+	bool blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t blynkElementHandler(const char* code);
+#endif
+
+	void updateSensorsData();
+	bool addDS18B20();
+	bool deleteDS18B20(uint8_t index);
+
+	uint8_t makeDS18B20AddressList(DynamicArray<DeviceAddress>* array, DynamicArray<float>* t_array = NULL, DynamicArray<String>* string_array = NULL);
+	int8_t scanDS18B20AddressIndex(DynamicArray<DeviceAddress>* array, uint8_t* address);
+	
+	void setSystemManager(CoreManager* system);
+	void setReadDataTime(uint8_t time);
+	void setFilterMedian(uint8_t median);
+	void setFilterRate(uint8_t rate);
+	void setFilterStuckTime(uint8_t time);
+	void setFilterRange(int8_t range_min, int8_t range_max);
+
+	void setDS18B20(uint8_t index, ds18b20_data_t* ds18b20);
+	void setDS18B20Name(uint8_t index, String name);
+	void setDS18B20Address(uint8_t index, uint8_t* address);
+	void setDS18B20Resolution(uint8_t index, uint8_t resolution);
+	void setDS18B20Correction(uint8_t index, float correction);
+
+	uint8_t getReadDataTime();
+	uint16_t getReadCount();
+	uint8_t getFilterMedian();
+	uint8_t getFilterRate();
+	uint8_t getFilterStuckTime();
+	int8_t getFilterRangeMin();
+	int8_t getFilterRangeMax();
+
+	float getAM2320T();
+	float getAM2320H();
+	int16_t getAM2320TCenti();
+	int16_t getAM2320HCenti();
+	uint8_t getAM2320Status();
+
+	uint8_t getGlobalDS18B20Count();
+	float getDS18B20TByAddress(uint8_t* address);
+	uint8_t getDS18B20Count();
+	ds18b20_data_t* getDS18B20(uint8_t index);
+	char* getDS18B20Name(uint8_t index);
+	uint8_t* getDS18B20Address(uint8_t index);
+	uint8_t getDS18B20Resolution(uint8_t index, bool sync_flag = true);
+	float getDS18B20Correction(uint8_t index);
+	float getDS18B20T(uint8_t index);
+	int16_t getDS18B20TCenti(uint8_t index);
+	uint8_t getDS18B20Status(uint8_t index);
+	uint8_t getDS18B20Health(uint8_t index);
+	bool getDS18B20Trend(uint8_t index, float* trend);
+
+private:
+	bool isCorrectDS18B20Index(uint8_t index);
+	void addDS18B20History(uint8_t index);
+	void filterDS18B20(uint8_t index, int16_t raw);
+	void resetDS18B20Filter(uint8_t index);
+	void resetDS18B20Window(uint8_t index);
+	int16_t makeDS18B20Median(uint8_t index);
+	void DS18B20AddressToString(uint8_t* address, String* string);
+	float DS18B20RawToC(int16_t raw);
+
+	CoreManager* system;
+
+	uint8_t read_data_time;
+	uint16_t read_count;
+	uint8_t filter_median;
+	uint8_t filter_rate;
+	uint8_t filter_stuck_time;
+	int8_t filter_range_min;
+	int8_t filter_range_max;
+
+	struct am2320_data_t {
+		float t;
+		float h;
+		int16_t t_centi;
+		int16_t h_centi;
+		uint8_t status;
+
+	} am2320_data;
+	DynamicArray<ds18b20_data_t> ds18b20_data;
+
+	uint32_t read_data_timer;
+};
+
+class SolarSystemManager;
+
+// controllers keep their state in the loop, so one of each serves all loops
+class SolarController {
+public:
+	virtual void reset(solar_loop_t* loop);
+	// true turns the pump on
+	virtual bool tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now) = 0;
+};
+
+class BangBangController : public SolarController {
+public:
+	bool tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now);
+};
+
+class HysteresisController : public SolarController {
+public:
+	bool tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now);
+};
+
+// the relay is time-proportioned: on for output % of every window
+class PidController : public SolarController {
+public:
+	void reset(solar_loop_t* loop);
+	bool tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now);
+};
+
+class ReleJournal {
+public:
+	ReleJournal();
+	void begin();
+
+	void tick();
+	void push(rele_event_t* event);
+	void flush();
+	void deleteLoop(uint8_t index);
+	void clearCounters();
+
+	uint8_t getCount();
+	uint32_t getStarts(uint8_t loop);
+	uint32_t getRunTime(uint8_t loop);
+
+private:
+	void addRunTime(uint8_t loop);
+	const char* getFile();
+
+	rele_event_t events[RELE_JOURNAL_SIZE];
+	uint8_t head;
+	uint8_t count;
+	uint8_t file_index;
+
+	rele_counter_t counters[SOLAR_LOOPS_MAX];
+	uint32_t run_timers[SOLAR_LOOPS_MAX]; // 0 while the pump is off
+	bool counters_flag;
+	uint32_t flush_timer;
+};
+
+class SafetyWatchdog {
+public:
+	SafetyWatchdog();
+	void begin();
+
+	void tick();
+	void feed(const uint8_t* pins, const bool* safe_levels, uint8_t count);
+	void clear();
+
+	bool getStallFlag();
+	uint32_t getStallCount();
+	uint32_t getResetCount();
+	uint32_t getStallTimeMax();
+
+private:
+	static void check(void* arg);
+	void save();
+
+	// shared with check(), the ticker never interrupts loop() code
+	volatile uint32_t feed_timer; // 0 until the first feed
+	volatile bool stall_flag;
+	volatile uint8_t outputs_count;
+	uint8_t pins[SOLAR_LOOPS_MAX];
+	bool safe_levels[SOLAR_LOOPS_MAX];
+	watchdog_rtc_t rtc;
+
+	watchdog_counters_t counters;
+};
+
+class EnergyMeter {
+public:
+	EnergyMeter();
+	void begin();
+
+	void tick(uint32_t unix, uint8_t day, uint8_t month);
+	void add(uint8_t loop, uint8_t flow, uint16_t cp, int16_t delta_centi, uint32_t time);
+	void clear();
+
+	uint32_t getPower();
+	uint32_t getDayEnergy();
+	uint32_t getMonthEnergy();
+	uint32_t getLifetimeEnergy();
+
+private:
+	void save();
+
+	energy_totals_t totals;
+	uint64_t units; // below 1 Wh, carried to the next read
+	uint32_t power[SOLAR_LOOPS_MAX]; // W, of the last read
+	bool save_flag;
+	uint32_t save_timer;
+};
+
+class SolarSystemManager {
+public:
+	SolarSystemManager();
+	void begin();
+
+	void tick();
+	void makeDefault();
+	void writeSettings(char* buffer);
+	void readSettings(char* buffer);
+#ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
+	void addBlynkElementCodes(DynamicArray<String>* array);
+	bool blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t blynkElementHandler(const char* code);
+#endif
+
+	void setSystemManager(CoreManager* system);
+
+	void setReleFlag(bool rele_flag, uint8_t reason);
+	void setWorkFlag(bool work_flag);
+	void setErrorOnFlag(bool error_on_flag);
+	void setReleInvertFlag(bool rele_invert_flag);
+	void setDelta(uint8_t delta);
+	void setMode(uint8_t mode);
+	void setHysteresis(uint8_t hysteresis);
+	void setMinOnTime(uint16_t time);
+	void setMinOffTime(uint16_t time);
+	void setPidKp(float kp);
+	void setPidKi(float ki);
+	void setPidKd(float kd);
+	void setPidWindow(uint16_t window);
+	void setPredictFlag(bool predict_flag);
+	void setPredictTime(uint8_t time);
+	void setFluidCp(uint16_t cp);
+
+	bool addLoop();
+	bool deleteLoop(uint8_t index);
+	void setLoopReleFlag(uint8_t index, bool rele_flag, uint8_t reason);
+	void setLoopSource(uint8_t index, int8_t ds18b20_index);
+	void setLoopSink(uint8_t index, int8_t ds18b20_index);
+	void setLoopDelta(uint8_t index, uint8_t delta);
+	void setLoopHysteresis(uint8_t index, uint8_t hysteresis);
+	void setLoopMode(uint8_t index, uint8_t mode);
+	void setLoopPin(uint8_t index, uint8_t pin);
+	void setLoopInvertFlag(uint8_t index, bool invert_flag);
+	void setLoopFlow(uint8_t index, uint8_t flow);
+	int8_t scanLoopPortIndex(uint8_t pin);
+
+	void setSensor(uint8_t solar_sensor, int8_t ds18b20_index);
+	void setBatterySensor(int8_t ds18b20_index);
+	void setBoilerSensor(int8_t ds18b20_index);
+	void setExitSensor(int8_t ds18b20_index);
+
+	CoreManager* getSystemManager();
+	ReleJournal* getJournal();
+	SafetyWatchdog* getWatchdog();
+	EnergyMeter* getEnergyMeter();
+	uint8_t getStatus();
+
+	bool getReleFlag();
+	bool getWorkFlag();
+	bool getErrorOnFlag();
+	bool getReleInvertFlag();
+	uint8_t getDelta();
+	uint8_t getMode();
+	uint8_t getHysteresis();
+	uint16_t getMinOnTime();
+	uint16_t getMinOffTime();
+	float getPidKp();
+	float getPidKi();
+	float getPidKd();
+	uint16_t getPidWindow();
+	bool getPredictFlag();
+	uint8_t getPredictTime();
+	uint16_t getFluidCp();
+	uint8_t getOutput();
+
+	uint8_t getLoopsCount();
+	solar_loop_t* getLoop(uint8_t index);
+	uint8_t getLoopStatus(uint8_t index);
+	float getLoopTrend(uint8_t index);
+	
+	uint8_t getBatterySensorStatus();
+	uint8_t getBoilerSensorStatus();
+	uint8_t getExitSensorStatus();
+
+	int8_t getSensor(uint8_t solar_sensor);
+	int8_t getBatterySensor();
+	int8_t getBoilerSensor();
+	int8_t getExitSensor();
+
+	float getBatteryT();
+	float getBoilerT();
+	float getExitT();
+	int16_t getBatteryTCenti();
+	int16_t getBoilerTCenti();
+	int16_t getExitTCenti();
+
+private:
+	void releTick();
+	void loopTick(uint8_t index);
+	void watchdogFeed();
+	void energyTick();
+	bool isCorrectLoopIndex(uint8_t index);
+	bool isFreeLoopPin(uint8_t pin, uint8_t index);
+	int8_t makeSensorIndex(int8_t ds18b20_index);
+	uint8_t makeSensorStatus(int8_t ds18b20_index);
+	SolarController* getController(uint8_t mode);
+	float makePredictedDelta(uint8_t index, float delta_now);
+
+	CoreManager* system;
+	BangBangController bang_bang;
+	HysteresisController hysteresis_controller;
+	PidController pid;
+	ReleJournal journal;
+	SafetyWatchdog watchdog;
+	EnergyMeter energy;
+
+	bool work_flag;
+	bool error_on_flag;
+	uint16_t min_on_time;
+	uint16_t min_off_time;
+	float pid_kp;
+	float pid_ki;
+	float pid_kd;
+	uint16_t pid_window;
+	bool predict_flag;
+	uint8_t predict_time;
+	uint16_t fluid_cp;
+
+	int8_t exit_sensor_index;
+	DynamicArray<solar_loop_t> loops;
+
+	uint16_t energy_read_count;
+	uint32_t energy_timer;
+};
+
+// the control part of SystemManager, the native env runs it alone
+class CoreManager {
+public:
+	CoreManager();
+	void begin();
+
+	void tick();
+	void writeSettings(char* buffer);
+	void readSettings(char* buffer);
+
+	// the core has no network, SystemManager passes these on to it
+	virtual bool ntpSync(TimeManager* time);
+	virtual bool deleteBlynkLink(String element_code);
+	virtual bool modifyBlynkLinkElementCode(String previous_code, String new_code);
+
+	void saveSettingsRequest();
+
+	TimeManager* getTimeManager();
+	SensorsManager* getSensorsManager();
+	SolarSystemManager* getSolarSystemManager();
+
+protected:
+	TimeManager time;
+	SensorsManager sensors;
+	SolarSystemManager solar;
+
+	bool save_settings_request;
+};
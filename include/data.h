@@ -17,50 +17,24 @@
  */
 
 #pragma once
-#include <Arduino.h>
-#include <DallasTemperature.h>
-#include <AM2320.h>
-#include <Clock.h>
-#include <settings.h>
-#include <DynamicArray.h>
+#include "core.h"
 #include <LittleFS.h>
 #include <GyverEncoder.h>
 #include <LiquidCrystal_I2C.h> 
 #include <ESP8266WiFi.h>
 #include <WiFiUdp.h>
 #include <GyverPortal.h>
+#include <lwip/dns.h>
 
 #define NO_GLOBAL_BLYNK
 #define BLYNK_PRINT Serial
+#define BLYNK_NO_DEFAULT_BANNER // config() runs before every connect attempt
 #include <BlynkSimpleEsp8266.h>
 
-/* --- Ports --- */
-#define DS18B20_PORT D4
-#define BUZZER_PORT D8
-#define CLK_PORT D5
-#define DT_PORT D6
-#define SW_PORT D7
-#define RELE_PORT D0
-
 /* --- Defaults --- */
 /* SystemManager */
 #define DEFAULT_BUZZER_FLAG true
 
-/* TimeManager */
-#define DEFAULT_NTP_FLAG true
-#define DEFAULT_GMT 0
-
-/* SensorsManager */
-#define DEFAULT_READ_DATA_TIME 5 // sec
-#define DEFAULT_DS18B20_NAME "Tn"
-#define DEFAULT_DS18B20_RESOLUTION 12
-
-/* SolarSystemManager */
-#define DEFAULT_SOLAR_WORK_FLAG true
-#define DEFAULT_SOLAR_ERROR_ON_FLAG true
-#define DEFAULT_SOLAR_RELE_INVERT_FLAG true
-#define DEFAULT_SOLAR_DELTA 5
-
 /* DisplayManager */
 #define DEFAULT_DISPLAY_WORK_FLAG true
 #define DEFAULT_DISPLAY_AUTO_RESET_FLAG true
@@ -71,29 +45,49 @@
 #define DEFAULT_NETWORK_MODE NETWORK_AUTO
 #define DEFAULT_NETWORK_SSID_AP "nztr_solar"
 #define DEFAULT_NETWORK_PASS_AP "nazotronic"
+#define DEFAULT_NETWORK_IP_MODE NETWORK_IP_DHCP
+
+/* NtpClient */
+#define DEFAULT_NTP_SERVER_0 "pool.ntp.org"
+#define DEFAULT_NTP_SERVER_1 "time.google.com"
+#define DEFAULT_NTP_SERVER_2 "time.nist.gov"
 
 /* BlynkManager */
 #define DEFAULT_BLYNK_WORK_STATUS true
 #define DEFAULT_BLYNK_SEND_DATA_TIME DEFAULT_READ_DATA_TIME // sec
+#define DEFAULT_BLYNK_SILENCE_TIME 300 // sec
+#define DEFAULT_BLYNK_DEADBAND 0 // centi
 
 /* --- Macroces --- */
 /* SystemManager */
 #define SAVE_SETTINGS_TIME 5 // sec
-#define SETTINGS_BUFFER_SIZE 1100
-
-/* TimeManager */
-#define NTP_SYNC_TIME 1 // min
-
-/* SensorsManager */
-#define MODULE_MANAGER_BLYNK_SUPPORT
-#define UNSPECIFIED_STATUS 255
-#define DS_SENSORS_MAX_COUNT 10
-#define DS_NAME_SIZE 3
-
-/* SolarSystemManager */
-#define SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
-#define SOLAR_DELTA_MIN 3
-#define SOLAR_DELTA_MAX 10
+#define SETTINGS_FILE "/config.nztr"
+
+// the worst case of all writeSettings(), the counts must follow every new key
+#define SETTINGS_ENTRY_SIZE 11 // the longest key ("SBLdb19") and the separators
+#define SETTINGS_NUMBER_SIZE 11 // "-2147483648", bool and float are shorter
+#define SETTINGS_BYTE_SIZE 4 // "255," of a byte array
+// system 1, time 3, sensors 6 + 2 per ds18b20, solar 19 + 1 per loop, display 3, network 7, blynk 3 + 2 per link
+#define SETTINGS_NUMBERS_COUNT (1 + 3 + 6 + 2 * DS_SENSORS_MAX_COUNT + 19 + (SOLAR_LOOPS_MAX - 1) + 3 + 7 + 3 + 2 * BLYNK_LINKS_MAX)
+#define SETTINGS_STRINGS_COUNT (1 + DS_SENSORS_MAX_COUNT + 5 + NTP_SERVERS_COUNT + 1 + BLYNK_LINKS_MAX)
+#define SETTINGS_ARRAYS_COUNT (DS_SENSORS_MAX_COUNT + 1 + (SOLAR_LOOPS_MAX - 1))
+#define SETTINGS_STRINGS_SIZE ((TIMEZONE_SIZE - 1) + DS_SENSORS_MAX_COUNT * (DS_NAME_SIZE - 1) + 5 * (NETWORK_SSID_PASS_SIZE - 1) + NTP_SERVERS_COUNT * (NTP_SERVER_SIZE - 1) + (BLYNK_AUTH_SIZE - 1) + BLYNK_LINKS_MAX * (BLYNK_ELEMENT_CODE_SIZE - 1))
+#define SETTINGS_ARRAYS_SIZE (DS_SENSORS_MAX_COUNT * HAL_DS_ADDRESS_SIZE + NETWORK_BSSID_SIZE + (SOLAR_LOOPS_MAX - 1) * SOLAR_LOOP_SETTINGS_SIZE)
+#define SETTINGS_BUFFER_SIZE ((SETTINGS_NUMBERS_COUNT + SETTINGS_STRINGS_COUNT + SETTINGS_ARRAYS_COUNT) * SETTINGS_ENTRY_SIZE + SETTINGS_NUMBERS_COUNT * SETTINGS_NUMBER_SIZE + SETTINGS_STRINGS_SIZE + SETTINGS_ARRAYS_SIZE * SETTINGS_BYTE_SIZE) // ~3.6 KB
+
+/* EncoderQueue */
+#define ENC_QUEUE_SIZE 32 // power of two
+#define ENC_EVENT_NONE 0
+#define ENC_EVENT_LEFT 1
+#define ENC_EVENT_RIGHT 2
+#define ENC_EVENT_LEFT_H 3
+#define ENC_EVENT_RIGHT_H 4
+#define ENC_EVENT_PRESS 5
+#define ENC_EVENT_CLICK 6
+#define ENC_EVENT_HOLDED 7
+#define ENC_FAST_TIME 40 // ms between detents
+#define ENC_ACCEL_MAX 10
+#define ENC_ACCEL_RANGE 20
 
 /* NetworkManager */
 #define NETWORK_OFF 0
@@ -101,13 +95,48 @@
 #define NETWORK_AP_STA 2
 #define NETWORK_AUTO 3
 #define NETWORK_SSID_PASS_SIZE 15
-#define NETWORK_RECONNECT_TIME 20 // sec
-
-#define UDP_RESEND_TIME 5 //sec
-#define NTP_SERVER "time.nist.gov"
+#define NETWORK_RECONNECT_MIN_TIME 4 // sec
+#define NETWORK_RECONNECT_MAX_TIME 60 // sec
+#define NETWORK_RECONNECT_JITTER 25 // %
+#define NETWORK_BSSID_SIZE 6
+
+#define NETWORK_IP_DHCP 0
+#define NETWORK_IP_STATIC 1
+#define NETWORK_IP_CACHED 2
+#define NETWORK_IP_ADDRESS 0
+#define NETWORK_IP_GATEWAY 1
+#define NETWORK_IP_SUBNET 2
+#define NETWORK_IP_DNS 3
+#define NETWORK_IP_CONFIG_COUNT 4
+#define NETWORK_IP_STRING_SIZE 16
+#define NETWORK_LEASE_CHECK_TIME 30 // sec
+#define NETWORK_CONNECT_TIME 10 // sec
+
+#define NETWORK_CONNECT_IDLE 0
+#define NETWORK_CONNECT_PENDING 1
+#define NETWORK_CONNECT_OK 2
+#define NETWORK_CONNECT_FAIL 3
+
+/* NtpClient */
+#define NTP_SERVERS_COUNT 3
+#define NTP_SERVER_SIZE 32 // "host" or "host:port"
 #define NTP_PORT 123
+#define NTP_LOCAL_PORT 2390
+#define NTP_PACKET_SIZE 48
+#define NTP_TIMEOUT 2000 // mls
+#define NTP_RETRY_TIME 10 // sec, after every server failed
+#define NTP_DNS_CACHE_TIME 60 // min
+#define NTP_UNIX_OFFSET 2208988800UL // 1900 -> 1970
+
+#define NTP_IDLE 0
+#define NTP_RESOLVE 1
+#define NTP_WAIT 2
 
 #define WEB_UPDATE_TIME 10 // sec
+#define WEB_VALUE_SIZE (CENTI_STRING_SIZE + 2)
+#define WEB_SENSORS_SELECT_SIZE (5 + DS_SENSORS_MAX_COUNT * DS_NAME_SIZE) // "NONE," and every name with its comma
+#define WEB_WATCHDOG_STATE_SIZE 64 // "4294967295 stalls (max 4294967295 sec), 4294967295 resets"
+#define WEB_NTP_STATE_SIZE 80 // "offset -2147483648 ms, rtt 65535 ms, stratum 255, drift -2147483648 ppb"
 
 /* BlynkManager */
 #define BLYNK_TYPE_UINT8_T 0
@@ -119,12 +148,62 @@
 #define BLYNK_LINKS_MAX 20
 #define BLYNK_AUTH_SIZE 35
 #define BLYNK_ELEMENT_CODE_SIZE 10
-#define BLYNK_RECONNECT_TIME 20 // sec
+#define BLYNK_RECONNECT_MIN_TIME 6 // sec, Blynk itself does not reconnect faster than 5 sec
+#define BLYNK_RECONNECT_MAX_TIME 300 // sec
+#define BLYNK_RECONNECT_JITTER 25 // %
+#define BLYNK_DNS_TIMEOUT 3000 // mls
+#define BLYNK_CONNECT_STEP_TIME 150 // mls, one connect attempt per tick; Blynk tries port 80 and then 8080, so a tick blocks twice that at most
+#define BLYNK_CONNECT_TIMEOUT 3000 // mls of attempts, then the backoff
+#define BLYNK_LOGIN_TIMEOUT 5000 // mls
+#define BLYNK_CONNECT_IDLE 0
+#define BLYNK_CONNECT_RESOLVE 1
+#define BLYNK_CONNECT_TCP 2
+#define BLYNK_CONNECT_LOGIN 3
+#define BLYNK_CONNECT_READY 4
+
+/* BlynkQueue */
+#define BLYNK_QUEUE_SIZE 32 // records in RAM, spilled to the file as one block
+#define BLYNK_QUEUE_FILE "/blynk.queue"
+#define BLYNK_QUEUE_FILE_MAX 2048 // records, 16 KB
+#define BLYNK_QUEUE_MIN_UNIX TIME_MIN_UNIX
+#define BLYNK_REPLAY_TIME 1000 // mls between replay batches
+#define BLYNK_REPLAY_COUNT 10 // records per batch, far below the server flood limit
+#define BLYNK_SILENCE_TIME_MAX 3600 // sec
+#define BLYNK_PORTS_COUNT 256
+#define BLYNK_NO_LINK 0xFF
+#define BLYNK_HEADER_SIZE 5
+#define BLYNK_FRAME_SIZE (BLYNK_HEADER_SIZE + 3 + 4 + CENTI_STRING_SIZE) // header, "vw", port, value
+#define BLYNK_PACKET_SIZE 512 // fits one TCP segment
+
+/* Profiler */
+// off unless built with -DPROFILER_SUPPORT, then the sections are timed and reported to Serial
+#define PROFILE_LOOP 0
+#define PROFILE_TIME 1
+#define PROFILE_SENSORS 2
+#define PROFILE_SOLAR 3
+#define PROFILE_DISPLAY 4
+#define PROFILE_NETWORK 5
+#define PROFILE_BLYNK 6
+#define PROFILE_SAVE_SETTINGS 7
+#define PROFILE_READ_SETTINGS 8
+#define PROFILE_WEB_BUILD 9
+#define PROFILE_WEB_ACTION 10
+#define PROFILE_BLYNK_SEND 11
+#define PROFILE_COUNT 12
+#define PROFILE_REPORT_TIME 60 // sec, 0 turns the serial report off
+#define PROFILE_JSON_SIZE 1024
 
 /* --- Macro functions --- */
-#define SEC_TO_MLS(TIME) ((TIME) * 1000)
-#define MIN_TO_MLS(TIME) ((TIME) * 60000)
-#define IS_EVEN_SECOND(MLS) ((MLS / 1000) % 2)
+#define BLYNK_HANDLER(...) [](SystemManager* system, const BlynkParam& param) { __VA_ARGS__; }
+#ifdef PROFILER_SUPPORT
+#define PROFILE(PROFILER, SECTION, ...) { profile_mark_t profile_mark = (PROFILER)->mark(); __VA_ARGS__; (PROFILER)->add(SECTION, &profile_mark); }
+#define PROFILE_BEGIN(PROFILER, MARK) profile_mark_t MARK = (PROFILER)->mark()
+#define PROFILE_END(PROFILER, SECTION, MARK) (PROFILER)->add(SECTION, &MARK)
+#else
+#define PROFILE(PROFILER, SECTION, ...) { __VA_ARGS__; }
+#define PROFILE_BEGIN(PROFILER, MARK)
+#define PROFILE_END(PROFILER, SECTION, MARK)
+#endif
 
 const uint8_t wifi[] = {0b00000, 0b01110, 0b10001, 0b00100, 0b01010, 0b00000, 0b00100, 0b00000};
 const uint8_t down_symbol[] = {0b00000, 0b00000, 0b00000, 0b00000, 0b00000, 0b10001, 0b01010, 0b00100};
@@ -140,26 +219,6 @@ const uint8_t UMB[] = {0b11111,  0b11111,  0b11111,  0b00000,  0b00000,  0b00000
 const char keyboard1[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '.', '_', '-', '!', '?', ',', '@', '%', '/', '|', '#', '*', '<', 'E'};
 const char keyboard2[] = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '1', '2', '3', '4', '5', '6', '7', '8', '9', '0', '<', '>', '<', 'E'};
 
-struct ds18b20_data_t {
-	void operator=(const ds18b20_data_t& other) {
-		strcpy(name, other.name);
-		memcpy(address, other.address, sizeof(DeviceAddress));
-		resolution = other.resolution;
-		correction = other.correction;
-
-		t = other.t;
-		status = other.status;
-	}
-	
-	char name[DS_NAME_SIZE];
-	DeviceAddress address;
-	uint8_t resolution;
-	float correction;
-	
-	float t;
-	uint8_t status;
-};
-
 struct blynk_element_t {
 	blynk_element_t(String code, void* pointer, uint8_t type) {
 		this->pointer = pointer;
@@ -179,211 +238,111 @@ struct blynk_element_t {
 	uint8_t type;
 };
 
+struct blynk_record_t {
+	uint32_t unix;
+	int16_t centi;
+	uint8_t port;
+	uint8_t decimals;
+};
+
+struct encoder_event_t {
+	uint8_t type;
+	uint32_t time;
+};
+
+struct profile_t {
+	uint32_t count;
+	uint32_t time; // mcs
+	uint32_t time_max; // mcs
+	int32_t heap; // bytes kept by the section
+	uint32_t heap_drops; // calls that left less free heap
+};
+
+struct profile_mark_t {
+	uint32_t time;
+	uint32_t heap;
+};
+
 struct blynk_link_t {
 	void operator=(const blynk_link_t& other) {
 		port = other.port;
 		strcpy(element_code, other.element_code);
+		deadband = other.deadband;
+		handler = other.handler;
+
+		last_centi = other.last_centi;
+		send_timer = other.send_timer;
+		sent_flag = other.sent_flag;
 	}
 
 	uint8_t port;
 	char element_code[BLYNK_ELEMENT_CODE_SIZE];
+	uint16_t deadband; // centi
+	blynk_handler_t handler; // resolved from element_code, NULL for read only
+
+	// last sent value, not saved
+	int16_t last_centi;
+	uint32_t send_timer;
+	bool sent_flag;
 };
 
 class NetworkManager;
-class SystemManager;
 class BlynkManager;
 
-class TimeManager {
-public:
-	TimeManager();
-	void begin();
-
-	void tick();
-	void makeDefault();
-	void writeSettings(char* buffer);
-	void readSettings(char* buffer);
-#ifdef TIME_MANAGER_BLYNK_SUPPORT
-	void addBlynkElementCodes(DynamicArray<String>* array);
-	bool blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	bool blynkElementParse(String code, const BlynkParam& param);
-#endif
-
-	uint8_t status();
-	uint8_t hour();
-	uint8_t minute();
-	uint8_t second();
-	uint8_t weekday();
-	uint8_t day();
-	uint8_t month();
-	uint16_t year();
-
-	void setSystemManager(SystemManager* system);
-
-	void setNtpFlag(bool ntp_flag);
-	void setGmt(int8_t gmt);
-	void setTime(TimeT* time);
-	void setTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint16_t year);
-	void setUnix(uint32_t unix);
-
-	SystemManager* getSystemManager();
-	uint8_t getStatus();
-
-	bool getNtpFlag();
-	int8_t getGmt();
-	TimeT getTime();
-	uint32_t getUnix();
-
-private:
-	SystemManager* system;
-	Clock clk;
-
-	bool ntp_flag;
-	int8_t gmt;
-
-	uint32_t ntp_sync_timer;
-};
-
-class SensorsManager {
-public:
-	SensorsManager();
-	void begin();
-
-	void tick();
-	void makeDefault();
-	void writeSettings(char* buffer);
-	void readSettings(char* buffer);
-#ifdef MODULE_MANAGER_BLYNK_SUPPORT
-	void addBlynkElementCodes(DynamicArray<String>* array);
-	bool blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	bool blynkElementParse(String code, const BlynkParam& param);
-#endif
-
-	void updateSensorsData();
-	bool addDS18B20();
-	bool deleteDS18B20(uint8_t index);
-
-	uint8_t makeDS18B20AddressList(DynamicArray<DeviceAddress>* array, DynamicArray<float>* t_array = NULL, DynamicArray<String>* string_array = NULL);
-	int8_t scanDS18B20AddressIndex(DynamicArray<DeviceAddress>* array, uint8_t* address);
-	
-	void setSystemManager(SystemManager* system);
-	void setReadDataTime(uint8_t time);
-
-	void setDS18B20(uint8_t index, ds18b20_data_t* ds18b20);
-	void setDS18B20Name(uint8_t index, String name);
-	void setDS18B20Address(uint8_t index, uint8_t* address);
-	void setDS18B20Resolution(uint8_t index, uint8_t resolution);
-	void setDS18B20Correction(uint8_t index, float correction);
-
-	DallasTemperature* getDallasTemperature();
-	uint8_t getReadDataTime();
-
-	float getAM2320T();
-	float getAM2320H();
-	uint8_t getAM2320Status();
-
-	uint8_t getGlobalDS18B20Count();
-	float getDS18B20TByAddress(uint8_t* address);
-	uint8_t getDS18B20Count();
-	ds18b20_data_t* getDS18B20(uint8_t index);
-	char* getDS18B20Name(uint8_t index);
-	uint8_t* getDS18B20Address(uint8_t index);
-	uint8_t getDS18B20Resolution(uint8_t index, bool sync_flag = true);
-	float getDS18B20Correction(uint8_t index);
-	float getDS18B20T(uint8_t index);
-	uint8_t getDS18B20Status(uint8_t index);
-
-private:
-	bool isCorrectDS18B20Index(uint8_t index);
-	void DS18B20AddressToString(uint8_t* address, String* string);
-
-	AM2320 am2320_sensor;
-	OneWire oneWire;
-	DallasTemperature ds18b20_sensor;
-	SystemManager* system;
-
-	uint8_t read_data_time;
-
-	struct am2320_data_t {
-		float t;
-		float h;
-		uint8_t status;
-
-	} am2320_data;
-	DynamicArray<ds18b20_data_t> ds18b20_data;
-
-	uint32_t read_data_timer;
-};
+#include "display.h"
 
-class SolarSystemManager {
+class NtpClient {
 public:
-	SolarSystemManager();
+	NtpClient();
 	void begin();
 
-	void tick();
+	bool tick(TimeManager* time);
 	void makeDefault();
 	void writeSettings(char* buffer);
 	void readSettings(char* buffer);
-#ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
-	void addBlynkElementCodes(DynamicArray<String>* array);
-	bool blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	bool blynkElementParse(String code, const BlynkParam& param);
-#endif
-
-	void setSystemManager(SystemManager* system);
-
-	void setReleFlag(bool rele_flag);
-	void setWorkFlag(bool work_flag);
-	void setErrorOnFlag(bool error_on_flag);
-	void setReleInvertFlag(bool rele_invert_flag);
-	void setDelta(uint8_t delta);
-
-	void setSensor(uint8_t solar_sensor, int8_t ds18b20_index);
-	void setBatterySensor(int8_t ds18b20_index);
-	void setBoilerSensor(int8_t ds18b20_index);
-	void setExitSensor(int8_t ds18b20_index);
-
-	SystemManager* getSystemManager();
-	uint8_t getStatus();
-
-	bool getReleFlag();
-	bool getWorkFlag();
-	bool getErrorOnFlag();
-	bool getReleInvertFlag();
-	uint8_t getDelta();
-	
-	uint8_t getBatterySensorStatus();
-	uint8_t getBoilerSensorStatus();
-	uint8_t getExitSensorStatus();
 
-	int8_t getSensor(uint8_t solar_sensor);
-	int8_t getBatterySensor();
-	int8_t getBoilerSensor();
-	int8_t getExitSensor();
+	void setServer(uint8_t index, const char* server);
 
-	float getBatteryT();
-	float getBoilerT();
-	float getExitT();
+	char* getServer(uint8_t index);
+	int32_t getOffset();
+	uint16_t getDelay();
+	uint8_t getStratum();
 
 private:
-	void releTick();
+	void resolve();
+	void send(TimeManager* time);
+	bool receive(TimeManager* time);
+	void nextServer();
+	static void dnsFound(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
 
-	SystemManager* system;
-
-	bool work_flag;
-	bool error_on_flag;
-	bool rele_invert_flag;
-	uint8_t delta;
+	static uint64_t readTimestamp(const uint8_t* buffer);
+	static void writeTimestamp(uint8_t* buffer, uint64_t unix_ms);
 
-	int8_t battery_sensor_index;
-	int8_t boiler_sensor_index;
-	int8_t exit_sensor_index;
+	char servers[NTP_SERVERS_COUNT][NTP_SERVER_SIZE];
 
-	bool rele_flag;
-	
+	WiFiUDP udp;
+	uint8_t state;
+	uint8_t server_index;
+	uint8_t failed_count;
+	uint32_t state_timer;
+
+	uint32_t server_ip;
+	uint16_t server_port;
+	uint32_t dns_timer;
+
+	uint8_t request_timestamp[8];
+	uint64_t request_local_ms;
+
+	int32_t offset;
+	uint16_t round_trip;
+	uint8_t stratum;
+
+	// written from the lwIP dns callback
+	static volatile bool dns_done_flag;
+	static volatile uint32_t dns_ip;
+	static volatile uint8_t dns_index;
 };
 
-#include "display.h"
-
 class NetworkManager {
 public:
 	NetworkManager();
@@ -396,11 +355,13 @@ public:
 	void readSettings(char* buffer);
 #ifdef NETWORK_MANAGER_BLYNK_SUPPORT
 	void addBlynkElementCodes(DynamicArray<String>* array);
-	bool blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	bool blynkElementParse(String code, const BlynkParam& param);
+	bool blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t blynkElementHandler(const char* code);
 #endif
 	
-	bool connect(String ssid = String(""), String pass = String(""), uint8_t connect_time = 0, bool auto_save = false);
+	void connect();
+	void reconnect();
+	void beginConnect(const char* ssid, const char* pass, uint8_t connect_time = NETWORK_CONNECT_TIME, bool auto_save = false);
 	void off();
 	bool isWifiOn();
 	bool isApOn();
@@ -408,6 +369,7 @@ public:
 	static void uiBuild();
 	static void uiAction();
 	bool ntpSync(TimeManager* time);
+	NtpClient* getNtpClient();
 
 	void setSystemManager(SystemManager* system);
 
@@ -416,20 +378,43 @@ public:
 	void setWifi(const char* ssid, const char* pass);
 	void setAp(String* ssid, String* pass);
 	void setAp(const char* ssid, const char* pass);
+	void setIpMode(uint8_t ip_mode);
+	bool setIpConfig(uint8_t index, const char* text);
+	void setIpConfig(uint8_t index, uint32_t address);
 
 	SystemManager* getSystemManager();
 	wl_status_t getStatus();
+	uint8_t getConnectState();
+	uint8_t getConnectTimeLeft();
 
 	uint8_t getMode();
 	char* getWifiSsid();
 	char* getWifiPass();
 	char* getApSsid();
 	char* getApPass();
+	uint8_t getIpMode();
+	uint32_t getIpConfig(uint8_t index);
+	char* getIpConfigString(uint8_t index, char* buffer);
 
 private:
 	/* --- functions --- */
 	static void updateWebSensorsBlock();
 	static void updateWebBlynkBlock();
+	static char* makeWebValue(char* buffer, int16_t centi, const char* unit);
+	static const char* makeWebConnectState();
+	static const char* makeWebNtpState();
+	static const char* makeWebBlynkQueue();
+	static const char* makeWebPumpTime();
+	static const char* makeWebWatchdog();
+	static const char* makeWebEnergy();
+
+	void connectTick();
+	void wifiBegin(const char* ssid, const char* pass);
+	void wifiLinkTick();
+	void applyIpConfig(const char* ssid);
+	void leaseCheckTick();
+	static void onWifiGotIp(const WiFiEventStationModeGotIP& event);
+	static void onWifiDisconnected(const WiFiEventStationModeDisconnected& event);
 
 	/* --- settings --- */
 	uint8_t mode;
@@ -439,10 +424,16 @@ private:
 	char ssid_ap[NETWORK_SSID_PASS_SIZE];
 	char pass_ap[NETWORK_SSID_PASS_SIZE];
 
+	uint8_t ip_mode;
+	uint32_t ip_config[NETWORK_IP_CONFIG_COUNT];
+	char lease_ssid[NETWORK_SSID_PASS_SIZE]; // the network the cached lease came from
+
 	/* --- classes --- */
 	static SystemManager* system;
-	WiFiUDP udp;
+	NtpClient ntp;
 	static GyverPortal ui;
+	WiFiEventHandler wifi_got_ip_handler;
+	WiFiEventHandler wifi_disconnected_handler;
 
 	/* --- structures --- */
 	struct web_blynk_block_t {
@@ -457,8 +448,29 @@ private:
 
 	/* --- variables --- */
 	bool reset_request;
-	bool tick_allow;
+	bool connect_request;
 	uint32_t wifi_reconnect_timer;
+	uint32_t wifi_reconnect_delay;
+
+	uint8_t wifi_bssid[NETWORK_BSSID_SIZE];
+	uint8_t wifi_channel;
+	bool wifi_fast_flag;
+
+	bool wifi_dhcp_flag;
+	bool lease_check_flag;
+	uint32_t lease_check_timer;
+
+	char connect_ssid[NETWORK_SSID_PASS_SIZE];
+	char connect_pass[NETWORK_SSID_PASS_SIZE];
+	uint8_t connect_state;
+	uint8_t connect_time;
+	bool connect_auto_save;
+	uint32_t connect_timer;
+
+	// written from the SDK event callbacks, read in tick()
+	static volatile bool wifi_got_ip_flag;
+	static volatile bool wifi_link_flag;
+	static volatile uint8_t wifi_disconnect_reason;
 
 	/* --- web variables --- */
 	static String web_update_codes;
@@ -467,9 +479,36 @@ private:
 
 };
 
+class BlynkQueue {
+public:
+	BlynkQueue();
+	void begin();
+
+	void push(blynk_record_t* record);
+	uint8_t read(blynk_record_t* records, uint8_t count);
+	void pop(uint8_t count);
+	void clear();
+
+	uint16_t getCount();
+	uint16_t getDropCount();
+
+private:
+	void spill();
+
+	blynk_record_t records[BLYNK_QUEUE_SIZE];
+	uint8_t head;
+	uint8_t count;
+
+	// the file always holds older records than RAM
+	uint16_t file_count;
+	uint16_t file_read;
+	uint16_t drop_count;
+};
+
 class BlynkManager {
 public:
 	BlynkManager();
+	void begin();
 	
 	void tick();
 	void makeDefault();
@@ -485,30 +524,44 @@ public:
 
 	void setWorkFlag(bool work_flag);
 	void setSendDataTime(uint8_t time);
+	void setSilenceTime(uint16_t time);
 	void setAuth(String auth);
 	
 	void setLinkPort(uint8_t index, uint8_t port);
 	void setLinkElementCode(uint8_t index, String code);
+	void setLinkDeadband(uint8_t index, uint16_t deadband);
 	
 	SystemManager* getSystemManager();
 	bool getStatus();
+	uint8_t getConnectState();
 
 	bool getWorkFlag();
 	uint8_t getSendDataTime();
+	uint16_t getSilenceTime();
 	char* getAuth();
 
 	uint8_t getLinksCount();
 	uint8_t getLinkPort(uint8_t index);
 	char* getLinkElementCode(uint8_t index);
+	uint16_t getLinkDeadband(uint8_t index);
+	BlynkQueue* getQueue();
 
 private:
 	bool isCorrectLinkIndex(uint8_t index);
 	int8_t scanLinkIndex(String element_code);
 
-	void connectBlynk();
+	void connectTick();
+	void armBlynk();
 	void disconnectBlynk();
+	static void dnsFound(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
 
 	void sendData();
+	void replayTick();
+	uint8_t makeFrame(uint8_t* frame, uint8_t port, const char* value);
+	uint8_t makeGroupFrame(uint8_t* frame, uint32_t unix);
+	uint8_t makeHeader(uint8_t* frame, uint8_t command, uint16_t body_length);
+	bool writePacket(uint8_t* packet, uint16_t length);
+	void updateHandlers();
 	friend BLYNK_WRITE_DEFAULT();
 
 	SystemManager* system;
@@ -518,14 +571,83 @@ private:
 	
 	bool work_flag;
 	uint8_t send_data_time;
+	uint16_t silence_time;
 	char auth[BLYNK_AUTH_SIZE];
 
 	DynamicArray<blynk_link_t> links;
+	uint8_t port_links[BLYNK_PORTS_COUNT]; // incoming writes go to the link at once
 	uint32_t send_data_timer;
-	uint32_t blynk_reconnect_timer;
+
+	BlynkQueue queue;
+	uint32_t replay_timer;
+
+	uint8_t connect_state;
+	uint32_t connect_timer;
+	uint32_t connect_delay;
+	uint32_t server_ip;
+
+	static volatile bool dns_done_flag;
+	static volatile uint32_t dns_ip;
+};
+
+class EncoderQueue {
+public:
+	EncoderQueue();
+
+	void push(uint8_t type);
+	bool next();
+	void clear();
+
+	bool isTurn();
+	bool isLeft(bool keep_flag = false);
+	bool isRight(bool keep_flag = false);
+	bool isLeftH(bool keep_flag = false);
+	bool isRightH(bool keep_flag = false);
+	bool isPress();
+	bool isClick();
+	bool isHolded();
+	void resetStates();
+
+	int8_t getStep();
+	int8_t getStep(int32_t range);
+	uint16_t getLostCount();
+
+private:
+	bool checkEvent(uint8_t type, bool keep_flag);
+
+	volatile encoder_event_t events[ENC_QUEUE_SIZE];
+	volatile uint8_t head;
+	volatile uint8_t tail;
+	volatile uint16_t lost_count;
+
+	uint8_t event_type;
+	int8_t event_step;
+	uint8_t last_turn_type;
+	uint32_t last_turn_time;
+	uint8_t accel;
 };
 
-class SystemManager {
+#ifdef PROFILER_SUPPORT
+class Profiler {
+public:
+	Profiler();
+
+	bool tick();
+	profile_mark_t mark();
+	void add(uint8_t section, profile_mark_t* mark);
+	void clear();
+
+	char* makeJson(char* buffer, uint16_t size);
+	profile_t* getProfile(uint8_t section);
+
+private:
+	profile_t profiles[PROFILE_COUNT];
+	uint32_t heap_min;
+	uint32_t report_timer;
+};
+#endif
+
+class SystemManager : public CoreManager {
 public:
 	SystemManager();
 	void begin();
@@ -534,49 +656,47 @@ public:
 	void makeDefault();
 	void reset();
 	void resetAll();
+	void saveSettings(bool ignore_flag = false);
+	void readSettings();
 
 	void makeBlynkElementCodesList(DynamicArray<String>* array);
-	void makeBlynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	void makeBlynkElementParse(String element_code, const BlynkParam& param);
+	bool makeBlynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t makeBlynkElementHandler(const char* element_code);
 	int8_t scanBlynkElemetCodeIndex(DynamicArray<String>* array, String element_code);
 
+	bool ntpSync(TimeManager* time);
 	bool deleteBlynkLink(String element_code);
 	bool modifyBlynkLinkElementCode(String previous_code, String new_code);
 
-	void saveSettingsRequest();
 	void buzzer(uint16_t freq, uint16_t duration);
 
 	static void encoderClkInterrupt();
 	static void encoderDtInterrupt();
 	static void encoderSwInterrupt();
+	static void encoderPoll();
 
 	void setBuzzerFlag(bool buzzer_flag);
 
 	bool getBuzzerFlag();
-	TimeManager* getTimeManager();
-	SensorsManager* getSensorsManager();
-	SolarSystemManager* getSolarSystemManager();
 	DisplayManager* getDisplayManager();
 	NetworkManager* getNetworkManager();
 	BlynkManager* getBlynkManager();
-	Encoder* getEncoder();
+	EncoderQueue* getEncoder();
+#ifdef PROFILER_SUPPORT
+	Profiler* getProfiler();
+#endif
 
 private:
-	// SystemManager does not support Blynk elements
-	void saveSettings(bool ignore_flag = false);
-	void readSettings();
-
-	TimeManager time;
-	SensorsManager sensors;
-	SolarSystemManager solar;
 	DisplayManager display;
 	NetworkManager network;
 	BlynkManager blynk;
 	static Encoder enc;
+	static EncoderQueue enc_queue;
+#ifdef PROFILER_SUPPORT
+	Profiler profiler;
+#endif
 	
 	bool buzzer_flag;
-
-	bool save_settings_request;
 	uint32_t save_settings_timer;
 };
 
@@ -590,8 +710,8 @@ T1 smartIncr(T1& value, T2 incr_step, T3 min, T4 max) {
 		return value;
 	}
 	
-	value += (T1) incr_step;
-	value = (T1) constrain(value, min, max);
+	auto result = value + incr_step;
+	value = (T1) constrain(result, min, max);
 	
 	return value;
 }
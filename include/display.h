@@ -10,12 +10,42 @@
 #pragma once
 
 /* --- Macroces --- */
+/* LcdManager */
+#define LCD_CGRAM_SLOTS 8
+#define LCD_GLYPHS_COUNT 9
+#define LCD_EMPTY_SLOT 255
+
+#define GLYPH_LT 0
+#define GLYPH_UB 1
+#define GLYPH_RT 2
+#define GLYPH_LL 3
+#define GLYPH_LB 4
+#define GLYPH_LR 5
+#define GLYPH_UMB 6
+#define GLYPH_WIFI 7
+#define GLYPH_DOWN 8
+
 /* DisplayManager */
 #define DISPLAY_AUTO_RESET_TIME 30 // min
 
 /* SettingsWindow */
 #define SCREEN_EXIT_BUZZER_FREQ 200
 #define SCREEN_EXIT_BUZZER_TIME 300 // mls
+#define SCREEN_CONNECT_RESULT_TIME 500 // mls
+
+/* MenuWindow */
+#define MENU_ROWS 4
+#define MENU_OK_COLUMN 15
+#define MENU_COLUMNS 20
+#define MENU_TEXT_SIZE NETWORK_IP_STRING_SIZE
+#define MENU_COUNTERS_TEXT_SIZE 23 // two uint32_t, a unit and a separator: "4294967295h/4294967295"
+
+#define MENU_TOGGLE 0
+#define MENU_NUMBER 1
+#define MENU_CYCLE 2
+#define MENU_ACTION 3
+#define MENU_WINDOW 4
+#define MENU_STRING 5
 
 /* MainWindow */
 #define SOLAR_TICK_POINTER_TIME 500 // mls
@@ -23,18 +53,38 @@
 /* SetDS18B20AddressWindow */
 #define DS18B20_START_PRINT_BYTE 4 // byte [0 - 7]
 
+/* --- Macro functions --- */
+/* MenuWindow */
+#define MENU_GET(...) [](SystemManager* system) -> int32_t { return __VA_ARGS__; }
+#define MENU_SET(...) [](SystemManager* system, int32_t value) { __VA_ARGS__; }
+#define MENU_TEXT(...) [](SystemManager* system) -> const char* { return __VA_ARGS__; }
+#define MENU_SET_TEXT(...) [](SystemManager* system, const char* text) { __VA_ARGS__; }
+#define MENU_OPEN(...) [](SystemManager* system) -> Window* { return new __VA_ARGS__; }
+
 
 class LcdManager : public LiquidCrystal_I2C {
 public:
 	LcdManager();
+	void init();
+
+	uint8_t loadGlyph(uint8_t glyph);
+	void easyWriteGlyph(uint8_t x, uint8_t y, uint8_t glyph);
+	void resetGlyphs();
 
 	void printTitle(uint8_t y, String title, uint16_t delay_time = 800, bool clear_flag = true);
 	void easyPrint(uint8_t x, uint8_t y, String string);
 	void easyPrint(uint8_t x, uint8_t y, int32_t number);
 	void easyPrint(uint8_t x, uint8_t y, float number);
+	void easyPrintCenti(uint8_t x, uint8_t y, int16_t centi, uint8_t decimals = 2);
+	void printCenti(int16_t centi, uint8_t decimals = 2);
 	void easyWrite(uint8_t x, uint8_t y, uint8_t code);
 	void clearLine(uint8_t line);
 	void clearColumn(uint8_t column);
+
+private:
+	uint8_t cgram_glyph[LCD_CGRAM_SLOTS];
+	uint32_t cgram_use[LCD_CGRAM_SLOTS];
+	uint32_t glyphs_tick;
 };
 
 
@@ -57,8 +107,8 @@ public:
 	void readSettings(char* buffer);
 #ifdef DISPLAY_MANAGER_BLYNK_SUPPORT
 	void addBlynkElementCodes(DynamicArray<String>* array);
-	bool blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link);
-	bool blynkElementParse(String code, const BlynkParam& param);
+	bool blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals);
+	blynk_handler_t blynkElementHandler(const char* code);
 #endif
 
 	bool action();
@@ -106,6 +156,53 @@ public:
 	virtual void print(LcdManager* lcd, DisplayManager* display, SystemManager* system) = 0;
 };
 
+struct menu_item_t {
+	const char* label;
+	uint8_t type;
+	int32_t min;
+	int32_t max;
+
+	int32_t (*get)(SystemManager* system);
+	void (*set)(SystemManager* system, int32_t value);
+	const char* (*text)(SystemManager* system);
+	void (*set_text)(SystemManager* system, const char* text);
+	Window* (*open)(SystemManager* system);
+};
+
+struct menu_t {
+	const char* title;
+	bool save_flag;
+	uint8_t items_count;
+	const menu_item_t* items;
+};
+
+extern const menu_t settings_menu;
+extern const menu_t network_settings_menu;
+extern const menu_t ip_settings_menu;
+extern const menu_t blynk_settings_menu;
+extern const menu_t solar_settings_menu;
+extern const menu_t system_settings_menu;
+extern const menu_t time_settings_menu;
+
+class MenuWindow : public Window {
+public:
+	MenuWindow(const menu_t* menu);
+	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
+
+private:
+	void printItem(LcdManager* lcd, SystemManager* system, uint8_t index);
+	bool isItemEnabled(SystemManager* system, const menu_item_t* item);
+
+	const menu_t* menu;
+
+	bool print_title_flag = true;
+	bool print_flag = true;
+	bool edit_flag = false;
+	uint8_t cursor = 0;
+
+	char edit_text[MENU_TEXT_SIZE] = "";
+};
+
 class MainWindow : public Window {
 public:
 	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
@@ -119,7 +216,6 @@ private:
 	void printBlynk(LcdManager* lcd, SystemManager* system);
 
 	void printDigit(LcdManager* lcd, uint8_t x, uint8_t y, uint8_t digit);
-	void makeSymbols(LcdManager* lcd);
 
 	struct solar_window_data_t {
 		uint8_t pointer = 0;
@@ -127,7 +223,6 @@ private:
 
 	} solar_window_data;
 
-	bool create_symbol_flag = true;
 	uint8_t cursor = 0;
 };
 
@@ -139,28 +234,6 @@ private:
 	uint8_t cursor = 0;
 };
 
-class SettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_title_flag = true;
-	bool print_flag = true;
-	uint8_t cursor = 0;
-};
-
-class NetworkSettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_flag = true;
-	uint8_t cursor = 0;
-
-	char ssid_ap_to_set[NETWORK_SSID_PASS_SIZE] = "";
-	char pass_ap_to_set[NETWORK_SSID_PASS_SIZE] = "";
-};
-
 class WifiSettingsWindow : public Window {
 public:
 	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
@@ -173,15 +246,9 @@ private:
 
 	char ssid_to_set[NETWORK_SSID_PASS_SIZE] = "";
 	char pass_to_set[NETWORK_SSID_PASS_SIZE] = "";
-};
 
-class BlynkSettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_flag = true;
-	uint8_t cursor = 0;
+	bool connect_flag = false;
+	uint32_t connect_result_timer = 0;
 };
 
 class BlynkLinksSettingsWindow : public Window {
@@ -199,35 +266,6 @@ private:
 	DynamicArray<String> element_codes;
 };
 
-class SolarSettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_flag = true;
-	uint8_t cursor = 0;
-};
-
-class SystemSettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_flag = true;
-	uint8_t cursor = 0;
-};
-
-class TimeSettingsWindow : public Window {
-public:
-	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-
-private:
-	bool print_flag = true;
-	uint8_t cursor = 0;
-
-	TimeT* time_to_set = NULL;
-};
-
 class DS18B20SensorsSettingsWindow : public Window {
 public:
 	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
@@ -243,14 +281,13 @@ private:
 class SetTimeWindow : public Window {
 public:
 	void print(LcdManager* lcd, DisplayManager* display, SystemManager* system);
-	void setTimeT(TimeT* time);
 
 private:
-	bool create_symbol_flag = true;
+	bool initialization_flag = true;
 	bool print_flag = true;
 	uint8_t cursor = 0;
 
-	TimeT* config_time = NULL;
+	TimeT config_time;
 };
 
 class SetDS18B20Window : public Window {
@@ -303,7 +340,6 @@ public:
 	void setString(char* string, uint8_t size);
 
 private:
-	bool create_symbol_flag = true;
 	bool print_key_flag = true;
 	bool print_string_flag = true;
 	bool caps = false;
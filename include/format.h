@@ -0,0 +1,20 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <Arduino.h>
+
+/* --- Macroces --- */
+#define CENTI_STRING_SIZE 8 // "-327.68"
+
+/* --- Functions --- */
+// centi values are hundredths of a unit: 2345 -> "23.45"
+char* centiToString(int16_t centi, uint8_t decimals, char* buffer);
+int16_t floatToCenti(float value);
+int16_t rawToCenti(int16_t raw);
@@ -0,0 +1,82 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Hardware access of the control core (core.h). hal_esp8266.cpp is the board,
+ * hal_linux.cpp keeps the same state in memory and in a local directory for
+ * the native env, which defines HAL_LINUX. The network and UI managers still
+ * use the Arduino APIs, lib/ArduinoHost gives them to the native env.
+ */
+
+/* --- Macroces --- */
+#define HAL_DS_DISCONNECTED_RAW -7040 // DEVICE_DISCONNECTED_RAW
+#define HAL_DS_DISCONNECTED_C -127 // DEVICE_DISCONNECTED_C
+#define HAL_DS_ADDRESS_SIZE 8
+#define HAL_RTC_SIZE 512 // bytes of RTC user memory, kept over resets but not over power loss
+
+// the codes of rst_info::reason
+#define HAL_RESET_POWER 0
+#define HAL_RESET_WDT 1
+#define HAL_RESET_EXCEPTION 2
+#define HAL_RESET_SOFT_WDT 3
+#define HAL_RESET_SOFT 4
+#define HAL_RESET_DEEP_SLEEP 5
+#define HAL_RESET_EXTERNAL 6
+
+/* --- Functions --- */
+// time
+uint32_t halMillis();
+uint32_t halMicros();
+
+// the handler runs outside loop(), also while loop() is blocked in a delay() or yield()
+void halTickerAttach(uint32_t period, void (*handler)(void*), void* arg);
+
+// reset
+void halRestart();
+uint8_t halResetReason();
+bool halRtcRead(uint32_t offset, void* data, uint32_t size);
+bool halRtcWrite(uint32_t offset, const void* data, uint32_t size);
+
+// heap
+uint32_t halFreeHeap();
+uint8_t halHeapFragmentation();
+
+// gpio
+void halPinMode(uint8_t pin, uint8_t mode);
+void halDigitalWrite(uint8_t pin, bool value);
+bool halDigitalRead(uint8_t pin);
+void halAttachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void halTone(uint8_t pin, uint16_t freq, uint32_t duration);
+
+// filesystem, the size is -1 for a missing file
+bool halFsBegin();
+int32_t halFileSize(const char* path);
+int32_t halFileRead(const char* path, void* buffer, uint32_t size, uint32_t offset);
+bool halFileWrite(const char* path, const void* data, uint32_t size, bool append_flag);
+bool halFileRemove(const char* path);
+
+// DS18B20 on the OneWire bus
+void halDsBegin(uint8_t pin);
+uint8_t halDsScan();
+bool halDsAddress(uint8_t index, uint8_t* address);
+void halDsRequest();
+int16_t halDsRaw(const uint8_t* address);
+void halDsSetResolution(const uint8_t* address, uint8_t resolution);
+uint8_t halDsResolution(const uint8_t* address);
+
+// AM2320 on I2C, the status is the one of AM2320::read()
+uint8_t halAm2320Read(float* t, float* h);
+
+// wifi station
+bool halWifiConnected();
+int8_t halWifiRssi();
@@ -0,0 +1,37 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "hal.h"
+
+/* --- Macroces --- */
+#define HAL_LINUX_PINS_COUNT 32
+#define HAL_LINUX_DS_MAX_COUNT 16
+#define HAL_LINUX_PATH_SIZE 64
+#define HAL_FS_ROOT "fs" // directory used as the flash
+
+/* --- Structures --- */
+struct hal_linux_ds_t {
+	uint8_t address[HAL_DS_ADDRESS_SIZE];
+	int16_t raw;
+	uint8_t resolution;
+	bool connected_flag;
+};
+
+/* --- Functions --- */
+// the host side sets what the hardware would report
+void halLinuxSetVirtualTime(bool virtual_flag, uint32_t millis);
+void halLinuxAdvanceTime(uint32_t millis);
+uint8_t halLinuxAddDs(const uint8_t* address);
+void halLinuxSetDs(uint8_t index, float t, bool connected_flag);
+void halLinuxSetAm2320(float t, float h, uint8_t status);
+void halLinuxSetWifi(bool connected_flag);
+void halLinuxTicker();
+void halLinuxSetResetReason(uint8_t reason);
+uint8_t halLinuxGetPinMode(uint8_t pin);
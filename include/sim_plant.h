@@ -0,0 +1,103 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "core.h"
+#include "hal_linux.h"
+
+/*
+ * Thermal plant of the solar loop for host runs: the solar battery (collector),
+ * the boiler and the exit pipe. Temperatures go to the virtual DS18B20
+ * sensors of hal_linux, the pump is read back from the relay pin. Time is
+ * virtual, so the result depends only on the config. The control is the real
+ * CoreManager ticked from simRun, see test/test_plant.
+ */
+
+/* --- Macroces --- */
+#define SIM_WATER_CP 4186.0f // J/(kg*K)
+#define SIM_REPORT_SIZE 256
+
+/* --- Structures --- */
+enum sim_sun_t {
+	SIM_SUN_CLEAR = 0,
+	SIM_SUN_CLOUDY,
+	SIM_SUN_CONSTANT,
+};
+
+struct sim_config_t {
+	// sun
+	uint8_t sun_profile;
+	float sun_peak; // W/m2
+	uint8_t sunrise; // hour
+	uint8_t sunset; // hour
+	uint32_t seed; // clouds
+
+	// solar battery
+	float collector_area; // m2
+	float collector_efficiency;
+	float collector_mass; // kg of water
+	float collector_loss; // W/K
+
+	// boiler
+	float boiler_mass; // kg of water
+	float boiler_loss; // W/K
+	float boiler_draw; // W taken by the house
+
+	// loop
+	float pump_flow; // kg/s
+	float exchanger_efficiency;
+	float pipe_time; // sec, lag of the exit pipe
+
+	float ambient_t;
+	float room_t;
+	float start_t;
+
+	uint8_t rele_pin;
+	bool rele_invert_flag;
+	uint32_t chatter_time; // sec, shorter cycles are chatter
+};
+
+struct sim_plant_t {
+	sim_config_t config;
+	uint8_t battery_index;
+	uint8_t boiler_index;
+	uint8_t exit_index;
+
+	float battery_t;
+	float boiler_t;
+	float exit_t;
+	float cloud; // 0..1 of the current hour
+	uint32_t cloud_hour;
+	uint32_t random;
+
+	uint32_t time; // ms
+	bool pump_flag;
+	uint32_t pump_switch_time;
+
+	// report
+	uint32_t pump_cycles;
+	uint32_t chatter_cycles;
+	uint32_t pump_time; // sec
+	double energy_moved; // Wh
+	double energy_collected; // Wh
+	float boiler_t_max;
+};
+
+typedef void (*sim_tick_t)(void* context);
+
+/* --- Functions --- */
+void simMakeDefault(sim_config_t* config);
+void simBegin(sim_plant_t* plant, const sim_config_t* config);
+
+// steps the plant by step ms and calls tick after each step
+void simRun(sim_plant_t* plant, uint32_t duration, uint32_t step, sim_tick_t tick, void* context);
+void simStep(sim_plant_t* plant, uint32_t step);
+
+float simSun(sim_plant_t* plant);
+char* simReport(sim_plant_t* plant, char* buffer);
@@ -0,0 +1,52 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <Arduino.h>
+
+/* --- Macroces --- */
+#define TIMEZONE_SIZE 48 // "EET-2EEST,M3.5.0/3,M10.5.0/4"
+
+/* --- Structures --- */
+struct timezone_rule_t {
+	uint8_t month; // 1 - 12
+	uint8_t week; // 1 - 5, 5 is the last one
+	uint8_t weekday; // 0 - 6, 0 is sunday
+	int32_t time; // sec from local midnight
+};
+
+struct timezone_t {
+	int32_t std_offset; // sec east of UTC
+	int32_t dst_offset;
+	bool dst_flag;
+	timezone_rule_t dst_start;
+	timezone_rule_t dst_end;
+};
+
+struct local_time_t {
+	uint8_t second;
+	uint8_t minute;
+	uint8_t hour;
+	uint8_t weekday; // 0 - 6, 0 is sunday
+	uint8_t day;
+	uint8_t month;
+	uint16_t year;
+
+	int32_t offset; // sec east of UTC
+	bool dst;
+};
+
+/* --- Functions --- */
+// POSIX TZ rule, "std offset[dst[offset][,Mm.w.d[/time],Mm.w.d[/time]]]"
+bool parseTimezone(const char* text, timezone_t* timezone);
+void makeTimezone(int32_t offset, timezone_t* timezone);
+int32_t timezoneOffset(const timezone_t* timezone, uint32_t unix, bool* dst);
+
+void breakTime(uint32_t unix, local_time_t* time);
+uint32_t makeTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second);
@@ -0,0 +1,111 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include "binary.h"
+#include "pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+#include "HardwareSerial.h"
+#include "Esp.h"
+
+/*
+ * The ESP8266 Arduino core as the native env sees it. The env defines ARDUINO
+ * and ESP8266, so the libraries take their board paths, and HAL_LINUX, so
+ * hal_linux.cpp is built instead of hal_esp8266.cpp. The time and the pins
+ * come from hal_linux.cpp.
+ */
+
+/* --- Macroces --- */
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x00
+#define OUTPUT 0x01
+#define INPUT_PULLUP 0x02
+
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+
+#define A0 17
+
+#define PI 3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI 6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+/* --- Macro functions --- */
+#define bitRead(VALUE, BIT) (((VALUE) >> (BIT)) & 0x01)
+#define bitSet(VALUE, BIT) ((VALUE) |= (1UL << (BIT)))
+#define bitClear(VALUE, BIT) ((VALUE) &= ~(1UL << (BIT)))
+#define bitWrite(VALUE, BIT, BIT_VALUE) ((BIT_VALUE) ? bitSet(VALUE, BIT) : bitClear(VALUE, BIT))
+#define constrain(AMT, LOW_VALUE, HIGH_VALUE) ((AMT) < (LOW_VALUE) ? (LOW_VALUE) : ((AMT) > (HIGH_VALUE) ? (HIGH_VALUE) : (AMT)))
+
+// the ESP8266 core takes them from std as well
+using std::min;
+using std::max;
+using std::abs;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// the pins of the d1_mini the core is wired for
+static const uint8_t D0 = 16;
+static const uint8_t D1 = 5;
+static const uint8_t D2 = 4;
+static const uint8_t D3 = 0;
+static const uint8_t D4 = 2;
+static const uint8_t D5 = 14;
+static const uint8_t D6 = 12;
+static const uint8_t D7 = 13;
+static const uint8_t D8 = 15;
+static const uint8_t RX = 3;
+static const uint8_t TX = 1;
+
+/* --- Functions --- */
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long time);
+void delayMicroseconds(unsigned int time);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+// one thread, nothing to lock
+inline void interrupts() {
+}
+
+inline void noInterrupts() {
+}
+
+long random(long max_value);
+long random(long min_value, long max_value);
+void randomSeed(unsigned long seed);
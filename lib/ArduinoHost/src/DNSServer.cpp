@@ -0,0 +1,23 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "DNSServer.h"
+
+bool DNSServer::start(uint16_t port, const String& domain, const IPAddress& ip) {
+	return true;
+}
+
+void DNSServer::stop() {
+}
+
+void DNSServer::processNextRequest() {
+}
+
+void DNSServer::setTTL(uint32_t ttl) {
+}
@@ -0,0 +1,20 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "IPAddress.h"
+
+// the captive portal DNS of the soft AP, the host has no clients asking it
+class DNSServer {
+public:
+	bool start(uint16_t port, const String& domain, const IPAddress& ip);
+	void stop();
+	void processNextRequest();
+	void setTTL(uint32_t ttl);
+};
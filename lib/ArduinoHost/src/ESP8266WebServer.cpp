@@ -0,0 +1,319 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include "ESP8266WebServer.h"
+
+static const String empty_string;
+
+// never freed, the static servers are closed after the other globals are gone
+static std::vector<ESP8266WebServer*>& started_servers = *new std::vector<ESP8266WebServer*>;
+
+ESP8266WebServer::ESP8266WebServer(int port) {
+	this->port = port;
+	begin_flag = false;
+	request_method = HTTP_GET;
+	response_code = 0;
+	response_bytes = 0;
+	keep_body_flag = false;
+
+	current_upload.status = UPLOAD_FILE_ABORTED;
+	current_upload.totalSize = 0;
+	current_upload.currentSize = 0;
+	current_upload.contentLength = 0;
+}
+
+ESP8266WebServer::~ESP8266WebServer() {
+	close();
+}
+
+
+void ESP8266WebServer::begin() {
+	if (!begin_flag) {
+		started_servers.push_back(this);
+	}
+
+	begin_flag = true;
+}
+
+void ESP8266WebServer::begin(uint16_t port) {
+	this->port = port;
+	begin();
+}
+
+void ESP8266WebServer::stop() {
+	close();
+}
+
+void ESP8266WebServer::close() {
+	for (uint8_t i = 0;i < started_servers.size();i++) {
+		if (started_servers[i] == this) {
+			started_servers.erase(started_servers.begin() + i);
+			break;
+		}
+	}
+
+	begin_flag = false;
+}
+
+// the requests come from hostRequest(), nothing waits here
+void ESP8266WebServer::handleClient() {
+}
+
+
+void ESP8266WebServer::on(const String& uri, THandlerFunction handler) {
+	on(uri, HTTP_ANY, handler);
+}
+
+void ESP8266WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) {
+	routes.push_back({uri, method, handler});
+}
+
+void ESP8266WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction upload_handler) {
+	on(uri, method, handler);
+}
+
+void ESP8266WebServer::onNotFound(THandlerFunction handler) {
+	not_found_handler = handler;
+}
+
+
+const String& ESP8266WebServer::uri() const {
+	return request_uri;
+}
+
+HTTPMethod ESP8266WebServer::method() const {
+	return request_method;
+}
+
+WiFiClient& ESP8266WebServer::client() {
+	return current_client;
+}
+
+HTTPUpload& ESP8266WebServer::upload() {
+	return current_upload;
+}
+
+
+const String& ESP8266WebServer::arg(int index) const {
+	return (index >= 0 && index < (int) request_args.size()) ? request_args[index].value : empty_string;
+}
+
+const String& ESP8266WebServer::arg(const String& name) const {
+	for (uint8_t i = 0;i < request_args.size();i++) {
+		if (request_args[i].name == name) {
+			return request_args[i].value;
+		}
+	}
+
+	return empty_string;
+}
+
+const String& ESP8266WebServer::argName(int index) const {
+	return (index >= 0 && index < (int) request_args.size()) ? request_args[index].name : empty_string;
+}
+
+int ESP8266WebServer::args() const {
+	return request_args.size();
+}
+
+bool ESP8266WebServer::hasArg(const String& name) const {
+	for (uint8_t i = 0;i < request_args.size();i++) {
+		if (request_args[i].name == name) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+void ESP8266WebServer::collectHeaders(const char* header_keys[], size_t count) {
+	collected_headers.clear();
+
+	for (size_t i = 0;i < count;i++) {
+		collected_headers.push_back(String(header_keys[i]));
+	}
+}
+
+const String& ESP8266WebServer::header(const String& name) const {
+	for (uint8_t i = 0;i < request_headers.size();i++) {
+		if (request_headers[i].name.equalsIgnoreCase(name)) {
+			return request_headers[i].value;
+		}
+	}
+
+	return empty_string;
+}
+
+bool ESP8266WebServer::hasHeader(const String& name) const {
+	return header(name).length() > 0;
+}
+
+
+// the host has no login, every request is let in
+bool ESP8266WebServer::authenticate(const char* login, const char* pass) {
+	return true;
+}
+
+void ESP8266WebServer::requestAuthentication() {
+	send(401);
+}
+
+
+void ESP8266WebServer::send(int code, const char* content_type, const String& content) {
+	response_code = code;
+	addBody(content.c_str(), content.length());
+}
+
+void ESP8266WebServer::send(int code, const String& content_type, const String& content) {
+	send(code, content_type.c_str(), content);
+}
+
+void ESP8266WebServer::send_P(int code, PGM_P content_type, PGM_P content) {
+	send_P(code, content_type, content, strlen_P(content));
+}
+
+void ESP8266WebServer::send_P(int code, PGM_P content_type, PGM_P content, size_t size) {
+	response_code = code;
+	addBody(content, size);
+}
+
+void ESP8266WebServer::sendHeader(const String& name, const String& value, bool first_flag) {
+}
+
+void ESP8266WebServer::setContentLength(size_t size) {
+}
+
+void ESP8266WebServer::sendContent(const String& content) {
+	addBody(content.c_str(), content.length());
+}
+
+void ESP8266WebServer::sendContent(const char* content) {
+	addBody(content, strlen(content));
+}
+
+void ESP8266WebServer::sendContent(const char* content, size_t size) {
+	addBody(content, size);
+}
+
+void ESP8266WebServer::sendContent_P(PGM_P content) {
+	addBody(content, strlen_P(content));
+}
+
+void ESP8266WebServer::sendContent_P(PGM_P content, size_t size) {
+	addBody(content, size);
+}
+
+
+int ESP8266WebServer::hostRequest(const String& uri, const String& query, HTTPMethod method) {
+	request_uri = uri;
+	request_method = method;
+	request_args.clear();
+
+	response_code = 0;
+	response_bytes = 0;
+	response_body.clear();
+
+	for (int begin = 0;begin < (int) query.length();) {
+		int end = query.indexOf('&', begin);
+
+		if (end < 0) {
+			end = query.length();
+		}
+
+		String pair = query.substring(begin, end);
+		int equal = pair.indexOf('=');
+
+		if (equal < 0) {
+			request_args.push_back({decode(pair), String()});
+		}
+		else {
+			request_args.push_back({decode(pair.substring(0, equal)), decode(pair.substring(equal + 1))});
+		}
+
+		begin = end + 1;
+	}
+
+	if (begin_flag) {
+		bool found_flag = false;
+
+		for (uint8_t i = 0;i < routes.size() && !found_flag;i++) {
+			if (routes[i].uri == uri && (routes[i].method == HTTP_ANY || routes[i].method == method)) {
+				routes[i].handler();
+				found_flag = true;
+			}
+		}
+
+		if (!found_flag && not_found_handler) {
+			not_found_handler();
+		}
+	}
+
+	request_headers.clear();
+	return response_code;
+}
+
+ESP8266WebServer* ESP8266WebServer::hostFind(uint16_t port) {
+	for (uint8_t i = 0;i < started_servers.size();i++) {
+		if (started_servers[i]->port == port) {
+			return started_servers[i];
+		}
+	}
+
+	return NULL;
+}
+
+void ESP8266WebServer::hostSetHeader(const String& name, const String& value) {
+	request_headers.push_back({name, value});
+}
+
+void ESP8266WebServer::hostKeepBody(bool keep_flag) {
+	keep_body_flag = keep_flag;
+}
+
+int ESP8266WebServer::hostCode() const {
+	return response_code;
+}
+
+size_t ESP8266WebServer::hostBytes() const {
+	return response_bytes;
+}
+
+const String& ESP8266WebServer::hostBody() const {
+	return response_body;
+}
+
+
+void ESP8266WebServer::addBody(const char* content, size_t size) {
+	response_bytes += size;
+
+	if (keep_body_flag) {
+		response_body.concat(content, size);
+	}
+}
+
+String ESP8266WebServer::decode(const String& text) {
+	String result;
+
+	for (unsigned int i = 0;i < text.length();i++) {
+		if (text[i] == '%' && i + 2 < text.length()) {
+			char hex[3] = {text[i + 1], text[i + 2], '\0'};
+
+			result += (char) strtol(hex, NULL, 16);
+			i += 2;
+		}
+		else {
+			result += (text[i] == '+') ? ' ' : text[i];
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,148 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <functional>
+#include <vector>
+#include "ESP8266WiFi.h"
+#include "Updater.h"
+
+/*
+ * The web server of the host. hostRequest() hands one request to the
+ * handlers, as handleClient() does for a browser on the board. The answer
+ * is counted, its body is kept only after hostKeepBody(true). A started
+ * server is found by its port with hostFind(), like a browser finds it.
+ */
+
+/* --- Macroces --- */
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+/* --- Structures --- */
+enum HTTPMethod {
+	HTTP_ANY,
+	HTTP_GET,
+	HTTP_HEAD,
+	HTTP_POST,
+	HTTP_PUT,
+	HTTP_PATCH,
+	HTTP_DELETE,
+	HTTP_OPTIONS,
+};
+
+enum HTTPUploadStatus {
+	UPLOAD_FILE_START,
+	UPLOAD_FILE_WRITE,
+	UPLOAD_FILE_END,
+	UPLOAD_FILE_ABORTED,
+};
+
+#define HTTP_UPLOAD_BUFLEN 2048
+
+struct HTTPUpload {
+	HTTPUploadStatus status;
+	String filename;
+	String name;
+	String type;
+	size_t totalSize;
+	size_t currentSize;
+	size_t contentLength;
+	uint8_t buf[HTTP_UPLOAD_BUFLEN];
+};
+
+struct web_host_pair_t {
+	String name;
+	String value;
+};
+
+struct web_host_route_t {
+	String uri;
+	HTTPMethod method;
+	std::function<void(void)> handler;
+};
+
+class ESP8266WebServer {
+public:
+	typedef std::function<void(void)> THandlerFunction;
+
+	ESP8266WebServer(int port = 80);
+	~ESP8266WebServer();
+
+	void begin();
+	void begin(uint16_t port);
+	void stop();
+	void close();
+	void handleClient();
+
+	void on(const String& uri, THandlerFunction handler);
+	void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+	void on(const String& uri, HTTPMethod method, THandlerFunction handler, THandlerFunction upload_handler);
+	void onNotFound(THandlerFunction handler);
+
+	const String& uri() const;
+	HTTPMethod method() const;
+	WiFiClient& client();
+	HTTPUpload& upload(); // the host sends no files, it stays empty
+
+	const String& arg(int index) const;
+	const String& arg(const String& name) const;
+	const String& argName(int index) const;
+	int args() const;
+	bool hasArg(const String& name) const;
+
+	void collectHeaders(const char* header_keys[], size_t count);
+	const String& header(const String& name) const;
+	bool hasHeader(const String& name) const;
+
+	bool authenticate(const char* login, const char* pass);
+	void requestAuthentication();
+
+	void send(int code, const char* content_type = NULL, const String& content = String());
+	void send(int code, const String& content_type, const String& content);
+	void send_P(int code, PGM_P content_type, PGM_P content);
+	void send_P(int code, PGM_P content_type, PGM_P content, size_t size);
+	void sendHeader(const String& name, const String& value, bool first_flag = false);
+	void setContentLength(size_t size);
+	void sendContent(const String& content);
+	void sendContent(const char* content);
+	void sendContent(const char* content, size_t size);
+	void sendContent_P(PGM_P content);
+	void sendContent_P(PGM_P content, size_t size);
+
+	// the host side, query is "name=value&name=value"
+	int hostRequest(const String& uri, const String& query = String(), HTTPMethod method = HTTP_GET);
+	void hostSetHeader(const String& name, const String& value);
+	void hostKeepBody(bool keep_flag);
+	int hostCode() const;
+	size_t hostBytes() const; // of the body
+	const String& hostBody() const;
+	static ESP8266WebServer* hostFind(uint16_t port);
+
+private:
+	void addBody(const char* content, size_t size);
+	static String decode(const String& text);
+
+	std::vector<web_host_route_t> routes;
+	THandlerFunction not_found_handler;
+	WiFiClient current_client;
+	HTTPUpload current_upload;
+	uint16_t port;
+	bool begin_flag;
+
+	String request_uri;
+	HTTPMethod request_method;
+	std::vector<web_host_pair_t> request_args;
+	std::vector<web_host_pair_t> request_headers;
+	std::vector<String> collected_headers;
+
+	int response_code;
+	size_t response_bytes;
+	bool keep_body_flag;
+	String response_body;
+};
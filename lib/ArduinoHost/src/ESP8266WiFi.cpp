@@ -0,0 +1,393 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <string.h>
+#include "ESP8266WiFi.h"
+
+ESP8266WiFiClass WiFi;
+
+// the TCP servers the clients reach, kept to the end for the static clients
+static std::vector<wifi_client_host_peer_t>& peers = *new std::vector<wifi_client_host_peer_t>;
+static uint32_t connect_count = 0;
+
+// what the DHCP of the host network hands out
+static const IPAddress dhcp_config[4] = {
+	IPAddress(192, 168, 1, 50),
+	IPAddress(192, 168, 1, 1),
+	IPAddress(255, 255, 255, 0),
+	IPAddress(192, 168, 1, 1),
+};
+
+ESP8266WiFiClass::ESP8266WiFiClass() {
+	wifi_mode = WIFI_OFF;
+	wifi_status = WL_DISCONNECTED;
+	*ssid = '\0';
+	*network_ssid = '\0';
+	*network_pass = '\0';
+	network_rssi = 0;
+
+	const uint8_t host_bssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+	memcpy(bssid, host_bssid, sizeof(bssid));
+}
+
+
+bool ESP8266WiFiClass::mode(WiFiMode_t mode) {
+	if (!(mode & WIFI_STA) && wifi_status == WL_CONNECTED) {
+		disconnected(WIFI_DISCONNECT_REASON_ASSOC_LEAVE);
+	}
+
+	wifi_mode = mode;
+	return true;
+}
+
+WiFiMode_t ESP8266WiFiClass::getMode() {
+	return wifi_mode;
+}
+
+wl_status_t ESP8266WiFiClass::status() {
+	return wifi_status;
+}
+
+
+wl_status_t ESP8266WiFiClass::begin(const char* ssid, const char* pass, int32_t channel, const uint8_t* bssid, bool connect_flag) {
+	if (!(wifi_mode & WIFI_STA)) {
+		wifi_mode = (WiFiMode_t) (wifi_mode | WIFI_STA);
+	}
+
+	strncpy(this->ssid, ssid ? ssid : "", WIFI_HOST_SSID_SIZE - 1);
+	this->ssid[WIFI_HOST_SSID_SIZE - 1] = '\0';
+
+	if (!connect_flag) {
+		return wifi_status;
+	}
+
+	if (!*network_ssid || strcmp(this->ssid, network_ssid)) {
+		wifi_status = WL_NO_SSID_AVAIL;
+		disconnected(WIFI_DISCONNECT_REASON_NO_AP_FOUND);
+	}
+	else if (strcmp(pass ? pass : "", network_pass)) {
+		wifi_status = WL_WRONG_PASSWORD;
+		disconnected(WIFI_DISCONNECT_REASON_AUTH_FAIL);
+	}
+	else {
+		wifi_status = WL_CONNECTED;
+		gotIp();
+	}
+
+	return wifi_status;
+}
+
+bool ESP8266WiFiClass::config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+	ip_config[0] = ip;
+	ip_config[1] = gateway;
+	ip_config[2] = subnet;
+	ip_config[3] = dns1.isSet() ? dns1 : gateway;
+
+	return true;
+}
+
+bool ESP8266WiFiClass::disconnect(bool wifi_off_flag) {
+	if (wifi_status == WL_CONNECTED) {
+		disconnected(WIFI_DISCONNECT_REASON_ASSOC_LEAVE);
+	}
+
+	wifi_status = WL_DISCONNECTED;
+	*ssid = '\0';
+
+	if (wifi_off_flag) {
+		wifi_mode = WIFI_OFF;
+	}
+
+	return true;
+}
+
+
+bool ESP8266WiFiClass::softAP(const char* ssid, const char* pass, int channel, int hidden, int max_connection) {
+	wifi_mode = (WiFiMode_t) (wifi_mode | WIFI_AP);
+	return true;
+}
+
+IPAddress ESP8266WiFiClass::softAPIP() {
+	return (wifi_mode & WIFI_AP) ? IPAddress(192, 168, 4, 1) : IPAddress();
+}
+
+uint8_t ESP8266WiFiClass::softAPgetStationNum() {
+	return 0;
+}
+
+
+int8_t ESP8266WiFiClass::scanNetworks(bool async_flag, bool show_hidden_flag) {
+	return *network_ssid ? 1 : 0;
+}
+
+String ESP8266WiFiClass::SSID() const {
+	return (wifi_status == WL_CONNECTED) ? String(ssid) : String();
+}
+
+String ESP8266WiFiClass::SSID(uint8_t index) {
+	return (!index && *network_ssid) ? String(network_ssid) : String();
+}
+
+int32_t ESP8266WiFiClass::RSSI() {
+	return (wifi_status == WL_CONNECTED) ? network_rssi : 31;
+}
+
+int32_t ESP8266WiFiClass::RSSI(uint8_t index) {
+	return (!index && *network_ssid) ? network_rssi : 0;
+}
+
+uint8_t* ESP8266WiFiClass::BSSID() {
+	return bssid;
+}
+
+int32_t ESP8266WiFiClass::channel() {
+	return 6;
+}
+
+int32_t ESP8266WiFiClass::channel(uint8_t index) {
+	return 6;
+}
+
+IPAddress ESP8266WiFiClass::localIP() {
+	if (wifi_status != WL_CONNECTED) {
+		return IPAddress();
+	}
+
+	return ip_config[0].isSet() ? ip_config[0] : dhcp_config[0];
+}
+
+IPAddress ESP8266WiFiClass::gatewayIP() {
+	if (wifi_status != WL_CONNECTED) {
+		return IPAddress();
+	}
+
+	return ip_config[0].isSet() ? ip_config[1] : dhcp_config[1];
+}
+
+IPAddress ESP8266WiFiClass::subnetMask() {
+	if (wifi_status != WL_CONNECTED) {
+		return IPAddress();
+	}
+
+	return ip_config[0].isSet() ? ip_config[2] : dhcp_config[2];
+}
+
+IPAddress ESP8266WiFiClass::dnsIP(uint8_t index) {
+	if (wifi_status != WL_CONNECTED || index) {
+		return IPAddress();
+	}
+
+	return ip_config[0].isSet() ? ip_config[3] : dhcp_config[3];
+}
+
+String ESP8266WiFiClass::macAddress() {
+	return "5C:CF:7F:00:00:01";
+}
+
+// the host resolves nothing, the stand-in servers are reached by address
+int ESP8266WiFiClass::hostByName(const char* host, IPAddress& ip) {
+	return ip.fromString(host) ? 1 : 0;
+}
+
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> handler) {
+	WiFiEventHandler result = std::make_shared<WiFiEventHandlerOpaque>();
+
+	result->got_ip = handler;
+	handlers.push_back(result);
+
+	return result;
+}
+
+WiFiEventHandler ESP8266WiFiClass::onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> handler) {
+	WiFiEventHandler result = std::make_shared<WiFiEventHandlerOpaque>();
+
+	result->disconnected = handler;
+	handlers.push_back(result);
+
+	return result;
+}
+
+
+void ESP8266WiFiClass::hostSetNetwork(const char* ssid, const char* pass, int32_t rssi) {
+	strncpy(network_ssid, ssid ? ssid : "", WIFI_HOST_SSID_SIZE - 1);
+	network_ssid[WIFI_HOST_SSID_SIZE - 1] = '\0';
+	strncpy(network_pass, pass ? pass : "", WIFI_HOST_PASS_SIZE - 1);
+	network_pass[WIFI_HOST_PASS_SIZE - 1] = '\0';
+	network_rssi = rssi;
+}
+
+void ESP8266WiFiClass::hostLinkLost() {
+	if (wifi_status != WL_CONNECTED) {
+		return;
+	}
+
+	wifi_status = WL_CONNECTION_LOST;
+	disconnected(WIFI_DISCONNECT_REASON_BEACON_TIMEOUT);
+}
+
+
+void ESP8266WiFiClass::gotIp() {
+	WiFiEventStationModeGotIP event = {localIP(), subnetMask(), gatewayIP()};
+
+	for (uint8_t i = 0;i < handlers.size();i++) {
+		WiFiEventHandler handler = handlers[i].lock();
+
+		if (handler && handler->got_ip) {
+			handler->got_ip(event);
+		}
+	}
+}
+
+void ESP8266WiFiClass::disconnected(WiFiDisconnectReason reason) {
+	WiFiEventStationModeDisconnected event;
+
+	event.ssid = ssid;
+	memcpy(event.bssid, bssid, sizeof(event.bssid));
+	event.reason = reason;
+
+	for (uint8_t i = 0;i < handlers.size();i++) {
+		WiFiEventHandler handler = handlers[i].lock();
+
+		if (handler && handler->disconnected) {
+			handler->disconnected(event);
+		}
+	}
+}
+
+
+WiFiClient::WiFiClient() {
+	connected_flag = false;
+	remote_port = 0;
+	rx_position = 0;
+	tx_bytes = 0;
+}
+
+
+int WiFiClient::connect(IPAddress ip, uint16_t port) {
+	stop();
+	connect_count++;
+
+	for (uint8_t i = 0;i < peers.size();i++) {
+		if ((uint32_t) peers[i].ip == (uint32_t) ip && peers[i].port == port) {
+			connected_flag = true;
+			remote_ip = ip;
+			remote_port = port;
+			rx_data = peers[i].answer;
+
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+int WiFiClient::connect(const char* host, uint16_t port) {
+	IPAddress ip;
+
+	if (!WiFi.hostByName(host, ip)) {
+		stop();
+		connect_count++;
+
+		return 0;
+	}
+
+	return connect(ip, port);
+}
+
+size_t WiFiClient::write(uint8_t c) {
+	return write(&c, 1);
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+	if (!connected_flag) {
+		return 0;
+	}
+
+	tx_bytes += size;
+	return size;
+}
+
+int WiFiClient::available() {
+	return rx_data.size() - rx_position;
+}
+
+int WiFiClient::read() {
+	return (rx_position < rx_data.size()) ? rx_data[rx_position++] : -1;
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+	if (!available()) {
+		return -1;
+	}
+
+	size = min(size, (size_t) available());
+
+	memcpy(buffer, rx_data.data() + rx_position, size);
+	rx_position += size;
+
+	return size;
+}
+
+int WiFiClient::peek() {
+	return (rx_position < rx_data.size()) ? rx_data[rx_position] : -1;
+}
+
+void WiFiClient::flush() {
+}
+
+void WiFiClient::stop() {
+	connected_flag = false;
+	rx_data.clear();
+	rx_position = 0;
+	tx_bytes = 0;
+}
+
+uint8_t WiFiClient::connected() {
+	return connected_flag;
+}
+
+WiFiClient::operator bool() {
+	return connected();
+}
+
+void WiFiClient::setNoDelay(bool no_delay_flag) {
+}
+
+IPAddress WiFiClient::remoteIP() {
+	return remote_ip;
+}
+
+uint16_t WiFiClient::remotePort() {
+	return remote_port;
+}
+
+
+void WiFiClient::hostListen(IPAddress ip, uint16_t port, const uint8_t* answer, size_t size) {
+	wifi_client_host_peer_t peer = {ip, port, std::vector<uint8_t>()};
+
+	if (answer != NULL) {
+		peer.answer.assign(answer, answer + size);
+	}
+
+	peers.push_back(peer);
+}
+
+void WiFiClient::hostClear() {
+	peers.clear();
+	connect_count = 0;
+}
+
+uint32_t WiFiClient::hostConnectCount() {
+	return connect_count;
+}
+
+size_t WiFiClient::hostBytes() const {
+	return tx_bytes;
+}
@@ -0,0 +1,174 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <functional>
+#include <memory>
+#include <vector>
+#include <Arduino.h>
+#include "Client.h"
+
+/*
+ * WiFi of the host. There is one station network, set with hostSetNetwork(),
+ * begin() joins it at once and the events run inside begin() and
+ * disconnect(). The soft AP has no clients.
+ */
+
+/* --- Macroces --- */
+#define WIFI_HOST_SSID_SIZE 33
+#define WIFI_HOST_PASS_SIZE 65
+
+/* --- Structures --- */
+// a TCP server of the host network, it accepts every connect and answers at once
+struct wifi_client_host_peer_t {
+	IPAddress ip;
+	uint16_t port;
+	std::vector<uint8_t> answer;
+};
+
+enum wl_status_t {
+	WL_NO_SHIELD = 255,
+	WL_IDLE_STATUS = 0,
+	WL_NO_SSID_AVAIL = 1,
+	WL_SCAN_COMPLETED = 2,
+	WL_CONNECTED = 3,
+	WL_CONNECT_FAILED = 4,
+	WL_CONNECTION_LOST = 5,
+	WL_WRONG_PASSWORD = 6,
+	WL_DISCONNECTED = 7,
+};
+
+enum WiFiMode_t {
+	WIFI_OFF = 0,
+	WIFI_STA = 1,
+	WIFI_AP = 2,
+	WIFI_AP_STA = 3,
+};
+
+enum WiFiDisconnectReason {
+	WIFI_DISCONNECT_REASON_UNSPECIFIED = 1,
+	WIFI_DISCONNECT_REASON_ASSOC_LEAVE = 8,
+	WIFI_DISCONNECT_REASON_BEACON_TIMEOUT = 200,
+	WIFI_DISCONNECT_REASON_NO_AP_FOUND = 201,
+	WIFI_DISCONNECT_REASON_AUTH_FAIL = 202,
+};
+
+struct WiFiEventStationModeGotIP {
+	IPAddress ip;
+	IPAddress mask;
+	IPAddress gw;
+};
+
+struct WiFiEventStationModeDisconnected {
+	String ssid;
+	uint8_t bssid[6];
+	WiFiDisconnectReason reason;
+};
+
+struct WiFiEventHandlerOpaque {
+	std::function<void(const WiFiEventStationModeGotIP&)> got_ip;
+	std::function<void(const WiFiEventStationModeDisconnected&)> disconnected;
+};
+
+// the event is called while the handler object is kept
+typedef std::shared_ptr<WiFiEventHandlerOpaque> WiFiEventHandler;
+
+class ESP8266WiFiClass {
+public:
+	ESP8266WiFiClass();
+
+	bool mode(WiFiMode_t mode);
+	WiFiMode_t getMode();
+	wl_status_t status();
+
+	wl_status_t begin(const char* ssid, const char* pass = NULL, int32_t channel = 0, const uint8_t* bssid = NULL, bool connect_flag = true);
+	bool config(IPAddress ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+	bool disconnect(bool wifi_off_flag = false);
+
+	bool softAP(const char* ssid, const char* pass = NULL, int channel = 1, int hidden = 0, int max_connection = 4);
+	IPAddress softAPIP();
+	uint8_t softAPgetStationNum();
+
+	int8_t scanNetworks(bool async_flag = false, bool show_hidden_flag = false);
+	String SSID() const;
+	String SSID(uint8_t index);
+	int32_t RSSI();
+	int32_t RSSI(uint8_t index);
+	uint8_t* BSSID();
+	int32_t channel();
+	int32_t channel(uint8_t index);
+	IPAddress localIP();
+	IPAddress gatewayIP();
+	IPAddress subnetMask();
+	IPAddress dnsIP(uint8_t index = 0);
+	String macAddress();
+	int hostByName(const char* host, IPAddress& ip);
+
+	WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> handler);
+	WiFiEventHandler onStationModeDisconnected(std::function<void(const WiFiEventStationModeDisconnected&)> handler);
+
+	// the host side, the network the station can join
+	void hostSetNetwork(const char* ssid, const char* pass, int32_t rssi = -60);
+	void hostLinkLost();
+
+private:
+	void gotIp();
+	void disconnected(WiFiDisconnectReason reason);
+
+	WiFiMode_t wifi_mode;
+	wl_status_t wifi_status;
+	char ssid[WIFI_HOST_SSID_SIZE];
+	char network_ssid[WIFI_HOST_SSID_SIZE];
+	char network_pass[WIFI_HOST_PASS_SIZE];
+	int32_t network_rssi;
+	uint8_t bssid[6];
+	IPAddress ip_config[4]; // ip, gateway, subnet, dns; 0 is DHCP
+	std::vector<std::weak_ptr<WiFiEventHandlerOpaque>> handlers;
+};
+
+// a TCP client of the host, it reaches the peers set with hostListen(), a connect() to any other is refused
+class WiFiClient : public Client {
+public:
+	WiFiClient();
+
+	int connect(IPAddress ip, uint16_t port) override;
+	int connect(const char* host, uint16_t port) override;
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	int available() override;
+	int read() override;
+	int read(uint8_t* buffer, size_t size) override;
+	int peek() override;
+	void flush() override;
+	void stop() override;
+	uint8_t connected() override;
+	operator bool() override;
+
+	void setNoDelay(bool no_delay_flag);
+	IPAddress remoteIP();
+	uint16_t remotePort();
+
+	// the host side; the connects are counted with the refused ones
+	static void hostListen(IPAddress ip, uint16_t port, const uint8_t* answer = NULL, size_t size = 0);
+	static void hostClear();
+	static uint32_t hostConnectCount();
+	size_t hostBytes() const; // written since the connect
+
+	using Print::write;
+
+private:
+	bool connected_flag;
+	IPAddress remote_ip;
+	uint16_t remote_port;
+	std::vector<uint8_t> rx_data;
+	size_t rx_position;
+	size_t tx_bytes;
+};
+
+extern ESP8266WiFiClass WiFi;
@@ -0,0 +1,31 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "ESP8266mDNS.h"
+
+MDNSResponder MDNS;
+
+bool MDNSResponder::begin(const char* hostname) {
+	return true;
+}
+
+bool MDNSResponder::begin(const String& hostname) {
+	return true;
+}
+
+void MDNSResponder::end() {
+}
+
+bool MDNSResponder::addService(const char* service, const char* protocol, uint16_t port) {
+	return true;
+}
+
+bool MDNSResponder::update() {
+	return true;
+}
@@ -0,0 +1,23 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "WString.h"
+
+// mDNS of the host, the name is kept and nobody asks for it
+class MDNSResponder {
+public:
+	bool begin(const char* hostname);
+	bool begin(const String& hostname);
+	void end();
+	bool addService(const char* service, const char* protocol, uint16_t port);
+	bool update();
+};
+
+extern MDNSResponder MDNS;
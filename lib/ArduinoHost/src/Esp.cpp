@@ -0,0 +1,76 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "Esp.h"
+
+EspClass ESP;
+
+// a reset ends the host program, the tests and the benchmarks do not press the restart button
+void EspClass::reset() {
+	restart();
+}
+
+void EspClass::restart() {
+	fflush(stdout);
+	exit(0);
+}
+
+
+// the host heap has no fixed size, the managers only show these numbers
+uint32_t EspClass::getFreeHeap() {
+	return 0;
+}
+
+uint8_t EspClass::getHeapFragmentation() {
+	return 0;
+}
+
+uint32_t EspClass::getChipId() {
+	return 0;
+}
+
+// eagle.flash.4m2m.ld, 4 MB with 2 MB of file system
+uint32_t EspClass::getFlashChipSize() {
+	return 4194304;
+}
+
+uint32_t EspClass::getFlashChipRealSize() {
+	return 4194304;
+}
+
+uint32_t EspClass::getFreeSketchSpace() {
+	return 0;
+}
+
+uint32_t EspClass::getSketchSize() {
+	return 0;
+}
+
+// the board runs at 160 MHz, the host counts its cycles from the monotonic clock
+uint32_t EspClass::getCycleCount() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 160000000UL + now.tv_nsec * 4 / 25;
+}
+
+uint8_t EspClass::getCpuFreqMHz() {
+	return 160;
+}
+
+const char* EspClass::getSdkVersion() {
+	return "host";
+}
+
+String EspClass::getCoreVersion() {
+	return "host";
+}
@@ -0,0 +1,33 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include "WString.h"
+
+// the chip functions the network and UI managers and their libraries call
+class EspClass {
+public:
+	void reset() __attribute__((noreturn));
+	void restart() __attribute__((noreturn));
+
+	uint32_t getFreeHeap();
+	uint8_t getHeapFragmentation();
+	uint32_t getChipId();
+	uint32_t getFlashChipSize();
+	uint32_t getFlashChipRealSize();
+	uint32_t getFreeSketchSpace();
+	uint32_t getSketchSize();
+	uint32_t getCycleCount();
+	uint8_t getCpuFreqMHz();
+	const char* getSdkVersion();
+	String getCoreVersion();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,322 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <string.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "FS.h"
+#include "LittleFS.h"
+
+fs::FS LittleFS;
+
+namespace fs {
+
+static String makePath(const char* path) {
+	String result(FS_HOST_ROOT);
+
+	if (path == NULL || *path != '/') {
+		result += '/';
+	}
+	if (path != NULL) {
+		result += path;
+	}
+
+	return result;
+}
+
+// LittleFS makes the directories of a new file itself
+static void makeParents(const String& path) {
+	for (int i = path.indexOf('/', strlen(FS_HOST_ROOT) + 1);i >= 0;i = path.indexOf('/', i + 1)) {
+		::mkdir(path.substring(0, i).c_str(), 0755);
+	}
+}
+
+static size_t usedBytes(const String& path) {
+	DIR* dir = opendir(path.c_str());
+	size_t result = 0;
+
+	if (dir == NULL) {
+		return 0;
+	}
+
+	for (dirent* entry = readdir(dir);entry != NULL;entry = readdir(dir)) {
+		String entry_path = path + "/" + entry->d_name;
+		struct stat status;
+
+		if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..") || stat(entry_path.c_str(), &status)) {
+			continue;
+		}
+
+		result += S_ISDIR(status.st_mode) ? usedBytes(entry_path) : status.st_size;
+	}
+
+	closedir(dir);
+	return result;
+}
+
+
+/* --- File --- */
+File::File() {
+}
+
+File::File(FILE* file, const char* path) : file(file, fclose), path(path) {
+}
+
+size_t File::write(uint8_t c) {
+	return write(&c, 1);
+}
+
+size_t File::write(const uint8_t* buffer, size_t size) {
+	return file ? fwrite(buffer, 1, size, file.get()) : 0;
+}
+
+int File::available() {
+	return file ? size() - position() : 0;
+}
+
+int File::read() {
+	return file ? fgetc(file.get()) : -1;
+}
+
+int File::peek() {
+	if (!file) {
+		return -1;
+	}
+
+	int c = fgetc(file.get());
+
+	if (c != EOF) {
+		ungetc(c, file.get());
+	}
+
+	return c;
+}
+
+void File::flush() {
+	if (file) {
+		fflush(file.get());
+	}
+}
+
+size_t File::read(uint8_t* buffer, size_t size) {
+	return file ? fread(buffer, 1, size, file.get()) : 0;
+}
+
+bool File::seek(uint32_t position, SeekMode mode) {
+	int whence = (mode == SeekCur) ? SEEK_CUR : ((mode == SeekEnd) ? SEEK_END : SEEK_SET);
+
+	return file && !fseek(file.get(), position, whence);
+}
+
+size_t File::position() const {
+	return file ? ftell(file.get()) : 0;
+}
+
+size_t File::size() const {
+	struct stat status;
+
+	if (!file || fstat(fileno(file.get()), &status)) {
+		return 0;
+	}
+
+	return status.st_size;
+}
+
+void File::close() {
+	file.reset();
+}
+
+const char* File::name() const {
+	int index = path.lastIndexOf('/');
+
+	return path.c_str() + index + 1;
+}
+
+const char* File::fullName() const {
+	return path.c_str();
+}
+
+bool File::isFile() const {
+	return (bool) file;
+}
+
+bool File::isDirectory() const {
+	return false;
+}
+
+File::operator bool() const {
+	return (bool) file;
+}
+
+
+/* --- Dir --- */
+Dir::Dir() : index(-1) {
+}
+
+Dir::Dir(const String& path, const std::vector<dir_entry_t>& entries) : path(path), entries(entries), index(-1) {
+}
+
+bool Dir::next() {
+	if (index + 1 >= (int) entries.size()) {
+		return false;
+	}
+
+	index++;
+	return true;
+}
+
+bool Dir::rewind() {
+	index = -1;
+	return true;
+}
+
+String Dir::fileName() {
+	return (index >= 0) ? entries[index].name : String();
+}
+
+size_t Dir::fileSize() {
+	return (index >= 0) ? entries[index].size : 0;
+}
+
+bool Dir::isFile() {
+	return index >= 0 && !entries[index].directory_flag;
+}
+
+bool Dir::isDirectory() {
+	return index >= 0 && entries[index].directory_flag;
+}
+
+File Dir::openFile(const char* mode) {
+	if (!isFile()) {
+		return File();
+	}
+
+	return LittleFS.open(path + "/" + entries[index].name, mode);
+}
+
+
+/* --- FS --- */
+bool FS::begin() {
+	::mkdir(FS_HOST_ROOT, 0755);
+	return true;
+}
+
+void FS::end() {
+}
+
+bool FS::format() {
+	return false;
+}
+
+bool FS::info(FSInfo& info) {
+	info.totalBytes = FS_HOST_SIZE;
+	info.usedBytes = usedBytes(FS_HOST_ROOT);
+	info.blockSize = 8192;
+	info.pageSize = 256;
+	info.maxOpenFiles = 5;
+	info.maxPathLength = 32;
+
+	return true;
+}
+
+File FS::open(const char* path, const char* mode) {
+	String host_path = makePath(path);
+
+	if (*mode != 'r') {
+		makeParents(host_path);
+	}
+
+	// b keeps the bytes as they are, mode is "r", "w", "a" or with "+"
+	String host_mode(mode);
+	host_mode += 'b';
+
+	FILE* file = fopen(host_path.c_str(), host_mode.c_str());
+
+	return file ? File(file, path) : File();
+}
+
+File FS::open(const String& path, const char* mode) {
+	return open(path.c_str(), mode);
+}
+
+Dir FS::openDir(const char* path) {
+	String host_path = makePath(path);
+	std::vector<dir_entry_t> entries;
+	DIR* dir = opendir(host_path.c_str());
+
+	if (dir == NULL) {
+		return Dir(path, entries);
+	}
+
+	for (dirent* entry = readdir(dir);entry != NULL;entry = readdir(dir)) {
+		String entry_path = host_path + "/" + entry->d_name;
+		struct stat status;
+
+		if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..") || stat(entry_path.c_str(), &status)) {
+			continue;
+		}
+
+		entries.push_back({String(entry->d_name), (size_t) status.st_size, S_ISDIR(status.st_mode)});
+	}
+
+	closedir(dir);
+	return Dir(path, entries);
+}
+
+Dir FS::openDir(const String& path) {
+	return openDir(path.c_str());
+}
+
+bool FS::exists(const char* path) {
+	struct stat status;
+
+	return !stat(makePath(path).c_str(), &status);
+}
+
+bool FS::exists(const String& path) {
+	return exists(path.c_str());
+}
+
+bool FS::remove(const char* path) {
+	return !::remove(makePath(path).c_str());
+}
+
+bool FS::remove(const String& path) {
+	return remove(path.c_str());
+}
+
+bool FS::rename(const char* from, const char* to) {
+	String host_to = makePath(to);
+
+	makeParents(host_to);
+	return !::rename(makePath(from).c_str(), host_to.c_str());
+}
+
+bool FS::rename(const String& from, const String& to) {
+	return rename(from.c_str(), to.c_str());
+}
+
+bool FS::mkdir(const char* path) {
+	return !::mkdir(makePath(path).c_str(), 0755);
+}
+
+bool FS::mkdir(const String& path) {
+	return mkdir(path.c_str());
+}
+
+bool FS::rmdir(const char* path) {
+	return !::rmdir(makePath(path).c_str());
+}
+
+bool FS::rmdir(const String& path) {
+	return rmdir(path.c_str());
+}
+
+}
@@ -0,0 +1,131 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdio.h>
+#include <memory>
+#include <vector>
+#include "Stream.h"
+
+/*
+ * The flash file system as a local directory, the same one hal_linux.cpp
+ * uses. FS_H is not defined, so GyverPortal leaves out the file upload and
+ * download, the host has no HTTP clients for them.
+ */
+
+/* --- Macroces --- */
+#define FS_HOST_ROOT "fs"
+#define FS_HOST_SIZE 2072576 // bytes, the file system of eagle.flash.4m2m.ld
+#define FS_HOST_PATH_SIZE 128
+
+namespace fs {
+
+/* --- Structures --- */
+enum SeekMode {
+	SeekSet = 0,
+	SeekCur = 1,
+	SeekEnd = 2,
+};
+
+struct FSInfo {
+	size_t totalBytes;
+	size_t usedBytes;
+	size_t blockSize;
+	size_t pageSize;
+	size_t maxOpenFiles;
+	size_t maxPathLength;
+};
+
+struct dir_entry_t {
+	String name;
+	size_t size;
+	bool directory_flag;
+};
+
+class File : public Stream {
+public:
+	File();
+	File(FILE* file, const char* path);
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	int available() override;
+	int read() override;
+	int peek() override;
+	void flush() override;
+	size_t read(uint8_t* buffer, size_t size);
+	bool seek(uint32_t position, SeekMode mode = SeekSet);
+	size_t position() const;
+	size_t size() const;
+	void close();
+	const char* name() const;
+	const char* fullName() const;
+	bool isFile() const;
+	bool isDirectory() const;
+	operator bool() const;
+
+	using Print::write;
+
+private:
+	std::shared_ptr<FILE> file; // copies share the file, like the core does
+	String path;
+};
+
+class Dir {
+public:
+	Dir();
+	Dir(const String& path, const std::vector<dir_entry_t>& entries);
+
+	bool next();
+	bool rewind();
+	String fileName();
+	size_t fileSize();
+	bool isFile();
+	bool isDirectory();
+	File openFile(const char* mode);
+
+private:
+	String path;
+	std::vector<dir_entry_t> entries;
+	int index;
+};
+
+class FS {
+public:
+	bool begin();
+	void end();
+	bool format();
+	bool info(FSInfo& info);
+
+	File open(const char* path, const char* mode);
+	File open(const String& path, const char* mode);
+	Dir openDir(const char* path);
+	Dir openDir(const String& path);
+	bool exists(const char* path);
+	bool exists(const String& path);
+	bool remove(const char* path);
+	bool remove(const String& path);
+	bool rename(const char* from, const char* to);
+	bool rename(const String& from, const String& to);
+	bool mkdir(const char* path);
+	bool mkdir(const String& path);
+	bool rmdir(const char* path);
+	bool rmdir(const String& path);
+};
+
+}
+
+using fs::FS;
+using fs::File;
+using fs::Dir;
+using fs::FSInfo;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
@@ -0,0 +1,63 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <stdio.h>
+#include "HardwareSerial.h"
+
+HardwareSerial Serial;
+
+void HardwareSerial::begin(unsigned long baud) {
+	begin_flag = true;
+}
+
+void HardwareSerial::begin(unsigned long baud, SerialConfig config, SerialMode mode) {
+	begin_flag = (mode != SERIAL_RX_ONLY);
+}
+
+void HardwareSerial::end() {
+	fflush(stdout);
+	begin_flag = false;
+}
+
+
+size_t HardwareSerial::write(uint8_t c) {
+	if (!begin_flag) {
+		return 0;
+	}
+
+	return (fputc(c, stdout) != EOF) ? 1 : 0;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+	if (!begin_flag) {
+		return 0;
+	}
+
+	return fwrite(buffer, 1, size, stdout);
+}
+
+int HardwareSerial::available() {
+	return 0;
+}
+
+int HardwareSerial::read() {
+	return -1;
+}
+
+int HardwareSerial::peek() {
+	return -1;
+}
+
+void HardwareSerial::flush() {
+	fflush(stdout);
+}
+
+HardwareSerial::operator bool() const {
+	return begin_flag;
+}
@@ -0,0 +1,47 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "Stream.h"
+
+/* --- Structures --- */
+enum SerialConfig {
+	SERIAL_8N1 = 0x1c,
+	SERIAL_8E1 = 0x1e,
+	SERIAL_8O1 = 0x1f,
+};
+
+enum SerialMode {
+	SERIAL_FULL = 0,
+	SERIAL_RX_ONLY = 1,
+	SERIAL_TX_ONLY = 2,
+};
+
+// the UART is stdout, nothing is written before begin() or after end()
+class HardwareSerial : public Stream {
+public:
+	void begin(unsigned long baud);
+	void begin(unsigned long baud, SerialConfig config, SerialMode mode = SERIAL_FULL);
+	void end();
+
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	int available() override;
+	int read() override;
+	int peek() override;
+	void flush() override;
+	operator bool() const;
+
+	using Print::write;
+
+private:
+	bool begin_flag = false;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,95 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "IPAddress.h"
+#include "Print.h"
+
+const IPAddress INADDR_ANY(0, 0, 0, 0);
+const IPAddress INADDR_NONE(255, 255, 255, 255);
+
+IPAddress::IPAddress() {
+	address.dword = 0;
+}
+
+IPAddress::IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth) {
+	address.bytes[0] = first;
+	address.bytes[1] = second;
+	address.bytes[2] = third;
+	address.bytes[3] = fourth;
+}
+
+IPAddress::IPAddress(uint32_t address) {
+	this->address.dword = address;
+}
+
+IPAddress::IPAddress(const uint8_t* address) {
+	memcpy(this->address.bytes, address, sizeof(this->address.bytes));
+}
+
+
+IPAddress::operator uint32_t() const {
+	return address.dword;
+}
+
+bool IPAddress::operator==(const IPAddress& other) const {
+	return address.dword == other.address.dword;
+}
+
+bool IPAddress::operator!=(const IPAddress& other) const {
+	return address.dword != other.address.dword;
+}
+
+uint8_t IPAddress::operator[](int index) const {
+	return address.bytes[index];
+}
+
+uint8_t& IPAddress::operator[](int index) {
+	return address.bytes[index];
+}
+
+
+bool IPAddress::fromString(const char* cstr) {
+	unsigned int bytes[4];
+	char end;
+
+	if (cstr == NULL || sscanf(cstr, "%u.%u.%u.%u%c", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &end) != 4) {
+		return false;
+	}
+
+	for (uint8_t i = 0;i < 4;i++) {
+		if (bytes[i] > 255) {
+			return false;
+		}
+
+		address.bytes[i] = bytes[i];
+	}
+
+	return true;
+}
+
+bool IPAddress::fromString(const String& string) {
+	return fromString(string.c_str());
+}
+
+String IPAddress::toString() const {
+	char cstr[16];
+
+	snprintf(cstr, sizeof(cstr), "%u.%u.%u.%u", address.bytes[0], address.bytes[1], address.bytes[2], address.bytes[3]);
+	return String(cstr);
+}
+
+bool IPAddress::isSet() const {
+	return address.dword != 0;
+}
+
+size_t IPAddress::printTo(Print& print) const {
+	return print.print(toString());
+}
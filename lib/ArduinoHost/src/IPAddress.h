@@ -0,0 +1,44 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include "WString.h"
+#include "Printable.h"
+
+// IPv4 only, the bytes are in the network order like in lwip
+class IPAddress : public Printable {
+public:
+	IPAddress();
+	IPAddress(uint8_t first, uint8_t second, uint8_t third, uint8_t fourth);
+	IPAddress(uint32_t address);
+	IPAddress(const uint8_t* address);
+
+	operator uint32_t() const;
+	bool operator==(const IPAddress& other) const;
+	bool operator!=(const IPAddress& other) const;
+	uint8_t operator[](int index) const;
+	uint8_t& operator[](int index);
+
+	bool fromString(const char* cstr);
+	bool fromString(const String& string);
+	String toString() const;
+	bool isSet() const;
+
+	size_t printTo(Print& print) const override;
+
+private:
+	union {
+		uint8_t bytes[4];
+		uint32_t dword;
+	} address;
+};
+
+extern const IPAddress INADDR_ANY;
+extern const IPAddress INADDR_NONE;
@@ -0,0 +1,165 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "Print.h"
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+	size_t count = 0;
+
+	while (size--) {
+		count += write(*buffer++);
+	}
+
+	return count;
+}
+
+size_t Print::write(const char* cstr) {
+	return (cstr != NULL) ? write((const uint8_t*) cstr, strlen(cstr)) : 0;
+}
+
+size_t Print::write(const char* buffer, size_t size) {
+	return write((const uint8_t*) buffer, size);
+}
+
+size_t Print::printf(const char* format, ...) {
+	char buffer[64];
+	char* text = buffer;
+	va_list args;
+
+	va_start(args, format);
+	int length = vsnprintf(buffer, sizeof(buffer), format, args);
+	va_end(args);
+
+	if (length < 0) {
+		return 0;
+	}
+
+	// like the ESP8266 core, a longer text goes through the heap
+	if ((size_t) length >= sizeof(buffer)) {
+		text = new char[length + 1];
+
+		va_start(args, format);
+		vsnprintf(text, length + 1, format, args);
+		va_end(args);
+	}
+
+	size_t count = write((const uint8_t*) text, length);
+
+	if (text != buffer) {
+		delete[] text;
+	}
+
+	return count;
+}
+
+
+size_t Print::print(const __FlashStringHelper* pstr) {
+	return write((const char*) pstr);
+}
+
+size_t Print::print(const String& string) {
+	return write(string.c_str(), string.length());
+}
+
+size_t Print::print(const char* cstr) {
+	return write(cstr);
+}
+
+size_t Print::print(char c) {
+	return write((uint8_t) c);
+}
+
+size_t Print::print(unsigned char value, int base) {
+	return print((unsigned long) value, base);
+}
+
+size_t Print::print(int value, int base) {
+	return print((long) value, base);
+}
+
+size_t Print::print(unsigned int value, int base) {
+	return print((unsigned long) value, base);
+}
+
+size_t Print::print(long value, int base) {
+	// base 0 writes the byte itself, like the Arduino core
+	if (!base) {
+		return write((uint8_t) value);
+	}
+
+	return print(String(value, (unsigned char) base));
+}
+
+size_t Print::print(unsigned long value, int base) {
+	if (!base) {
+		return write((uint8_t) value);
+	}
+
+	return print(String(value, (unsigned char) base));
+}
+
+size_t Print::print(double value, int digits) {
+	return print(String(value, (unsigned char) digits));
+}
+
+size_t Print::print(const Printable& printable) {
+	return printable.printTo(*this);
+}
+
+
+size_t Print::println(const __FlashStringHelper* pstr) {
+	return print(pstr) + println();
+}
+
+size_t Print::println(const String& string) {
+	return print(string) + println();
+}
+
+size_t Print::println(const char* cstr) {
+	return print(cstr) + println();
+}
+
+size_t Print::println(char c) {
+	return print(c) + println();
+}
+
+size_t Print::println(unsigned char value, int base) {
+	return print(value, base) + println();
+}
+
+size_t Print::println(int value, int base) {
+	return print(value, base) + println();
+}
+
+size_t Print::println(unsigned int value, int base) {
+	return print(value, base) + println();
+}
+
+size_t Print::println(long value, int base) {
+	return print(value, base) + println();
+}
+
+size_t Print::println(unsigned long value, int base) {
+	return print(value, base) + println();
+}
+
+size_t Print::println(double value, int digits) {
+	return print(value, digits) + println();
+}
+
+size_t Print::println(const Printable& printable) {
+	return print(printable) + println();
+}
+
+size_t Print::println() {
+	return write("\r\n");
+}
@@ -0,0 +1,52 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "WString.h"
+#include "Printable.h"
+
+class Print {
+public:
+	virtual ~Print() {}
+
+	virtual size_t write(uint8_t c) = 0;
+	virtual size_t write(const uint8_t* buffer, size_t size);
+	size_t write(const char* cstr);
+	size_t write(const char* buffer, size_t size);
+	virtual void flush() {}
+
+	size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+	size_t print(const __FlashStringHelper* pstr);
+	size_t print(const String& string);
+	size_t print(const char* cstr);
+	size_t print(char c);
+	size_t print(unsigned char value, int base = DEC);
+	size_t print(int value, int base = DEC);
+	size_t print(unsigned int value, int base = DEC);
+	size_t print(long value, int base = DEC);
+	size_t print(unsigned long value, int base = DEC);
+	size_t print(double value, int digits = 2);
+	size_t print(const Printable& printable);
+
+	size_t println(const __FlashStringHelper* pstr);
+	size_t println(const String& string);
+	size_t println(const char* cstr);
+	size_t println(char c);
+	size_t println(unsigned char value, int base = DEC);
+	size_t println(int value, int base = DEC);
+	size_t println(unsigned int value, int base = DEC);
+	size_t println(long value, int base = DEC);
+	size_t println(unsigned long value, int base = DEC);
+	size_t println(double value, int digits = 2);
+	size_t println(const Printable& printable);
+	size_t println();
+};
@@ -0,0 +1,60 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "Stream.h"
+
+void Stream::setTimeout(unsigned long timeout) {
+	this->timeout = timeout;
+}
+
+unsigned long Stream::getTimeout() const {
+	return timeout;
+}
+
+size_t Stream::readBytes(char* buffer, size_t size) {
+	size_t count = 0;
+
+	while (count < size) {
+		int c = read();
+
+		if (c < 0) {
+			break;
+		}
+
+		buffer[count++] = (char) c;
+	}
+
+	return count;
+}
+
+size_t Stream::readBytes(uint8_t* buffer, size_t size) {
+	return readBytes((char*) buffer, size);
+}
+
+String Stream::readString() {
+	String result;
+	int c;
+
+	while ((c = read()) >= 0) {
+		result += (char) c;
+	}
+
+	return result;
+}
+
+String Stream::readStringUntil(char terminator) {
+	String result;
+	int c;
+
+	while ((c = read()) >= 0 && c != terminator) {
+		result += (char) c;
+	}
+
+	return result;
+}
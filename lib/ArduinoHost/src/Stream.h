@@ -0,0 +1,30 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "Print.h"
+
+// nothing arrives while the host waits, so the reads take what is there and do not wait for the timeout
+class Stream : public Print {
+public:
+	virtual int available() = 0;
+	virtual int read() = 0;
+	virtual int peek() = 0;
+
+	void setTimeout(unsigned long timeout);
+	unsigned long getTimeout() const;
+
+	virtual size_t readBytes(char* buffer, size_t size);
+	size_t readBytes(uint8_t* buffer, size_t size);
+	String readString();
+	String readStringUntil(char terminator);
+
+protected:
+	unsigned long timeout = 1000;
+};
@@ -0,0 +1,37 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "StreamString.h"
+
+size_t StreamString::write(uint8_t c) {
+	return concat((char) c) ? 1 : 0;
+}
+
+size_t StreamString::write(const uint8_t* buffer, size_t size) {
+	return concat((const char*) buffer, size) ? size : 0;
+}
+
+int StreamString::available() {
+	return length();
+}
+
+int StreamString::read() {
+	if (!length()) {
+		return -1;
+	}
+
+	char c = charAt(0);
+
+	remove(0, 1);
+	return (uint8_t) c;
+}
+
+int StreamString::peek() {
+	return length() ? (uint8_t) charAt(0) : -1;
+}
@@ -0,0 +1,22 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include "Stream.h"
+
+class StreamString : public Stream, public String {
+public:
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+	int available() override;
+	int read() override;
+	int peek() override;
+
+	using Print::write;
+};
@@ -0,0 +1,37 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "Updater.h"
+#include "flash_hal.h"
+
+UpdaterClass Update;
+
+char _FS_start;
+char _FS_end;
+
+void close_all_fs() {
+}
+
+
+bool UpdaterClass::begin(size_t size, int command) {
+	error = UPDATE_ERROR_SPACE;
+	return false;
+}
+
+size_t UpdaterClass::write(uint8_t* data, size_t size) {
+	return 0;
+}
+
+bool UpdaterClass::end(bool even_if_remaining_flag) {
+	return false;
+}
+
+uint8_t UpdaterClass::getError() {
+	return error;
+}
@@ -0,0 +1,48 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/* --- Macroces --- */
+#define U_FLASH 0
+#define U_FS 100
+#define U_SPIFFS U_FS
+#define U_AUTH 200
+
+#define UPDATE_ERROR_OK (0)
+#define UPDATE_ERROR_WRITE (1)
+#define UPDATE_ERROR_ERASE (2)
+#define UPDATE_ERROR_READ (3)
+#define UPDATE_ERROR_SPACE (4)
+#define UPDATE_ERROR_SIZE (5)
+#define UPDATE_ERROR_STREAM (6)
+#define UPDATE_ERROR_MD5 (7)
+#define UPDATE_ERROR_FLASH_CONFIG (8)
+#define UPDATE_ERROR_NEW_FLASH_CONFIG (9)
+#define UPDATE_ERROR_MAGIC_BYTE (10)
+#define UPDATE_ERROR_BOOTSTRAP (11)
+#define UPDATE_ERROR_SIGN (12)
+#define UPDATE_ERROR_NO_DATA (13)
+#define UPDATE_ERROR_OOM (14)
+
+// the firmware can not be written on the host, every update fails for lack of space
+class UpdaterClass {
+public:
+	bool begin(size_t size, int command = U_FLASH);
+	size_t write(uint8_t* data, size_t size);
+	bool end(bool even_if_remaining_flag = false);
+	uint8_t getError();
+
+private:
+	uint8_t error = UPDATE_ERROR_OK;
+};
+
+extern UpdaterClass Update;
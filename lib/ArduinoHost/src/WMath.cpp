@@ -0,0 +1,36 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <Arduino.h>
+
+// the same generator on every run, so host runs repeat
+static uint32_t random_state = 1;
+
+long random(long max_value) {
+	if (max_value <= 0) {
+		return 0;
+	}
+
+	random_state = random_state * 1103515245 + 12345;
+	return ((random_state >> 1) & 0x7FFFFFFF) % max_value;
+}
+
+long random(long min_value, long max_value) {
+	if (min_value >= max_value) {
+		return min_value;
+	}
+
+	return min_value + random(max_value - min_value);
+}
+
+void randomSeed(unsigned long seed) {
+	if (seed) {
+		random_state = seed;
+	}
+}
@@ -0,0 +1,630 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <ctype.h>
+#include "WString.h"
+
+static void numberToString(unsigned long value, unsigned char base, bool negative_flag, char* buffer) {
+	char digits[sizeof(unsigned long) * 8 + 1];
+	uint8_t count = 0;
+
+	if (base < 2) {
+		base = DEC;
+	}
+
+	do {
+		uint8_t digit = value % base;
+
+		digits[count++] = (digit < 10) ? '0' + digit : 'a' + digit - 10;
+		value /= base;
+	} while (value);
+
+	if (negative_flag) {
+		*buffer++ = '-';
+	}
+
+	while (count) {
+		*buffer++ = digits[--count];
+	}
+	*buffer = '\0';
+}
+
+
+String::String(const char* cstr) {
+	init();
+
+	if (cstr != NULL) {
+		copy(cstr, strlen(cstr));
+	}
+}
+
+String::String(const String& other) {
+	init();
+	copy(other.rbuffer(), other.len);
+}
+
+String::String(String&& other) {
+	init();
+
+	if (other.buffer == NULL) {
+		copy(other.sso, other.len);
+		return;
+	}
+
+	buffer = other.buffer;
+	capacity = other.capacity;
+	len = other.len;
+	other.init();
+}
+
+String::String(const __FlashStringHelper* pstr) : String((const char*) pstr) {
+}
+
+String::String(const char* cstr, unsigned int length) {
+	init();
+
+	if (cstr != NULL) {
+		copy(cstr, length);
+	}
+}
+
+String::String(char c) {
+	char cstr[2] = {c, '\0'};
+
+	init();
+	copy(cstr, 1);
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long) value, base) {
+}
+
+String::String(int value, unsigned char base) : String((long) value, base) {
+}
+
+String::String(unsigned int value, unsigned char base) : String((unsigned long) value, base) {
+}
+
+String::String(long value, unsigned char base) {
+	char cstr[sizeof(unsigned long) * 8 + 2];
+
+	init();
+
+	// only decimal numbers are signed, like in the ESP8266 core
+	if (base == DEC && value < 0) {
+		numberToString(-(unsigned long) value, base, true, cstr);
+	}
+	else {
+		numberToString((unsigned long) value, base, false, cstr);
+	}
+
+	copy(cstr, strlen(cstr));
+}
+
+String::String(unsigned long value, unsigned char base) {
+	char cstr[sizeof(unsigned long) * 8 + 1];
+
+	init();
+	numberToString(value, base, false, cstr);
+	copy(cstr, strlen(cstr));
+}
+
+String::String(float value, unsigned char decimals) : String((double) value, decimals) {
+}
+
+String::String(double value, unsigned char decimals) {
+	char cstr[33];
+
+	init();
+	snprintf(cstr, sizeof(cstr), "%.*f", decimals, value);
+	copy(cstr, strlen(cstr));
+}
+
+String::~String() {
+	release();
+}
+
+
+String& String::operator=(const String& other) {
+	if (this != &other) {
+		copy(other.rbuffer(), other.len);
+	}
+
+	return *this;
+}
+
+String& String::operator=(String&& other) {
+	if (this == &other) {
+		return *this;
+	}
+
+	if (other.buffer == NULL) {
+		return copy(other.sso, other.len);
+	}
+
+	release();
+	buffer = other.buffer;
+	capacity = other.capacity;
+	len = other.len;
+	other.init();
+
+	return *this;
+}
+
+String& String::operator=(const char* cstr) {
+	return copy(cstr ? cstr : "", cstr ? strlen(cstr) : 0);
+}
+
+String& String::operator=(const __FlashStringHelper* pstr) {
+	return *this = (const char*) pstr;
+}
+
+
+bool String::reserve(unsigned int size) {
+	if (size <= capacity) {
+		return true;
+	}
+
+	return changeBuffer(size);
+}
+
+bool String::concat(const String& other) {
+	// a string may be added to itself
+	if (this == &other) {
+		String copy_string(other);
+		return concat(copy_string.rbuffer(), copy_string.len);
+	}
+
+	return concat(other.rbuffer(), other.len);
+}
+
+bool String::concat(const char* cstr) {
+	if (cstr == NULL) {
+		return false;
+	}
+
+	return concat(cstr, strlen(cstr));
+}
+
+bool String::concat(const char* cstr, unsigned int length) {
+	if (cstr == NULL) {
+		return false;
+	}
+
+	if (!length) {
+		return true;
+	}
+
+	if (!reserve(len + length)) {
+		return false;
+	}
+
+	memmove(wbuffer() + len, cstr, length);
+	len += length;
+	wbuffer()[len] = '\0';
+
+	return true;
+}
+
+bool String::concat(const __FlashStringHelper* pstr) {
+	return concat((const char*) pstr);
+}
+
+bool String::concat(char c) {
+	return concat(&c, 1);
+}
+
+bool String::concat(unsigned char value) {
+	return concat(String(value));
+}
+
+bool String::concat(int value) {
+	return concat(String(value));
+}
+
+bool String::concat(unsigned int value) {
+	return concat(String(value));
+}
+
+bool String::concat(long value) {
+	return concat(String(value));
+}
+
+bool String::concat(unsigned long value) {
+	return concat(String(value));
+}
+
+bool String::concat(float value) {
+	return concat(String(value));
+}
+
+bool String::concat(double value) {
+	return concat(String(value));
+}
+
+
+unsigned int String::length() const {
+	return len;
+}
+
+bool String::isEmpty() const {
+	return !len;
+}
+
+void String::clear() {
+	len = 0;
+	wbuffer()[0] = '\0';
+}
+
+const char* String::c_str() const {
+	return rbuffer();
+}
+
+char String::charAt(unsigned int index) const {
+	return (index < len) ? rbuffer()[index] : '\0';
+}
+
+void String::setCharAt(unsigned int index, char c) {
+	if (index < len) {
+		wbuffer()[index] = c;
+	}
+}
+
+char String::operator[](unsigned int index) const {
+	return charAt(index);
+}
+
+char& String::operator[](unsigned int index) {
+	static char dummy_char;
+
+	if (index >= len) {
+		dummy_char = '\0';
+		return dummy_char;
+	}
+
+	return wbuffer()[index];
+}
+
+void String::toCharArray(char* buffer, unsigned int size, unsigned int index) const {
+	getBytes((unsigned char*) buffer, size, index);
+}
+
+void String::getBytes(unsigned char* buffer, unsigned int size, unsigned int index) const {
+	if (buffer == NULL || !size) {
+		return;
+	}
+
+	if (index >= len) {
+		*buffer = '\0';
+		return;
+	}
+
+	unsigned int count = len - index;
+
+	if (count > size - 1) {
+		count = size - 1;
+	}
+
+	memcpy(buffer, rbuffer() + index, count);
+	buffer[count] = '\0';
+}
+
+
+int String::compareTo(const String& other) const {
+	return strcmp(rbuffer(), other.rbuffer());
+}
+
+bool String::equals(const String& other) const {
+	return len == other.len && !compareTo(other);
+}
+
+bool String::equals(const char* cstr) const {
+	return !strcmp(rbuffer(), cstr ? cstr : "");
+}
+
+bool String::equalsIgnoreCase(const String& other) const {
+	return len == other.len && !strcasecmp(rbuffer(), other.rbuffer());
+}
+
+bool String::startsWith(const String& prefix) const {
+	return prefix.len <= len && !strncmp(rbuffer(), prefix.rbuffer(), prefix.len);
+}
+
+bool String::endsWith(const String& suffix) const {
+	return suffix.len <= len && !strcmp(rbuffer() + len - suffix.len, suffix.rbuffer());
+}
+
+bool String::operator==(const String& other) const {
+	return equals(other);
+}
+
+bool String::operator==(const char* cstr) const {
+	return equals(cstr);
+}
+
+bool String::operator==(const __FlashStringHelper* pstr) const {
+	return equals((const char*) pstr);
+}
+
+bool String::operator!=(const String& other) const {
+	return !equals(other);
+}
+
+bool String::operator!=(const char* cstr) const {
+	return !equals(cstr);
+}
+
+bool String::operator<(const String& other) const {
+	return compareTo(other) < 0;
+}
+
+
+int String::indexOf(char c, unsigned int from) const {
+	if (from >= len) {
+		return -1;
+	}
+
+	const char* found = strchr(rbuffer() + from, c);
+	return found ? found - rbuffer() : -1;
+}
+
+int String::indexOf(const String& other, unsigned int from) const {
+	if (from > len) {
+		return -1;
+	}
+
+	const char* found = strstr(rbuffer() + from, other.rbuffer());
+	return found ? found - rbuffer() : -1;
+}
+
+int String::lastIndexOf(char c) const {
+	const char* found = strrchr(rbuffer(), c);
+	return found ? found - rbuffer() : -1;
+}
+
+String String::substring(unsigned int from) const {
+	return substring(from, len);
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+	String result;
+
+	if (from > to) {
+		unsigned int temp = from;
+
+		from = to;
+		to = temp;
+	}
+
+	if (from >= len) {
+		return result;
+	}
+
+	if (to > len) {
+		to = len;
+	}
+
+	result.copy(rbuffer() + from, to - from);
+	return result;
+}
+
+
+void String::replace(char find, char replace) {
+	for (unsigned int i = 0;i < len;i++) {
+		if (wbuffer()[i] == find) {
+			wbuffer()[i] = replace;
+		}
+	}
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+	if (index >= len) {
+		return;
+	}
+
+	if (count > len - index) {
+		count = len - index;
+	}
+
+	memmove(wbuffer() + index, wbuffer() + index + count, len - index - count);
+	len -= count;
+	wbuffer()[len] = '\0';
+}
+
+void String::toLowerCase() {
+	for (unsigned int i = 0;i < len;i++) {
+		wbuffer()[i] = tolower(wbuffer()[i]);
+	}
+}
+
+void String::toUpperCase() {
+	for (unsigned int i = 0;i < len;i++) {
+		wbuffer()[i] = toupper(wbuffer()[i]);
+	}
+}
+
+void String::trim() {
+	unsigned int begin = 0;
+	unsigned int end = len;
+
+	while (begin < end && isspace(rbuffer()[begin])) {
+		begin++;
+	}
+
+	while (end > begin && isspace(rbuffer()[end - 1])) {
+		end--;
+	}
+
+	memmove(wbuffer(), rbuffer() + begin, end - begin);
+	len = end - begin;
+	wbuffer()[len] = '\0';
+}
+
+
+long String::toInt() const {
+	return atol(rbuffer());
+}
+
+float String::toFloat() const {
+	return atof(rbuffer());
+}
+
+double String::toDouble() const {
+	return atof(rbuffer());
+}
+
+
+void String::init() {
+	buffer = NULL;
+	capacity = STRING_SSO_SIZE - 1;
+	len = 0;
+	sso[0] = '\0';
+}
+
+void String::release() {
+	free(buffer);
+	init();
+}
+
+// the heap is used only above sso, it grows like the ESP8266 core does, to the exact size
+bool String::changeBuffer(unsigned int size) {
+	if (size <= STRING_SSO_SIZE - 1 && buffer == NULL) {
+		return true;
+	}
+
+	char* new_buffer = (char*) realloc(buffer, size + 1);
+
+	if (new_buffer == NULL) {
+		return false;
+	}
+
+	if (buffer == NULL) {
+		memcpy(new_buffer, sso, len + 1);
+	}
+
+	buffer = new_buffer;
+	capacity = size;
+
+	return true;
+}
+
+String& String::copy(const char* cstr, unsigned int length) {
+	if (!reserve(length)) {
+		release();
+		return *this;
+	}
+
+	memmove(wbuffer(), cstr, length);
+	len = length;
+	wbuffer()[len] = '\0';
+
+	return *this;
+}
+
+char* String::wbuffer() {
+	return buffer ? buffer : sso;
+}
+
+const char* String::rbuffer() const {
+	return buffer ? buffer : sso;
+}
+
+
+String operator+(const String& left, const String& right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, const char* right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const char* left, const String& right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, const __FlashStringHelper* right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, char right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(char left, const String& right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, unsigned char right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, int right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, unsigned int right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, long right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, unsigned long right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, float right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
+
+String operator+(const String& left, double right) {
+	String result(left);
+
+	result.concat(right);
+	return result;
+}
@@ -0,0 +1,135 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/* --- Macroces --- */
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#define STRING_SSO_SIZE 12 // 11 chars and the terminator are kept in the object, as the ESP8266 core does
+
+// F() strings have their own type, so the overloads pick them like on the board
+class __FlashStringHelper;
+#define FPSTR(PSTR_POINTER) (reinterpret_cast<const __FlashStringHelper*>(PSTR_POINTER))
+#define F(STRING) (FPSTR(PSTR(STRING)))
+
+class String {
+public:
+	String(const char* cstr = "");
+	String(const String& other);
+	String(String&& other);
+	String(const __FlashStringHelper* pstr);
+	String(const char* cstr, unsigned int length);
+	explicit String(char c);
+	explicit String(unsigned char value, unsigned char base = DEC);
+	explicit String(int value, unsigned char base = DEC);
+	explicit String(unsigned int value, unsigned char base = DEC);
+	explicit String(long value, unsigned char base = DEC);
+	explicit String(unsigned long value, unsigned char base = DEC);
+	explicit String(float value, unsigned char decimals = 2);
+	explicit String(double value, unsigned char decimals = 2);
+	~String();
+
+	String& operator=(const String& other);
+	String& operator=(String&& other);
+	String& operator=(const char* cstr);
+	String& operator=(const __FlashStringHelper* pstr);
+
+	bool reserve(unsigned int size);
+	bool concat(const String& other);
+	bool concat(const char* cstr);
+	bool concat(const char* cstr, unsigned int length);
+	bool concat(const __FlashStringHelper* pstr);
+	bool concat(char c);
+	bool concat(unsigned char value);
+	bool concat(int value);
+	bool concat(unsigned int value);
+	bool concat(long value);
+	bool concat(unsigned long value);
+	bool concat(float value);
+	bool concat(double value);
+
+	template <class T>
+	String& operator+=(const T& value) {
+		concat(value);
+		return *this;
+	}
+
+	unsigned int length() const;
+	bool isEmpty() const;
+	void clear();
+	const char* c_str() const;
+	char charAt(unsigned int index) const;
+	void setCharAt(unsigned int index, char c);
+	char operator[](unsigned int index) const;
+	char& operator[](unsigned int index);
+	void toCharArray(char* buffer, unsigned int size, unsigned int index = 0) const;
+	void getBytes(unsigned char* buffer, unsigned int size, unsigned int index = 0) const;
+
+	int compareTo(const String& other) const;
+	bool equals(const String& other) const;
+	bool equals(const char* cstr) const;
+	bool equalsIgnoreCase(const String& other) const;
+	bool startsWith(const String& prefix) const;
+	bool endsWith(const String& suffix) const;
+	bool operator==(const String& other) const;
+	bool operator==(const char* cstr) const;
+	bool operator==(const __FlashStringHelper* pstr) const;
+	bool operator!=(const String& other) const;
+	bool operator!=(const char* cstr) const;
+	bool operator<(const String& other) const;
+
+	int indexOf(char c, unsigned int from = 0) const;
+	int indexOf(const String& other, unsigned int from = 0) const;
+	int lastIndexOf(char c) const;
+	String substring(unsigned int from) const;
+	String substring(unsigned int from, unsigned int to) const;
+
+	void replace(char find, char replace);
+	void remove(unsigned int index, unsigned int count = (unsigned int) -1);
+	void toLowerCase();
+	void toUpperCase();
+	void trim();
+
+	long toInt() const;
+	float toFloat() const;
+	double toDouble() const;
+
+private:
+	void init();
+	void release();
+	bool changeBuffer(unsigned int size);
+	String& copy(const char* cstr, unsigned int length);
+	char* wbuffer();
+	const char* rbuffer() const;
+
+	char* buffer; // NULL while the string fits sso
+	unsigned int capacity;
+	unsigned int len;
+	char sso[STRING_SSO_SIZE];
+};
+
+String operator+(const String& left, const String& right);
+String operator+(const String& left, const char* right);
+String operator+(const char* left, const String& right);
+String operator+(const String& left, const __FlashStringHelper* right);
+String operator+(const String& left, char right);
+String operator+(char left, const String& right);
+String operator+(const String& left, unsigned char right);
+String operator+(const String& left, int right);
+String operator+(const String& left, unsigned int right);
+String operator+(const String& left, long right);
+String operator+(const String& left, unsigned long right);
+String operator+(const String& left, float right);
+String operator+(const String& left, double right);
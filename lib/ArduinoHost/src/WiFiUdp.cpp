@@ -0,0 +1,171 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "WiFiUdp.h"
+
+// kept to the end, the sockets of static objects stop after it would be gone
+static std::vector<WiFiUDP*>& started_sockets = *new std::vector<WiFiUDP*>;
+
+WiFiUDP::WiFiUDP() {
+	local_port = 0;
+	tx_packet.port = 0;
+	sent_packet.port = 0;
+	rx_packet.port = 0;
+	rx_position = 0;
+}
+
+WiFiUDP::~WiFiUDP() {
+	stop();
+}
+
+
+uint8_t WiFiUDP::begin(uint16_t port) {
+	stop();
+
+	local_port = port;
+	started_sockets.push_back(this);
+
+	return 1;
+}
+
+void WiFiUDP::stop() {
+	for (uint8_t i = 0;i < started_sockets.size();i++) {
+		if (started_sockets[i] == this) {
+			started_sockets.erase(started_sockets.begin() + i);
+			break;
+		}
+	}
+
+	local_port = 0;
+	rx_packets.clear();
+	rx_packet.data.clear();
+	rx_position = 0;
+}
+
+void WiFiUDP::stopAll() {
+	while (started_sockets.size()) {
+		started_sockets.back()->stop();
+	}
+}
+
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+	tx_packet.ip = ip;
+	tx_packet.port = port;
+	tx_packet.data.clear();
+
+	return 1;
+}
+
+int WiFiUDP::beginPacket(const char* host, uint16_t port) {
+	IPAddress ip;
+
+	if (!WiFi.hostByName(host, ip)) {
+		return 0;
+	}
+
+	return beginPacket(ip, port);
+}
+
+int WiFiUDP::endPacket() {
+	if (!tx_packet.port) {
+		return 0;
+	}
+
+	sent_packet = tx_packet;
+	tx_packet.port = 0;
+	tx_packet.data.clear();
+
+	return 1;
+}
+
+size_t WiFiUDP::write(uint8_t c) {
+	return write(&c, 1);
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size) {
+	if (!tx_packet.port) {
+		return 0;
+	}
+
+	tx_packet.data.insert(tx_packet.data.end(), buffer, buffer + size);
+	return size;
+}
+
+
+// the rest of the last packet is dropped, as lwip does
+int WiFiUDP::parsePacket() {
+	rx_packet.data.clear();
+	rx_position = 0;
+
+	if (rx_packets.empty()) {
+		return 0;
+	}
+
+	rx_packet = rx_packets.front();
+	rx_packets.pop_front();
+
+	return rx_packet.data.size();
+}
+
+int WiFiUDP::available() {
+	return rx_packet.data.size() - rx_position;
+}
+
+int WiFiUDP::read() {
+	return (rx_position < rx_packet.data.size()) ? rx_packet.data[rx_position++] : -1;
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t size) {
+	size = min(size, (size_t) available());
+
+	memcpy(buffer, rx_packet.data.data() + rx_position, size);
+	rx_position += size;
+
+	return size;
+}
+
+int WiFiUDP::peek() {
+	return (rx_position < rx_packet.data.size()) ? rx_packet.data[rx_position] : -1;
+}
+
+void WiFiUDP::flush() {
+	rx_position = rx_packet.data.size();
+}
+
+IPAddress WiFiUDP::remoteIP() {
+	return rx_packet.ip;
+}
+
+uint16_t WiFiUDP::remotePort() {
+	return rx_packet.port;
+}
+
+
+const wifi_udp_host_packet_t& WiFiUDP::hostSent() const {
+	return sent_packet;
+}
+
+void WiFiUDP::hostReceive(IPAddress ip, uint16_t port, const uint8_t* buffer, size_t size) {
+	if (!local_port) {
+		return;
+	}
+
+	rx_packets.push_back({ip, port, std::vector<uint8_t>(buffer, buffer + size)});
+}
+
+WiFiUDP* WiFiUDP::hostFind(uint16_t port) {
+	for (uint8_t i = 0;i < started_sockets.size();i++) {
+		if (started_sockets[i]->local_port == port) {
+			return started_sockets[i];
+		}
+	}
+
+	return NULL;
+}
@@ -0,0 +1,68 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <deque>
+#include <vector>
+#include "ESP8266WiFi.h"
+
+/*
+ * A UDP socket of the host. The packets sent go nowhere, the last one is
+ * kept for hostSent(). The packets that arrive are queued with
+ * hostReceive() and read like on the board, one per parsePacket(). A
+ * started socket is found by its local port with hostFind(), like a peer
+ * finds it.
+ */
+
+/* --- Structures --- */
+struct wifi_udp_host_packet_t {
+	IPAddress ip;
+	uint16_t port;
+	std::vector<uint8_t> data;
+};
+
+class WiFiUDP : public Stream {
+public:
+	WiFiUDP();
+	~WiFiUDP();
+
+	uint8_t begin(uint16_t port);
+	void stop();
+	static void stopAll();
+
+	int beginPacket(IPAddress ip, uint16_t port);
+	int beginPacket(const char* host, uint16_t port);
+	int endPacket();
+	size_t write(uint8_t c) override;
+	size_t write(const uint8_t* buffer, size_t size) override;
+
+	int parsePacket();
+	int available() override;
+	int read() override;
+	int read(uint8_t* buffer, size_t size);
+	int peek() override;
+	void flush() override;
+	IPAddress remoteIP();
+	uint16_t remotePort();
+
+	// the host side, the peer the socket talks to
+	const wifi_udp_host_packet_t& hostSent() const;
+	void hostReceive(IPAddress ip, uint16_t port, const uint8_t* buffer, size_t size);
+	static WiFiUDP* hostFind(uint16_t port);
+
+	using Print::write;
+
+private:
+	uint16_t local_port; // 0 while stopped
+	wifi_udp_host_packet_t tx_packet;
+	wifi_udp_host_packet_t sent_packet;
+	std::deque<wifi_udp_host_packet_t> rx_packets;
+	wifi_udp_host_packet_t rx_packet;
+	size_t rx_position;
+};
@@ -0,0 +1,57 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "Wire.h"
+
+TwoWire Wire;
+
+void TwoWire::begin() {
+}
+
+void TwoWire::begin(int sda, int scl) {
+}
+
+void TwoWire::setClock(uint32_t frequency) {
+}
+
+
+void TwoWire::beginTransmission(uint8_t address) {
+	bytes++;
+}
+
+uint8_t TwoWire::endTransmission(bool stop_flag) {
+	return 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+	bytes++;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t* data, size_t size) {
+	bytes += size;
+	return size;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t address, uint8_t size) {
+	return 0;
+}
+
+int TwoWire::available() {
+	return 0;
+}
+
+int TwoWire::read() {
+	return -1;
+}
+
+
+uint32_t TwoWire::hostBytes() {
+	return bytes;
+}
@@ -0,0 +1,35 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// an I2C bus where every device answers, the host counts the bytes sent
+class TwoWire {
+public:
+	void begin();
+	void begin(int sda, int scl);
+	void setClock(uint32_t frequency);
+
+	void beginTransmission(uint8_t address);
+	uint8_t endTransmission(bool stop_flag = true);
+	size_t write(uint8_t data);
+	size_t write(const uint8_t* data, size_t size);
+	uint8_t requestFrom(uint8_t address, uint8_t size);
+	int available();
+	int read();
+
+	uint32_t hostBytes(); // sent since the start
+
+private:
+	uint32_t bytes = 0;
+};
+
+extern TwoWire Wire;
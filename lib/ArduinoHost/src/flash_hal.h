@@ -0,0 +1,16 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+
+// the bounds of the flash file system, the host has no flash to update
+extern "C" char _FS_start;
+extern "C" char _FS_end;
+
+void close_all_fs();
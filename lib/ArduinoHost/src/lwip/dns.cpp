@@ -0,0 +1,98 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <string.h>
+#include "IPAddress.h"
+#include "lwip/dns.h"
+
+struct dns_host_name_t {
+	char name[DNS_HOST_NAME_SIZE];
+	uint32_t address;
+};
+
+struct dns_host_query_t {
+	char name[DNS_HOST_NAME_SIZE];
+	dns_found_callback found;
+	void* callback_arg;
+};
+
+static dns_host_name_t names[DNS_HOST_NAMES_MAX];
+static uint8_t names_count = 0;
+static dns_host_query_t queries[DNS_HOST_QUERIES_MAX];
+static uint8_t queries_count = 0;
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg) {
+	IPAddress ip;
+
+	if (hostname == NULL || !*hostname || strlen(hostname) >= DNS_HOST_NAME_SIZE) {
+		return ERR_ARG;
+	}
+
+	if (ip.fromString(hostname)) {
+		addr->addr = ip;
+		return ERR_OK;
+	}
+
+	if (queries_count >= DNS_HOST_QUERIES_MAX) {
+		return ERR_MEM;
+	}
+
+	strcpy(queries[queries_count].name, hostname);
+	queries[queries_count].found = found;
+	queries[queries_count].callback_arg = callback_arg;
+	queries_count++;
+
+	return ERR_INPROGRESS;
+}
+
+
+void dnsHostSet(const char* name, uint32_t address) {
+	for (uint8_t i = 0;i < names_count;i++) {
+		if (!strcmp(names[i].name, name)) {
+			names[i].address = address;
+			return;
+		}
+	}
+
+	if (names_count >= DNS_HOST_NAMES_MAX || strlen(name) >= DNS_HOST_NAME_SIZE) {
+		return;
+	}
+
+	strcpy(names[names_count].name, name);
+	names[names_count].address = address;
+	names_count++;
+}
+
+void dnsHostPoll() {
+	// the callbacks may start new queries, they wait for the next poll
+	uint8_t count = queries_count;
+	dns_host_query_t answered[DNS_HOST_QUERIES_MAX];
+
+	memcpy(answered, queries, sizeof(dns_host_query_t) * count);
+	queries_count = 0;
+
+	for (uint8_t i = 0;i < count;i++) {
+		ip_addr_t address = {0};
+
+		for (uint8_t j = 0;j < names_count;j++) {
+			if (!strcmp(names[j].name, answered[i].name)) {
+				address.addr = names[j].address;
+			}
+		}
+
+		if (answered[i].found != NULL) {
+			answered[i].found(answered[i].name, address.addr ? &address : NULL, answered[i].callback_arg);
+		}
+	}
+}
+
+void dnsHostClear() {
+	names_count = 0;
+	queries_count = 0;
+}
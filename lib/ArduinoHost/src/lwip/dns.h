@@ -0,0 +1,47 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+
+/*
+ * The lwip resolver of the host. A dotted address resolves at once, a name
+ * is queued and answered by dnsHostPoll() like the lwip timer would, with
+ * the address set by dnsHostSet() or NULL when there is none.
+ */
+
+/* --- Macroces --- */
+#define ERR_OK 0
+#define ERR_MEM -1
+#define ERR_INPROGRESS -5
+#define ERR_ARG -16
+
+#define DNS_HOST_NAMES_MAX 8
+#define DNS_HOST_QUERIES_MAX 8
+#define DNS_HOST_NAME_SIZE 64
+
+/* --- Macro functions --- */
+#define ip_addr_get_ip4_u32(IPADDR) ((IPADDR)->addr)
+
+/* --- Structures --- */
+typedef int8_t err_t;
+
+typedef struct {
+	uint32_t addr; // network order
+} ip_addr_t;
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+/* --- Functions --- */
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg);
+
+// the host side; address 0 makes the name fail
+void dnsHostSet(const char* name, uint32_t address);
+void dnsHostPoll();
+void dnsHostClear();
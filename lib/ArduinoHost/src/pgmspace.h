@@ -0,0 +1,44 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+// the host has one address space, the flash strings are plain memory
+
+/* --- Macroces --- */
+#define PROGMEM
+#define PGM_P const char*
+#define PGM_VOID_P const void*
+#define PSTR(STRING) (STRING)
+
+/* --- Macro functions --- */
+#define pgm_read_byte(ADDRESS) (*(const uint8_t*) (ADDRESS))
+#define pgm_read_word(ADDRESS) (*(const uint16_t*) (ADDRESS))
+#define pgm_read_dword(ADDRESS) (*(const uint32_t*) (ADDRESS))
+#define pgm_read_float(ADDRESS) (*(const float*) (ADDRESS))
+#define pgm_read_ptr(ADDRESS) (*(const void* const*) (ADDRESS))
+
+#define strlen_P strlen
+#define strnlen_P strnlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcat_P strcat
+#define strncat_P strncat
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+#define strstr_P strstr
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define sprintf_P sprintf
+#define snprintf_P snprintf
+#define vsnprintf_P vsnprintf
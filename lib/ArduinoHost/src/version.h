@@ -0,0 +1,13 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#pragma once
+
+// the SDK of the ESP8266 core the firmware is built with
+#define ESP_SDK_VERSION_NUMBER 0x020200
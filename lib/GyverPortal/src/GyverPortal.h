@@ -31,6 +31,7 @@
 #include <Arduino.h>
 
 #define GP_CACHE_PRD "max-age=86400"        // таймаут кеширования (умолч. 86400 - сутки)
+#define GP_GZIP_CACHE_PRD "max-age=31536000, immutable" // Author: Vereshchynskyi Nazar. the urls carry GP_VERSION, the ETag covers the rest
 
 #ifndef GP_NO_DNS
 #include <DNSServer.h>
@@ -207,7 +207,7 @@ struct Builder {
     
     void THEME(PGM_P style) {
         *_GPP += F("<link rel='stylesheet' href='/GP_STYLE.css?v" GP_VERSION "=");
-        *_GPP += ((uint32_t)style) & 0xFFFF;
+        *_GPP += ((uint32_t)(uintptr_t)style) & 0xFFFF;
         *_GPP += "'";
         *_GPP += ">\n";
         _gp_style = style;
@@ -311,7 +311,7 @@ struct Builder {
     }
     
     void CANVAS_SUPPORT() {
-        *_GPP += F("<script src='/GP_CANVAS.js?=");
+        *_GPP += F("<script src='/GP_CANVAS.js?v" GP_VERSION "=");
         *_GPP += _gp_seed;
         *_GPP += F("'></script>\n");
     }
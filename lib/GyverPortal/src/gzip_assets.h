@@ -0,0 +1,541 @@
+// generated by scripts/gzip_assets.py, do not edit
+#pragma once
+
+struct gp_gzip_asset_t {
+    PGM_P plain;
+    const uint8_t* gzip;
+    size_t size;
+    const char* etag;
+};
+
+// GP_JS_TOP: 4985 -> 1989 bytes
+const uint8_t GP_JS_TOP_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x58, 0x59, 0x73, 0x1b, 0x37,
+    0x12, 0x7e, 0xe7, 0xaf, 0xa0, 0xe2, 0x0a, 0x31, 0x13, 0x8e, 0x18, 0x52, 0x39, 0x1e, 0x38, 0xc1,
+    0xaa, 0xe2, 0xdb, 0x55, 0x76, 0xec, 0xb2, 0x94, 0xda, 0xdd, 0xb2, 0x5d, 0xac, 0x39, 0x40, 0x12,
+    0x25, 0x10, 0x33, 0x1a, 0x80, 0xd7, 0x52, 0xfc, 0xef, 0xdb, 0xdd, 0x98, 0x93, 0xa2, 0xed, 0x3c,
+    0x98, 0x1a, 0x00, 0x8d, 0xaf, 0x1b, 0xe8, 0xeb, 0x83, 0x7b, 0x9b, 0xa8, 0xe8, 0xcf, 0x6c, 0xb6,
+    0xb6, 0xfc, 0x6a, 0x3c, 0x1e, 0x87, 0x3d, 0x1a, 0x27, 0xea, 0xee, 0xa3, 0x50, 0x6f, 0xa5, 0xb1,
+    0xfc, 0xd3, 0x97, 0x00, 0x97, 0x93, 0x25, 0x1f, 0x07, 0x6e, 0x3e, 0x2d, 0x68, 0xe1, 0x70, 0xa4,
+    0xf1, 0xdf, 0x79, 0x5a, 0x0f, 0xf3, 0x42, 0x18, 0xf3, 0x26, 0xe5, 0x7a, 0xad, 0x54, 0x30, 0x33,
+    0xb9, 0xd4, 0x6f, 0xb4, 0x6d, 0x8d, 0x5e, 0x72, 0x50, 0x90, 0x66, 0xc9, 0x7a, 0x25, 0xb4, 0x1d,
+    0x59, 0x69, 0x95, 0xe0, 0xec, 0xd5, 0x7e, 0x23, 0x8a, 0x0f, 0x59, 0x61, 0x23, 0xc5, 0xc2, 0xde,
+    0x7c, 0xad, 0x13, 0x2b, 0x33, 0xdd, 0x7f, 0xf5, 0x61, 0x66, 0x84, 0x4e, 0xbd, 0x42, 0xdc, 0x07,
+    0x85, 0xc3, 0x58, 0xe7, 0x0e, 0xda, 0x3f, 0x90, 0x95, 0xbb, 0xa5, 0xb5, 0x39, 0xd7, 0x62, 0xdb,
+    0xff, 0xcf, 0xbb, 0xb7, 0xaf, 0xe1, 0xfb, 0xa3, 0xb8, 0x5f, 0x0b, 0x63, 0x3d, 0x3f, 0xa4, 0xa5,
+    0x51, 0x96, 0x0b, 0xed, 0xc1, 0xa6, 0x6b, 0xf6, 0xea, 0xc5, 0x2d, 0x9b, 0xb2, 0x0f, 0xef, 0x6f,
+    0x6e, 0x59, 0x80, 0x80, 0xb6, 0x58, 0x8b, 0x4a, 0x8a, 0xb4, 0x54, 0x03, 0x2b, 0x57, 0x02, 0xef,
+    0x82, 0x6e, 0x24, 0xec, 0x95, 0x38, 0xba, 0x10, 0x51, 0xba, 0x37, 0x36, 0xb2, 0x22, 0x59, 0x46,
+    0x7a, 0x21, 0x78, 0x65, 0xa6, 0xe7, 0x1f, 0x32, 0xad, 0x6e, 0x96, 0xd9, 0xd6, 0xbb, 0xb0, 0x4b,
+    0x69, 0x46, 0x28, 0xb4, 0x36, 0x7e, 0x28, 0xe7, 0x9d, 0x89, 0xc1, 0xe0, 0x02, 0x0c, 0xf1, 0x23,
+    0x25, 0x0a, 0xeb, 0xb1, 0xf7, 0xf3, 0xb9, 0x92, 0x5a, 0x5c, 0x30, 0x3f, 0xec, 0x09, 0x65, 0x44,
+    0x1f, 0xa4, 0x49, 0x98, 0xf4, 0xdc, 0xa0, 0x1e, 0xce, 0x7f, 0x1d, 0x0c, 0x5a, 0x00, 0x1c, 0xdd,
+    0x03, 0x07, 0x07, 0xc9, 0xc2, 0x3f, 0xe0, 0x2f, 0xe7, 0x13, 0x5f, 0x65, 0x49, 0x84, 0x66, 0xc0,
+    0x46, 0x95, 0x45, 0x78, 0x0c, 0x82, 0xab, 0xa7, 0x97, 0x85, 0x98, 0xf3, 0x22, 0x3c, 0x82, 0x3c,
+    0xaa, 0x87, 0x3b, 0x8d, 0xf2, 0x5c, 0xed, 0x71, 0x10, 0x94, 0x0a, 0x4d, 0x9e, 0x69, 0x23, 0x6e,
+    0xc5, 0xce, 0xfa, 0xe1, 0xf1, 0x78, 0xec, 0x38, 0x00, 0xc4, 0xc0, 0x14, 0x4f, 0xa6, 0x06, 0x54,
+    0xa6, 0x86, 0xc3, 0x3f, 0xd8, 0x91, 0xab, 0x28, 0x11, 0x7f, 0x2a, 0xe5, 0xb1, 0x3e, 0x0b, 0x18,
+    0x9c, 0xa1, 0x72, 0x15, 0xfb, 0xb9, 0xde, 0x73, 0xcd, 0x86, 0x20, 0x3c, 0x64, 0x9c, 0x05, 0xe4,
+    0x3a, 0x84, 0x08, 0xbb, 0xe0, 0xa9, 0x50, 0x02, 0xc0, 0xd7, 0x85, 0xa2, 0xf3, 0x5c, 0x24, 0x99,
+    0x9e, 0xcb, 0x62, 0xe5, 0xb1, 0xe7, 0xb4, 0xd0, 0x67, 0x43, 0x58, 0x1a, 0xb2, 0x6b, 0xe6, 0xfb,
+    0x85, 0xb0, 0xeb, 0x42, 0x77, 0xf5, 0xb8, 0xed, 0xd7, 0xa5, 0x14, 0xe8, 0x99, 0x9c, 0x2a, 0x28,
+    0x84, 0x8e, 0x56, 0xa5, 0x02, 0x38, 0x27, 0xcf, 0x8b, 0x6c, 0x95, 0xc3, 0xed, 0x7f, 0xa4, 0xf9,
+    0xfe, 0x4b, 0xa9, 0x04, 0x0b, 0x70, 0x95, 0x9c, 0x05, 0x12, 0x67, 0xf5, 0x38, 0x94, 0x46, 0xcf,
+    0x10, 0x04, 0x1f, 0xeb, 0x5a, 0x4a, 0x6d, 0xe1, 0x9e, 0x02, 0x0b, 0xd7, 0x78, 0x10, 0x8a, 0x2f,
+    0x84, 0x7d, 0xa1, 0x60, 0x82, 0xb0, 0x85, 0x1a, 0x25, 0x2a, 0x32, 0xe6, 0x2f, 0x00, 0xe2, 0x9c,
+    0xcd, 0xcc, 0x76, 0x96, 0xb0, 0x96, 0x18, 0x9b, 0xe1, 0x6d, 0xf9, 0x47, 0x90, 0x73, 0x39, 0x01,
+    0x28, 0x27, 0xf8, 0x94, 0x59, 0x5e, 0x54, 0x2c, 0x82, 0x54, 0x82, 0xff, 0xeb, 0x4c, 0xf3, 0x60,
+    0x88, 0x81, 0x70, 0x0d, 0x4b, 0x23, 0x34, 0x74, 0x8a, 0xd7, 0x8d, 0x4a, 0xab, 0x09, 0xbf, 0x73,
+    0x1a, 0xda, 0x07, 0x87, 0xa9, 0x56, 0xe9, 0x44, 0x08, 0x79, 0xa2, 0x2f, 0x51, 0x32, 0xb9, 0x23,
+    0x7d, 0x45, 0x99, 0x72, 0x78, 0x47, 0x35, 0x66, 0xf5, 0xc1, 0xf1, 0x43, 0xa6, 0x21, 0xa6, 0xe3,
+    0x26, 0xec, 0x95, 0x6a, 0xed, 0x3e, 0xc7, 0x73, 0xea, 0xf5, 0x2a, 0x16, 0x05, 0x73, 0x41, 0x8b,
+    0xf3, 0xcb, 0xc8, 0xfc, 0x69, 0x6d, 0x21, 0xe3, 0x35, 0xf8, 0x9d, 0xad, 0xa4, 0x66, 0xfe, 0x60,
+    0xf0, 0x17, 0x49, 0xd1, 0xfa, 0x26, 0x52, 0x90, 0x96, 0x7f, 0xf0, 0xd6, 0x14, 0x08, 0xf9, 0x7e,
+    0xbd, 0xc6, 0xcb, 0xa9, 0xf0, 0x2b, 0x88, 0xd1, 0xee, 0x2c, 0xe2, 0xbf, 0x3a, 0x88, 0xd1, 0xee,
+    0x11, 0x62, 0xb4, 0x83, 0xe3, 0x77, 0x8d, 0x4f, 0x96, 0x22, 0xb9, 0x8b, 0x33, 0x00, 0xdc, 0x90,
+    0x0c, 0x8d, 0x05, 0x94, 0x92, 0x09, 0x14, 0x92, 0x31, 0x6b, 0xf2, 0xb6, 0xb5, 0x07, 0xac, 0xb0,
+    0x99, 0x66, 0x0f, 0x0f, 0x0d, 0x3c, 0x5f, 0xeb, 0x54, 0xcc, 0x21, 0xd7, 0x53, 0xc0, 0x61, 0xd5,
+    0x36, 0x07, 0x49, 0x12, 0x74, 0x94, 0x56, 0xbd, 0x1d, 0x49, 0x9d, 0xa8, 0x75, 0x2a, 0x4c, 0xe3,
+    0x40, 0xbf, 0xe0, 0x93, 0xb0, 0xd7, 0x71, 0x23, 0xb9, 0xe7, 0xd4, 0x8d, 0x42, 0x27, 0x59, 0x2a,
+    0xfe, 0xfe, 0xf8, 0xe6, 0x19, 0xc4, 0x79, 0xa6, 0xa1, 0xc4, 0x7a, 0x1b, 0x3f, 0x00, 0xd7, 0x56,
+    0x2a, 0xca, 0x52, 0xed, 0x1f, 0xe6, 0x59, 0xe1, 0xa1, 0xcb, 0xee, 0xc4, 0xbe, 0x2f, 0x75, 0xbf,
+    0xb3, 0x06, 0xb2, 0x30, 0x7d, 0xce, 0x8c, 0xa6, 0x20, 0xb4, 0x36, 0x7c, 0x02, 0xe1, 0x2f, 0x58,
+    0x39, 0x9a, 0x73, 0xb8, 0xfe, 0x70, 0x56, 0x4b, 0xb3, 0x78, 0x22, 0x4d, 0x30, 0xdf, 0x56, 0x0a,
+    0x12, 0xa8, 0xe7, 0x5c, 0xa0, 0xca, 0xd4, 0x8b, 0xad, 0x0e, 0x6c, 0x04, 0xa9, 0x71, 0xf6, 0x9e,
+    0x60, 0xf5, 0x6b, 0x57, 0xe4, 0x52, 0x10, 0xb7, 0x96, 0xd1, 0xf2, 0x28, 0x15, 0xa8, 0xe2, 0xa3,
+    0x49, 0xfe, 0x01, 0xed, 0x32, 0x76, 0xaf, 0xc4, 0x28, 0x8e, 0x92, 0xbb, 0x45, 0x91, 0x81, 0x7b,
+    0x6f, 0xe4, 0xff, 0x04, 0x6f, 0xa2, 0xed, 0xb2, 0x0a, 0xdb, 0x9f, 0x26, 0xe3, 0xf1, 0xcf, 0x55,
+    0xc8, 0xd5, 0xb3, 0x43, 0xf6, 0x63, 0x1f, 0x16, 0x7e, 0x64, 0xa1, 0x53, 0xec, 0x12, 0x68, 0xc8,
+    0x66, 0xb0, 0x99, 0xf9, 0xad, 0xa0, 0xa4, 0xaf, 0xae, 0x25, 0xdb, 0xa5, 0x10, 0xca, 0x19, 0x82,
+    0xf7, 0x2a, 0xf8, 0x56, 0xea, 0x34, 0xdb, 0x8e, 0xc4, 0x06, 0x0e, 0x12, 0x36, 0x16, 0xf0, 0x77,
+    0x91, 0x5d, 0x8e, 0x8c, 0x5c, 0x68, 0x4f, 0x8c, 0xa0, 0x4e, 0xda, 0xe8, 0xbf, 0x0f, 0x0f, 0xf8,
+    0x65, 0x23, 0xa9, 0xf0, 0x8b, 0x80, 0x9e, 0xe3, 0x82, 0xff, 0x53, 0x2b, 0x35, 0x8c, 0x15, 0x79,
+    0xe7, 0xf4, 0x26, 0xda, 0x08, 0x2c, 0x93, 0x58, 0xc8, 0x0e, 0x75, 0x49, 0x1b, 0xb9, 0xe2, 0x70,
+    0x7a, 0x4f, 0x66, 0x1d, 0xaf, 0xde, 0xa4, 0x27, 0xa2, 0x38, 0x29, 0xb1, 0x23, 0x93, 0x8d, 0x23,
+    0x28, 0x3f, 0xf8, 0xf7, 0xb9, 0x98, 0x47, 0x6b, 0x65, 0xbb, 0x10, 0xd8, 0xad, 0x6f, 0xa3, 0x18,
+    0x5c, 0x11, 0x07, 0xe8, 0xcd, 0x58, 0xdd, 0xb9, 0x73, 0xee, 0x78, 0x4d, 0x19, 0x08, 0x58, 0xe0,
+    0xa7, 0x79, 0xba, 0x7f, 0x56, 0xd5, 0x54, 0x0f, 0x45, 0x81, 0x3a, 0x94, 0xf1, 0x26, 0x81, 0x65,
+    0xc8, 0x3f, 0x76, 0x23, 0x25, 0xf4, 0xc2, 0x2e, 0x43, 0x39, 0x1c, 0xfa, 0xbb, 0x4f, 0xf2, 0x4b,
+    0xe9, 0xb8, 0x54, 0x1a, 0x68, 0x60, 0x7b, 0x28, 0x4f, 0xe0, 0x7f, 0x48, 0xc8, 0xca, 0xff, 0xb1,
+    0x7f, 0x2a, 0x10, 0x43, 0x1b, 0xbd, 0x03, 0x89, 0x7f, 0xa0, 0xdf, 0xea, 0xa6, 0xc2, 0xff, 0x63,
+    0x4b, 0x9a, 0x10, 0xa2, 0xca, 0x80, 0x20, 0x8f, 0x17, 0x9e, 0x5c, 0x45, 0x57, 0xe9, 0x2f, 0xbf,
+    0xb1, 0xd3, 0xcb, 0x06, 0x36, 0xb5, 0x75, 0xa1, 0x50, 0xd6, 0xa0, 0x76, 0x87, 0xc1, 0xd5, 0x99,
+    0xd4, 0x39, 0xf3, 0x9b, 0x80, 0xdd, 0xca, 0xd4, 0x2e, 0xb9, 0xd7, 0x04, 0x6a, 0x69, 0xd5, 0xf0,
+    0x0a, 0x22, 0xf5, 0x0a, 0xe2, 0x32, 0xdf, 0x9d, 0x53, 0xd2, 0x84, 0x1b, 0x94, 0x73, 0xde, 0xc4,
+    0x2c, 0x65, 0x67, 0x08, 0x73, 0x65, 0xc8, 0x7a, 0x65, 0x1c, 0xd5, 0x33, 0xfe, 0xf0, 0xb4, 0x8c,
+    0x8f, 0x6c, 0xf6, 0x52, 0xee, 0x44, 0xea, 0x9d, 0x56, 0x63, 0x47, 0x3a, 0x05, 0x51, 0xb9, 0x17,
+    0x18, 0x1f, 0x1e, 0x73, 0x49, 0xc7, 0x9c, 0x06, 0xf4, 0x48, 0x64, 0x93, 0xa5, 0x5b, 0x13, 0xa7,
+    0x81, 0xe7, 0x28, 0x0d, 0x30, 0x8c, 0x00, 0xd9, 0x0c, 0x50, 0x95, 0x1e, 0xfd, 0xe5, 0xf4, 0x3b,
+    0x02, 0x67, 0x42, 0x00, 0xb2, 0xcf, 0x13, 0x00, 0xab, 0x38, 0x4c, 0x39, 0x17, 0x30, 0x6a, 0xcf,
+    0x38, 0xe3, 0xee, 0xe2, 0xa2, 0xdc, 0xe3, 0x46, 0x15, 0x1d, 0x20, 0x77, 0x02, 0xd9, 0x28, 0xdd,
+    0xd9, 0x88, 0x93, 0x43, 0x0f, 0x3d, 0x5a, 0xb2, 0x62, 0x55, 0x37, 0x7d, 0x03, 0x3e, 0xf6, 0xc9,
+    0x18, 0x87, 0x07, 0x43, 0xaa, 0xc1, 0x17, 0x28, 0x05, 0x0e, 0x3b, 0x95, 0x1d, 0x22, 0x01, 0x40,
+    0x49, 0x67, 0x0e, 0x2c, 0x0f, 0x06, 0xf8, 0x5b, 0xf5, 0x95, 0x22, 0x4a, 0x65, 0xc6, 0xdc, 0xc6,
+    0xaa, 0x11, 0x41, 0x4b, 0x00, 0xc2, 0x64, 0xa5, 0x86, 0x22, 0x71, 0xac, 0xc1, 0x1f, 0x1e, 0x2e,
+    0x08, 0xa7, 0x5a, 0x0a, 0x7b, 0x66, 0x2b, 0xe1, 0xe6, 0xbc, 0x1a, 0x0e, 0xec, 0x4d, 0x22, 0x23,
+    0xd8, 0x52, 0xa6, 0xa9, 0xd0, 0x6c, 0x4a, 0xae, 0x05, 0x87, 0x71, 0x92, 0x20, 0xcf, 0x5d, 0x37,
+    0x9f, 0x53, 0x44, 0xeb, 0x82, 0x90, 0xe3, 0x4b, 0x90, 0x99, 0xa3, 0x9d, 0x6c, 0x8a, 0x7c, 0x14,
+    0x8f, 0xcb, 0xa1, 0x3d, 0x9e, 0x21, 0xa5, 0x31, 0xf0, 0xda, 0xbb, 0xb0, 0xdc, 0x43, 0x1c, 0x98,
+    0x4d, 0x1d, 0x15, 0x06, 0x2d, 0x74, 0xe8, 0xb3, 0x1d, 0x90, 0xf4, 0x41, 0x15, 0xf9, 0x1e, 0xa2,
+    0x23, 0x76, 0x70, 0x16, 0xf4, 0x44, 0x8b, 0xe9, 0x35, 0xe7, 0x08, 0xea, 0xdb, 0x45, 0x9a, 0x77,
+    0xb6, 0x45, 0x94, 0xca, 0x6a, 0x8a, 0xf7, 0x6d, 0x8b, 0xc2, 0x63, 0xc7, 0x82, 0x92, 0xbb, 0xb6,
+    0x4c, 0xa8, 0xd8, 0x2c, 0x1d, 0xf0, 0xbb, 0x0a, 0xd1, 0xac, 0x8a, 0x5a, 0x50, 0xe4, 0x5c, 0x7f,
+    0x53, 0xfd, 0x74, 0x7c, 0x6a, 0x80, 0xc0, 0xf6, 0x31, 0xc5, 0x5f, 0xa7, 0xb1, 0xb3, 0x48, 0xa4,
+    0x92, 0x4d, 0x4f, 0x1e, 0x5e, 0xe4, 0x5a, 0x27, 0x77, 0xec, 0x80, 0xd5, 0xd4, 0x67, 0xda, 0xa7,
+    0xb1, 0x0b, 0xbf, 0x69, 0x27, 0xfa, 0xca, 0x14, 0x76, 0xd7, 0xda, 0xde, 0x6c, 0x80, 0x96, 0x27,
+    0xf6, 0x12, 0x6b, 0x6b, 0xa3, 0x10, 0x9e, 0x65, 0xc5, 0xfe, 0x86, 0x56, 0x20, 0x95, 0xd8, 0x93,
+    0xfa, 0xf0, 0x55, 0xc3, 0x6b, 0xd9, 0x42, 0x30, 0xfd, 0x9a, 0x36, 0x4d, 0x0f, 0x65, 0x4a, 0x74,
+    0x29, 0x74, 0x12, 0xe9, 0x4d, 0x64, 0x98, 0xab, 0x4c, 0xb1, 0x58, 0x48, 0xcd, 0x19, 0x7e, 0x26,
+    0x9b, 0x32, 0xb3, 0x3e, 0xff, 0xd0, 0xba, 0xe1, 0xcf, 0x3f, 0xf8, 0x44, 0x51, 0x93, 0x1d, 0x4f,
+    0x36, 0x58, 0xc4, 0x9f, 0x41, 0x7e, 0xc0, 0x8b, 0x07, 0xa4, 0xae, 0x52, 0x5c, 0x64, 0x21, 0x5d,
+    0x1d, 0x01, 0x0d, 0xd1, 0x47, 0x04, 0xef, 0x8e, 0x07, 0x57, 0xed, 0xb8, 0x1e, 0xa1, 0x69, 0x2d,
+    0x8a, 0xd7, 0xb7, 0xef, 0xde, 0x3a, 0x93, 0xab, 0x7b, 0x4b, 0x5d, 0x43, 0x9b, 0x56, 0xb6, 0x62,
+    0x92, 0xe0, 0xc3, 0xad, 0xb0, 0xe6, 0xdf, 0xd2, 0x2e, 0x81, 0xe1, 0x2f, 0x72, 0x95, 0x2d, 0xe0,
+    0x29, 0x73, 0xe8, 0xc2, 0x0c, 0x1d, 0x4e, 0x7b, 0x1f, 0x1e, 0xaf, 0x94, 0xa6, 0x39, 0x93, 0x14,
+    0x99, 0x52, 0xb7, 0x59, 0xce, 0x5b, 0xc3, 0xd7, 0x42, 0x2e, 0x96, 0xb6, 0x6d, 0xd9, 0xa3, 0x8b,
+    0x3c, 0x7e, 0x35, 0xf7, 0x0b, 0xaa, 0xad, 0xd3, 0x86, 0xdb, 0x50, 0x5d, 0xea, 0xb8, 0xb1, 0xe4,
+    0xee, 0xd3, 0xba, 0xd5, 0xb4, 0x45, 0x4e, 0x9f, 0x89, 0x18, 0xdb, 0x2f, 0x33, 0x08, 0x76, 0x78,
+    0x00, 0xd1, 0x6b, 0xcb, 0xd5, 0x73, 0xb5, 0x32, 0xcd, 0x3b, 0x68, 0x24, 0xca, 0xbe, 0x49, 0x8e,
+    0xb8, 0x37, 0xd4, 0xf2, 0x5a, 0x7d, 0x32, 0x00, 0x71, 0x78, 0xbc, 0xae, 0x38, 0x6e, 0xfb, 0x04,
+    0x85, 0xf5, 0x4b, 0x48, 0xad, 0x0d, 0x86, 0x55, 0xc9, 0xa1, 0x4a, 0x85, 0xeb, 0x2d, 0xe6, 0x8c,
+    0xa3, 0x33, 0x8c, 0x1d, 0xa7, 0x2b, 0xc6, 0x3e, 0x99, 0x8e, 0xc3, 0xde, 0xbd, 0x19, 0xf2, 0x0a,
+    0xea, 0xeb, 0x64, 0x79, 0xc8, 0x06, 0x0c, 0xa9, 0x6c, 0x95, 0xaf, 0x18, 0x3b, 0x90, 0xa9, 0xf7,
+    0xd0, 0x31, 0x20, 0x69, 0x85, 0x37, 0x0e, 0x2e, 0x27, 0xbe, 0x7b, 0x32, 0x76, 0x6f, 0x40, 0xec,
+    0x45, 0xd3, 0x28, 0x73, 0xe2, 0x6f, 0x48, 0x75, 0x64, 0xb6, 0x36, 0x25, 0x5f, 0xb8, 0x91, 0x31,
+    0x3c, 0xf9, 0x17, 0x61, 0x2f, 0x77, 0xf6, 0xe6, 0x95, 0xd9, 0x18, 0x87, 0xa0, 0x24, 0x87, 0xe0,
+    0xde, 0x66, 0x05, 0xd4, 0x52, 0x37, 0x13, 0xf6, 0x9a, 0xd6, 0x9d, 0x64, 0x2a, 0x2b, 0x1e, 0xed,
+    0x78, 0x12, 0xc7, 0x31, 0x48, 0x3f, 0x99, 0xfc, 0x32, 0xf9, 0x7d, 0x12, 0x75, 0x7a, 0x77, 0x7d,
+    0xeb, 0x07, 0xd7, 0xc2, 0xfa, 0x67, 0x08, 0xcc, 0xd3, 0xbd, 0x23, 0x6b, 0x1d, 0xbe, 0x97, 0xc6,
+    0xb7, 0x0b, 0xe5, 0xf9, 0x54, 0xc5, 0xe6, 0x2a, 0x5a, 0x54, 0x0f, 0xd4, 0x34, 0x32, 0xcb, 0xf7,
+    0x1b, 0x7c, 0xcc, 0x9d, 0x90, 0xa4, 0x9a, 0x25, 0x7d, 0x4f, 0x10, 0xd1, 0xae, 0x1d, 0xe7, 0x9a,
+    0xd6, 0xcc, 0xaa, 0xb5, 0xe9, 0x26, 0x8d, 0xeb, 0x3d, 0x4a, 0xcc, 0x6d, 0xb9, 0xe1, 0xf2, 0xea,
+    0xb7, 0x31, 0x10, 0x13, 0x7a, 0x72, 0xb5, 0xb9, 0x62, 0xf9, 0x7f, 0x2e, 0xa6, 0xe2, 0x9a, 0x0c,
+    0x66, 0x9e, 0x12, 0x6a, 0x05, 0x52, 0x60, 0x82, 0x70, 0xa8, 0xaa, 0x6e, 0xff, 0x25, 0xe1, 0xb4,
+    0x31, 0x20, 0xc3, 0x9e, 0x29, 0x11, 0x15, 0x27, 0x8c, 0xb5, 0xc9, 0x70, 0xc6, 0xba, 0xd2, 0xb7,
+    0xd9, 0x62, 0x51, 0x72, 0x61, 0x18, 0xb5, 0x9e, 0xf8, 0x30, 0x72, 0x99, 0xeb, 0xd5, 0x5f, 0x4d,
+    0x0e, 0x5f, 0x97, 0x5f, 0x33, 0x6d, 0xc0, 0x8c, 0x72, 0x16, 0xec, 0xf8, 0x3f, 0x62, 0xf4, 0xb2,
+    0x8f, 0x79, 0x13, 0x00, 0x00,
+};
+
+// GP_JS_CANVAS: 693 -> 417 bytes
+const uint8_t GP_JS_CANVAS_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x52, 0x51, 0x6b, 0xdb, 0x30,
+    0x10, 0x7e, 0xf7, 0xaf, 0xc8, 0x9b, 0x2c, 0x3c, 0xc2, 0xfa, 0xb0, 0x97, 0x0a, 0x77, 0xb4, 0x61,
+    0x8c, 0x8e, 0xd2, 0x96, 0xae, 0xb0, 0x8d, 0x10, 0xc6, 0x45, 0x3e, 0x27, 0xa2, 0xb2, 0xe4, 0x9d,
+    0xe4, 0xb4, 0x5b, 0xc8, 0x7f, 0xdf, 0xc9, 0x16, 0x0e, 0xf4, 0xc5, 0xf7, 0x7d, 0xdf, 0xdd, 0x77,
+    0xba, 0xb3, 0x54, 0xb4, 0x83, 0xd3, 0xd1, 0x78, 0xb7, 0xf8, 0xfa, 0xf8, 0x5b, 0x83, 0x3b, 0x40,
+    0x28, 0x43, 0x24, 0x79, 0x3c, 0x00, 0x2d, 0x74, 0xd7, 0xd4, 0x42, 0xa8, 0x22, 0x61, 0x20, 0xaa,
+    0xd7, 0xa2, 0x35, 0xd6, 0x7e, 0x8f, 0x7f, 0x2d, 0x8a, 0x0f, 0x82, 0xcb, 0xfc, 0x0b, 0xce, 0x6c,
+    0x0f, 0x8d, 0x7f, 0x5d, 0x79, 0xeb, 0x69, 0x66, 0x37, 0x76, 0x38, 0x93, 0x87, 0xb6, 0x0d, 0x18,
+    0x7f, 0xbe, 0xe3, 0xbf, 0x98, 0x5b, 0xe3, 0x70, 0x05, 0x7d, 0x46, 0xdf, 0xbc, 0x71, 0x19, 0xfe,
+    0x30, 0x4d, 0xdc, 0x33, 0xee, 0x4c, 0x44, 0xba, 0x33, 0x1c, 0x98, 0xb4, 0xde, 0xa5, 0x10, 0xf1,
+    0x2d, 0x5e, 0x5b, 0xb3, 0x73, 0x19, 0xdf, 0x40, 0xc0, 0xe4, 0x61, 0xba, 0xb3, 0x7e, 0x0b, 0xf6,
+    0xda, 0xf6, 0x7b, 0x98, 0xd9, 0xca, 0x77, 0xbd, 0x0f, 0xdc, 0xe7, 0xa1, 0x47, 0x82, 0xb4, 0x30,
+    0xa7, 0x08, 0xf5, 0xd8, 0x91, 0x97, 0x7a, 0x9a, 0xe0, 0xb4, 0x53, 0x26, 0xda, 0x22, 0xd0, 0xd3,
+    0xb9, 0x66, 0xce, 0x33, 0xd8, 0xe2, 0xce, 0xb8, 0x47, 0x98, 0xc6, 0xf3, 0x07, 0x7c, 0xf6, 0xa3,
+    0xc1, 0x07, 0xcc, 0x62, 0x9a, 0x25, 0x8b, 0x26, 0xad, 0xf6, 0x67, 0x80, 0x26, 0x1d, 0xac, 0x57,
+    0x03, 0xe5, 0xf2, 0x2d, 0xfe, 0x33, 0x48, 0x67, 0x0e, 0xa4, 0xa7, 0xef, 0xc8, 0x82, 0x86, 0xf1,
+    0xc7, 0x92, 0x8f, 0x10, 0x13, 0x88, 0x04, 0x2e, 0xd8, 0x09, 0xa7, 0x71, 0x9e, 0x79, 0xeb, 0x79,
+    0xa4, 0x4c, 0xf8, 0x88, 0xd7, 0xdb, 0x0e, 0x76, 0xe3, 0x8d, 0xc0, 0x61, 0xf4, 0x63, 0x88, 0x9e,
+    0x50, 0x6c, 0x0a, 0xae, 0x5c, 0x86, 0xde, 0x9a, 0x58, 0x0a, 0x25, 0xe4, 0xb2, 0xf5, 0xf4, 0x05,
+    0xf4, 0xbe, 0xe4, 0xfb, 0x96, 0xf5, 0xd5, 0xb1, 0x30, 0x2d, 0xa3, 0xa5, 0x71, 0xda, 0x0e, 0x0d,
+    0x86, 0x52, 0x5c, 0x5e, 0x0a, 0x29, 0x8f, 0xec, 0xaa, 0x59, 0xce, 0xbe, 0xa4, 0xa9, 0xf1, 0x69,
+    0xb8, 0xa1, 0xab, 0xef, 0x87, 0x6e, 0x8b, 0xc4, 0xae, 0xf5, 0xc7, 0x8d, 0x54, 0x05, 0x3f, 0x97,
+    0xaa, 0x16, 0xfa, 0x6d, 0x29, 0x2a, 0x7e, 0x2d, 0xeb, 0x54, 0xb2, 0xa9, 0xca, 0x32, 0xc5, 0xab,
+    0xfa, 0xe2, 0x93, 0xfc, 0x2c, 0xb8, 0x81, 0xa8, 0x85, 0xac, 0xd8, 0x71, 0xf1, 0x2e, 0x25, 0x15,
+    0xe7, 0x78, 0x2c, 0x55, 0x9c, 0xd0, 0x06, 0x5c, 0x8c, 0xcd, 0x42, 0xac, 0x58, 0x53, 0x27, 0xa9,
+    0x08, 0xe3, 0x40, 0x2e, 0xa9, 0xea, 0x54, 0xfc, 0x07, 0xad, 0x37, 0xa0, 0x89, 0xb5, 0x02, 0x00,
+    0x00,
+};
+
+// GP_LIGHT: 9653 -> 2789 bytes
+const uint8_t GP_LIGHT_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1a, 0xdb, 0x6e, 0xe3, 0xb8,
+    0xf5, 0x3d, 0x5f, 0xa1, 0x6e, 0x10, 0x78, 0xd2, 0xb5, 0x3c, 0x92, 0x25, 0xd9, 0x8e, 0x8c, 0x09,
+    0xb6, 0x59, 0xa0, 0xe8, 0x43, 0x9f, 0x8a, 0x41, 0x51, 0x60, 0x31, 0x18, 0x50, 0x12, 0x6d, 0xb3,
+    0xd1, 0x0d, 0x12, 0x1d, 0x27, 0x11, 0xf2, 0xef, 0x3d, 0xbc, 0x49, 0x24, 0x25, 0x25, 0xb3, 0x0b,
+    0xb4, 0x28, 0x32, 0x71, 0x64, 0xf1, 0xf0, 0xf0, 0xdc, 0x6f, 0x9c, 0xab, 0xba, 0xcb, 0x48, 0x5b,
+    0xe7, 0xe8, 0x25, 0x26, 0x65, 0x4e, 0x4a, 0xbc, 0x7f, 0xbb, 0x5a, 0x15, 0x88, 0x94, 0x49, 0x5e,
+    0xa5, 0x8f, 0x5d, 0x81, 0x9a, 0x23, 0x29, 0x63, 0x74, 0xa6, 0xd5, 0xbe, 0x40, 0xcf, 0xee, 0x85,
+    0x64, 0xf4, 0x14, 0xfb, 0x9e, 0x77, 0xf3, 0x76, 0x85, 0x96, 0x28, 0x7e, 0x22, 0x2d, 0xa1, 0x38,
+    0xeb, 0xd2, 0x2a, 0xaf, 0x9a, 0xf8, 0x3a, 0x0c, 0x43, 0x78, 0x1f, 0x9f, 0xaa, 0x27, 0xdc, 0xa8,
+    0x77, 0xdb, 0xed, 0xf6, 0xed, 0x2a, 0xa9, 0xb2, 0x97, 0xee, 0x50, 0x95, 0xd4, 0x3d, 0xa0, 0x82,
+    0xe4, 0x2f, 0xf1, 0x3f, 0x71, 0x93, 0xa1, 0x12, 0xed, 0xc5, 0x01, 0x2e, 0xad, 0xea, 0xd8, 0x8f,
+    0xea, 0x67, 0x38, 0xfd, 0xd4, 0x74, 0xe2, 0x94, 0xbb, 0xe8, 0x46, 0x2e, 0xc7, 0xb0, 0xe2, 0x78,
+    0x6c, 0x6d, 0xad, 0x28, 0xda, 0xc9, 0x37, 0x6d, 0x8d, 0x4a, 0x81, 0xb8, 0x25, 0xaf, 0x38, 0xf6,
+    0x37, 0x1c, 0x47, 0x8e, 0x12, 0x9c, 0x77, 0x97, 0x13, 0xd0, 0xe6, 0x02, 0x44, 0x8a, 0xe3, 0xb2,
+    0xba, 0x34, 0xa8, 0xde, 0x0f, 0x90, 0x6b, 0x0f, 0x20, 0x25, 0x32, 0xcf, 0x11, 0x47, 0xaf, 0xd2,
+    0x13, 0x6a, 0xe8, 0x03, 0xe7, 0x3c, 0xa9, 0x9a, 0x0c, 0x37, 0x6e, 0x83, 0x32, 0x72, 0x6e, 0x81,
+    0xe3, 0x01, 0x3a, 0x80, 0x47, 0x49, 0xa1, 0x77, 0xc3, 0x76, 0x1d, 0x1b, 0x92, 0xf5, 0x52, 0x3c,
+    0xe4, 0xf8, 0x79, 0xff, 0xef, 0x73, 0x4b, 0xc9, 0xe1, 0xc5, 0x4d, 0xe1, 0x38, 0x5c, 0xd2, 0x98,
+    0xd3, 0xe0, 0x26, 0x98, 0x5e, 0x30, 0x2e, 0x61, 0xcb, 0x35, 0xdb, 0xe2, 0xac, 0x84, 0x8c, 0x07,
+    0x99, 0xaa, 0x13, 0xf8, 0x69, 0x80, 0x98, 0xaf, 0x3f, 0xa0, 0x16, 0x77, 0x35, 0xca, 0x32, 0x52,
+    0x1e, 0xb9, 0x8c, 0x1c, 0xdf, 0x1f, 0x88, 0x61, 0x6c, 0x38, 0x06, 0xfc, 0x14, 0xe5, 0x09, 0x4a,
+    0x1f, 0x8f, 0x4d, 0x75, 0x2e, 0x33, 0x57, 0x6a, 0xe5, 0xb0, 0x66, 0x3f, 0xfb, 0xa4, 0x7a, 0x76,
+    0xdb, 0x13, 0xca, 0xaa, 0x4b, 0x7c, 0x8d, 0x10, 0x72, 0x18, 0xb6, 0x11, 0xc6, 0xaf, 0x28, 0x51,
+    0x04, 0x70, 0x45, 0xe9, 0x6b, 0x7f, 0xc3, 0x08, 0x0e, 0xd3, 0x34, 0xb0, 0x5e, 0xc3, 0xaa, 0x3a,
+    0xe4, 0x70, 0xd8, 0x8f, 0xa9, 0xe1, 0xc8, 0xd5, 0x49, 0x13, 0xa4, 0x85, 0x29, 0x3a, 0x44, 0xde,
+    0x5e, 0xb1, 0xbc, 0x91, 0x80, 0xbd, 0xae, 0x5c, 0xc6, 0xbf, 0x40, 0xc2, 0x1f, 0x19, 0x2d, 0xf4,
+    0x44, 0x4a, 0xa9, 0xb7, 0x1e, 0x1f, 0xe8, 0x1c, 0xcc, 0x59, 0x9c, 0x1f, 0x03, 0x55, 0x4e, 0x5b,
+    0xe5, 0x20, 0xf5, 0xeb, 0x20, 0x0d, 0xbd, 0x70, 0xa7, 0xb3, 0xce, 0x01, 0x25, 0x96, 0xaf, 0xf8,
+    0x99, 0xf6, 0xe2, 0xee, 0x45, 0xa1, 0x61, 0x65, 0x5c, 0x31, 0xc6, 0x24, 0xb5, 0x12, 0x9b, 0x65,
+    0x58, 0x0a, 0x19, 0x48, 0x6e, 0x86, 0x20, 0xfe, 0x2c, 0x71, 0xdc, 0xa5, 0x77, 0x18, 0xf9, 0xba,
+    0x2f, 0xb8, 0xfe, 0xb6, 0x67, 0xd9, 0x4d, 0x2a, 0x4a, 0xab, 0x82, 0x39, 0xc1, 0x5e, 0x59, 0x19,
+    0x97, 0x3d, 0x3b, 0x45, 0x38, 0x6d, 0x63, 0x9a, 0x1f, 0xfb, 0x70, 0x33, 0xd2, 0xe0, 0x94, 0x92,
+    0xaa, 0x8c, 0x9b, 0xea, 0xb2, 0x47, 0x39, 0x39, 0x96, 0xbd, 0x3d, 0xa6, 0xf0, 0x81, 0x1b, 0x01,
+    0xc7, 0xfc, 0x42, 0xb9, 0x87, 0x80, 0x02, 0xaf, 0x29, 0x5a, 0x05, 0xf3, 0x76, 0x45, 0xca, 0xfa,
+    0x4c, 0x7f, 0xa3, 0x2f, 0x35, 0xfe, 0x52, 0x9e, 0x8b, 0x04, 0x37, 0xdf, 0x96, 0xda, 0x2b, 0x0a,
+    0xf2, 0x32, 0x5e, 0xd4, 0xa8, 0x6d, 0x2f, 0xc0, 0xa3, 0xf1, 0x32, 0x43, 0x14, 0x9b, 0xdb, 0x48,
+    0x61, 0xbe, 0xe0, 0xa2, 0x30, 0xdf, 0x9c, 0x70, 0xfa, 0x08, 0x5a, 0xfa, 0xb6, 0x6c, 0x71, 0x0e,
+    0xac, 0x2c, 0xd9, 0x51, 0xa8, 0xc1, 0xa8, 0xbb, 0x1a, 0xdc, 0x6f, 0x08, 0x4a, 0x6b, 0x8f, 0x2b,
+    0xca, 0x30, 0x37, 0x88, 0x12, 0xbd, 0x1d, 0x05, 0x4a, 0x97, 0x10, 0x9b, 0x28, 0x49, 0x51, 0xee,
+    0x72, 0x6e, 0xe3, 0x82, 0x64, 0x59, 0x8e, 0xf7, 0x75, 0x05, 0x91, 0x8c, 0x4b, 0x0b, 0xe7, 0x88,
+    0x92, 0x27, 0xac, 0x0c, 0x8e, 0xd9, 0x5f, 0x08, 0xdb, 0x2c, 0x0d, 0x9f, 0x30, 0x39, 0x9e, 0x68,
+    0x1c, 0xb2, 0xe7, 0xf4, 0xdc, 0xb4, 0xa0, 0xc7, 0xba, 0x22, 0x5c, 0x64, 0x52, 0xc3, 0xfe, 0x60,
+    0x72, 0x69, 0x9a, 0x9a, 0x82, 0x9c, 0x96, 0x87, 0x0a, 0x05, 0x3b, 0x61, 0x42, 0x23, 0xe9, 0xc8,
+    0xf5, 0x9d, 0x7d, 0xbe, 0x09, 0xaa, 0xc4, 0x26, 0xa1, 0xd7, 0xdb, 0x01, 0x7a, 0x3d, 0xb6, 0x2a,
+    0x7f, 0x84, 0xe0, 0xf7, 0x29, 0xd9, 0xd6, 0x8d, 0x99, 0x4d, 0x5c, 0x61, 0xa8, 0xd3, 0x12, 0x19,
+    0xeb, 0x8a, 0xfb, 0x24, 0x79, 0x65, 0xea, 0x92, 0x8b, 0xf0, 0x46, 0x89, 0x97, 0x27, 0xa1, 0xb7,
+    0xab, 0xfe, 0x24, 0xc1, 0xde, 0x64, 0x6a, 0xd2, 0x28, 0x6d, 0xcf, 0x49, 0x41, 0x4c, 0xe2, 0x93,
+    0x33, 0x70, 0x5e, 0x7e, 0x5b, 0x8a, 0xbf, 0x9d, 0x94, 0x4d, 0x14, 0x99, 0x4a, 0x0e, 0x8d, 0x30,
+    0x3f, 0x9c, 0x10, 0x78, 0x5a, 0x34, 0x62, 0x69, 0x28, 0x9a, 0x8e, 0x62, 0xbf, 0xfe, 0xe5, 0xaf,
+    0x10, 0xc5, 0x74, 0x6f, 0x1f, 0xf3, 0x2b, 0x60, 0x79, 0x9e, 0xb2, 0x8d, 0x68, 0x14, 0x82, 0xa6,
+    0xb8, 0x12, 0x99, 0x76, 0x82, 0x37, 0xb9, 0x20, 0xbe, 0xc9, 0x7c, 0x7c, 0x20, 0x39, 0x20, 0x8e,
+    0x93, 0x86, 0xb1, 0x5b, 0xe2, 0xb6, 0xfd, 0xe4, 0xad, 0xee, 0xa2, 0x5b, 0x13, 0xb1, 0x25, 0x1b,
+    0x23, 0xac, 0x4c, 0x44, 0x07, 0x3b, 0xd1, 0x4d, 0x05, 0x0d, 0x45, 0x2b, 0x4a, 0x99, 0x5b, 0x4d,
+    0x11, 0x2b, 0x57, 0x24, 0xb5, 0xe2, 0x5b, 0xa7, 0xc5, 0x67, 0x52, 0xb6, 0x98, 0x8a, 0xbc, 0x04,
+    0xbf, 0xcc, 0x21, 0xaf, 0x3d, 0xcf, 0xdb, 0xb2, 0xf4, 0xcf, 0xad, 0x4f, 0x33, 0x05, 0x08, 0x89,
+    0x39, 0xd4, 0x23, 0x52, 0x3d, 0x77, 0x5a, 0x2a, 0x83, 0xd7, 0x31, 0x3a, 0x00, 0x75, 0xca, 0x2f,
+    0x34, 0x2f, 0x5a, 0x8f, 0x43, 0x07, 0xdf, 0xc6, 0x43, 0x31, 0x33, 0x84, 0x1c, 0x1f, 0x68, 0xec,
+    0xb2, 0xcc, 0x3f, 0x8e, 0x13, 0x8a, 0xf7, 0xc5, 0x62, 0x3f, 0x6d, 0xfc, 0x23, 0xdb, 0x08, 0x82,
+    0x60, 0x3f, 0xc9, 0x5e, 0x30, 0x24, 0x46, 0x87, 0xe5, 0x99, 0x48, 0xd0, 0xbd, 0x6a, 0x80, 0x76,
+    0xee, 0xd7, 0x3d, 0x0f, 0x63, 0xa4, 0x99, 0xe7, 0xcd, 0x23, 0x65, 0xc8, 0xb6, 0x4b, 0x3d, 0xbb,
+    0x73, 0x51, 0x5e, 0x1f, 0x3c, 0x2f, 0x91, 0xc2, 0x81, 0x32, 0x06, 0x8a, 0x93, 0x0f, 0x8f, 0x09,
+    0xd2, 0x3f, 0x70, 0x4c, 0x98, 0x79, 0x3b, 0x79, 0x4c, 0x39, 0xa3, 0x9b, 0xf2, 0xff, 0x45, 0x39,
+    0x96, 0x1c, 0x9d, 0xdf, 0x2d, 0xc8, 0xff, 0xb2, 0x0c, 0x0b, 0x52, 0x92, 0x07, 0xe1, 0x9d, 0xf0,
+    0xe8, 0xea, 0x79, 0x40, 0x3e, 0x33, 0x3f, 0xf8, 0x13, 0x29, 0xea, 0xaa, 0xa1, 0xa8, 0xa4, 0x56,
+    0xe2, 0xd2, 0x16, 0x06, 0xaf, 0xd1, 0x5e, 0xc2, 0x09, 0xed, 0x85, 0xd0, 0xf4, 0xd4, 0x69, 0xc5,
+    0xa8, 0xb3, 0x16, 0x71, 0x8e, 0xfd, 0x9d, 0x10, 0xf2, 0xa4, 0x64, 0x05, 0xf6, 0x8d, 0x46, 0x57,
+    0x00, 0xca, 0xea, 0xd1, 0x3b, 0x3c, 0x0e, 0x74, 0x15, 0x54, 0xc6, 0x84, 0xbe, 0xc4, 0x9e, 0x84,
+    0xf7, 0x14, 0xb0, 0xc7, 0x20, 0x21, 0x55, 0x30, 0x01, 0x1a, 0xba, 0x67, 0x58, 0x06, 0x1a, 0x50,
+    0x02, 0x09, 0xe5, 0x3c, 0x0e, 0x9f, 0xdc, 0x38, 0x22, 0x65, 0x1c, 0xde, 0xbe, 0x11, 0x48, 0xf7,
+    0x5a, 0x2d, 0x35, 0xd6, 0x0b, 0x4b, 0x4a, 0xee, 0x05, 0x27, 0x8f, 0x84, 0xba, 0xb4, 0x41, 0xa5,
+    0x3c, 0x63, 0xe5, 0xb7, 0x7b, 0xf3, 0x6b, 0x4f, 0x5b, 0x9c, 0xe0, 0x43, 0xd5, 0x60, 0x8b, 0xc4,
+    0x08, 0x12, 0xc6, 0x04, 0x85, 0x83, 0x29, 0x2a, 0xcb, 0xde, 0xf4, 0x39, 0x86, 0x3f, 0x72, 0x5a,
+    0x43, 0x6e, 0xed, 0x9c, 0xca, 0x70, 0xba, 0x74, 0x87, 0xe2, 0xf3, 0x07, 0xa9, 0xe4, 0x32, 0x56,
+    0xe6, 0xf8, 0x73, 0x2f, 0xcf, 0xb1, 0x41, 0x6e, 0xd1, 0x5d, 0x90, 0xce, 0xc0, 0x2b, 0x1e, 0x8d,
+    0x33, 0xe1, 0x4d, 0x11, 0xf3, 0x27, 0xb0, 0x01, 0xfc, 0xaf, 0x4f, 0x8c, 0xfe, 0xdb, 0xbd, 0x5b,
+    0xb4, 0xef, 0x2d, 0xcf, 0x2f, 0xbd, 0x5d, 0x55, 0x67, 0xca, 0xec, 0x61, 0xd2, 0x94, 0xb4, 0xfe,
+    0x2e, 0xd4, 0x2a, 0xba, 0x50, 0x78, 0x8c, 0x15, 0x1b, 0x42, 0xb3, 0xff, 0x60, 0x3e, 0xa2, 0x12,
+    0xb7, 0x55, 0xc8, 0x0b, 0xae, 0x55, 0x3d, 0x24, 0x2c, 0x24, 0xb2, 0x33, 0x2d, 0x10, 0x7a, 0x84,
+    0xca, 0x4c, 0xab, 0x33, 0x23, 0x86, 0x47, 0x09, 0x03, 0xd5, 0x35, 0x46, 0x00, 0xc3, 0x5b, 0x4c,
+    0xc8, 0xf1, 0x02, 0x66, 0xab, 0xf5, 0x72, 0xcc, 0x75, 0x76, 0x83, 0x13, 0xb0, 0xef, 0x76, 0x3b,
+    0xa1, 0xd7, 0x47, 0xd7, 0x49, 0xc4, 0x7e, 0x44, 0x9d, 0x64, 0xb1, 0x66, 0x59, 0x6d, 0x83, 0xe1,
+    0x6c, 0x0a, 0xe7, 0xca, 0xa7, 0x77, 0x4a, 0x08, 0x7d, 0x1b, 0x29, 0xd0, 0x11, 0xc7, 0x4c, 0xbc,
+    0xa8, 0x71, 0x8f, 0x0c, 0x35, 0x58, 0xe5, 0x27, 0x29, 0x8d, 0xa5, 0xfc, 0x7b, 0x3b, 0x25, 0x85,
+    0x38, 0x56, 0x6c, 0x0b, 0xcb, 0x70, 0xe9, 0x09, 0x6a, 0xc5, 0x6e, 0x4e, 0x16, 0x8a, 0xe3, 0xa8,
+    0xb7, 0x72, 0x7f, 0x46, 0xbc, 0xef, 0x55, 0x28, 0x01, 0x23, 0x65, 0x25, 0xed, 0xe2, 0x43, 0xfb,
+    0xd0, 0x2b, 0x7e, 0x6f, 0xe5, 0xe3, 0xc2, 0xf1, 0x56, 0x6b, 0x5c, 0x18, 0x1d, 0xe9, 0x9c, 0x09,
+    0xf0, 0x26, 0x31, 0xe0, 0x14, 0x5e, 0x9f, 0x13, 0x5a, 0x8e, 0xdb, 0x40, 0x3d, 0xd8, 0x6a, 0x61,
+    0x35, 0xfa, 0x5f, 0x14, 0x84, 0xac, 0xee, 0x95, 0x2d, 0x8b, 0xac, 0xb2, 0xa6, 0x1b, 0x19, 0x49,
+    0xfc, 0x7b, 0x22, 0xbd, 0x55, 0x40, 0x69, 0xde, 0xa8, 0xf2, 0xd7, 0xeb, 0x95, 0xc4, 0x9e, 0xd8,
+    0xde, 0x43, 0x0e, 0xb9, 0xe9, 0x04, 0x48, 0xf9, 0xc8, 0x62, 0x55, 0xa2, 0x27, 0x8a, 0x92, 0xfb,
+    0x73, 0x3e, 0xd1, 0x6b, 0xf2, 0x1e, 0x72, 0xd4, 0x41, 0xb6, 0xb4, 0xc1, 0x10, 0xe9, 0xe7, 0x8a,
+    0xc4, 0x9c, 0xb4, 0x20, 0x40, 0xfa, 0x92, 0x63, 0x97, 0x99, 0x82, 0x10, 0x89, 0xf2, 0x1a, 0x31,
+    0xf1, 0xe9, 0x15, 0x30, 0x22, 0xe8, 0x3d, 0xc7, 0xe8, 0xd5, 0xaa, 0x53, 0x7d, 0x9f, 0x93, 0x0f,
+    0xab, 0x59, 0x4b, 0xe2, 0xba, 0x32, 0x14, 0x25, 0x4c, 0xbf, 0xdc, 0x85, 0x2d, 0xdc, 0x52, 0xdc,
+    0x63, 0xb5, 0x43, 0xa1, 0xea, 0x4b, 0x60, 0x31, 0x9e, 0x51, 0x44, 0x70, 0x76, 0x07, 0x06, 0xc1,
+    0x2b, 0x7a, 0x7b, 0x63, 0xcc, 0x6f, 0x67, 0x3b, 0x55, 0x80, 0x2c, 0x8e, 0x2b, 0x8e, 0xbe, 0x26,
+    0xe9, 0xa3, 0x8b, 0x5f, 0x70, 0xd6, 0x54, 0xe0, 0x7b, 0x8d, 0xcb, 0x1d, 0x0b, 0x22, 0x30, 0x39,
+    0x1e, 0xb5, 0x99, 0x80, 0x1c, 0x6f, 0x88, 0xe0, 0xde, 0xbb, 0x30, 0x04, 0x5c, 0xd8, 0xd1, 0xd6,
+    0xac, 0x15, 0xe4, 0xe5, 0xc4, 0xd2, 0x02, 0x20, 0x65, 0x69, 0x02, 0xcc, 0x3a, 0xba, 0x1a, 0xcd,
+    0xf0, 0xe2, 0xa1, 0xe6, 0xfb, 0x6c, 0x47, 0x9d, 0x13, 0xb9, 0xdc, 0xf1, 0x40, 0xfb, 0x3e, 0x2c,
+    0x9c, 0x2a, 0x52, 0xd8, 0x54, 0x69, 0xb2, 0xa4, 0x09, 0x4c, 0xe8, 0x71, 0x6d, 0xf2, 0x0a, 0x7c,
+    0x64, 0xf8, 0x39, 0xf6, 0xf7, 0xfa, 0xf8, 0xb1, 0xa8, 0xca, 0x8a, 0x0f, 0xe5, 0x14, 0x01, 0x7f,
+    0xef, 0x46, 0xce, 0xe8, 0x78, 0xf0, 0xb3, 0x33, 0xd0, 0xf3, 0x04, 0xad, 0x8a, 0x56, 0xb6, 0xed,
+    0x1f, 0xd6, 0x36, 0xbe, 0x81, 0xff, 0x7a, 0xda, 0x36, 0x91, 0x5a, 0xe4, 0xbe, 0x6b, 0x29, 0x21,
+    0x67, 0xdc, 0x72, 0x77, 0x5a, 0xcd, 0x64, 0xe1, 0x65, 0xf5, 0xee, 0x28, 0x00, 0xbc, 0x5d, 0x65,
+    0x98, 0x22, 0x92, 0xb7, 0xf7, 0xed, 0xb9, 0x00, 0x25, 0xbc, 0x74, 0x56, 0x24, 0x9c, 0x8d, 0x42,
+    0xe2, 0x5b, 0x92, 0xc3, 0xfa, 0x5c, 0xd6, 0x10, 0x95, 0x67, 0x34, 0x22, 0x85, 0x15, 0x2a, 0xe7,
+    0x96, 0x59, 0x06, 0xef, 0xbd, 0x94, 0x75, 0x49, 0x4a, 0x7e, 0xab, 0x6a, 0x5c, 0x7e, 0xeb, 0xe9,
+    0x19, 0x6d, 0xe5, 0xdd, 0x9b, 0xc7, 0x47, 0xb7, 0x16, 0xed, 0xf7, 0x7f, 0x1e, 0x4f, 0xa2, 0x15,
+    0x48, 0x46, 0x9e, 0xba, 0xf1, 0x20, 0x4f, 0xf2, 0xa2, 0x13, 0x6c, 0x8b, 0x0d, 0x8e, 0x0a, 0xe5,
+    0xfc, 0x66, 0x98, 0x1c, 0x68, 0x69, 0x2c, 0x6d, 0xaa, 0x3c, 0x4f, 0x90, 0x6a, 0x3b, 0x36, 0x1f,
+    0xc1, 0xb1, 0xea, 0xc6, 0x18, 0x32, 0x6a, 0x6e, 0xee, 0x7d, 0xb4, 0x95, 0x27, 0xcb, 0xf1, 0xd6,
+    0xdd, 0x6e, 0x67, 0x91, 0x2d, 0x72, 0x10, 0x9b, 0x99, 0xcf, 0x93, 0xba, 0x7b, 0x0f, 0xe6, 0x23,
+    0x32, 0x67, 0xb7, 0xfd, 0x30, 0x89, 0xa1, 0x9d, 0xc8, 0x55, 0x2f, 0x0f, 0x3a, 0x44, 0x09, 0x74,
+    0x41, 0x93, 0x93, 0xbc, 0x7e, 0xd5, 0xaa, 0x2d, 0x47, 0xb3, 0xa6, 0x49, 0x34, 0xd2, 0x4b, 0x26,
+    0xd7, 0xfa, 0x81, 0xd4, 0xe4, 0x2a, 0x1f, 0xb7, 0x4d, 0xae, 0xf0, 0xb9, 0xdb, 0x34, 0xd1, 0x7c,
+    0xe4, 0xd6, 0x2f, 0x39, 0x93, 0xa9, 0x74, 0x23, 0x8a, 0x93, 0x36, 0xc9, 0xe7, 0x97, 0xf9, 0xdd,
+    0x47, 0x5f, 0x3c, 0xa3, 0xda, 0x3d, 0x01, 0x44, 0xce, 0xa0, 0xa4, 0x78, 0x79, 0x31, 0x5c, 0x83,
+    0xd9, 0x88, 0xf6, 0x0b, 0xe2, 0x39, 0xe3, 0xa6, 0x1b, 0x77, 0x10, 0xb2, 0x52, 0x95, 0xfd, 0xee,
+    0x50, 0x75, 0xf0, 0x91, 0xf1, 0x76, 0x3c, 0x88, 0xb4, 0x4a, 0x14, 0xa9, 0x4c, 0x3f, 0xf0, 0x37,
+    0x3e, 0x92, 0xc3, 0xe3, 0x07, 0x23, 0x27, 0x19, 0x55, 0xd5, 0x28, 0x96, 0x82, 0x79, 0x33, 0x51,
+    0x28, 0xa7, 0x06, 0x74, 0x39, 0xaa, 0x5b, 0x1c, 0xab, 0x07, 0xd3, 0x20, 0x16, 0x42, 0x5d, 0x8b,
+    0x6f, 0x9d, 0x5b, 0x54, 0xaf, 0x7a, 0xce, 0x60, 0x1a, 0x3e, 0x10, 0x9c, 0x67, 0x8c, 0x86, 0xd3,
+    0xe8, 0x02, 0x21, 0x32, 0x0b, 0xf8, 0x1e, 0xe6, 0x7b, 0xdb, 0x0d, 0x56, 0xbc, 0x9f, 0x4a, 0xa3,
+    0xfa, 0xa4, 0x5c, 0x6e, 0x63, 0x0e, 0xa3, 0x57, 0x6d, 0x43, 0x3a, 0x98, 0x74, 0x8e, 0x81, 0xe9,
+    0x03, 0x79, 0xc6, 0x19, 0x6f, 0x23, 0x3d, 0xd5, 0x43, 0x6a, 0x17, 0x35, 0xef, 0xde, 0xf6, 0xf0,
+    0x92, 0xa8, 0x85, 0x38, 0x40, 0x67, 0x32, 0x5e, 0x72, 0x6e, 0x8e, 0x46, 0x7d, 0xc9, 0x1b, 0x04,
+    0x4b, 0x79, 0x90, 0x29, 0x0a, 0x5c, 0x9e, 0xbf, 0x56, 0xc7, 0x63, 0x8e, 0x1d, 0x7e, 0xcf, 0x65,
+    0x4e, 0xff, 0xc7, 0x93, 0x92, 0x60, 0xa8, 0x43, 0xc3, 0xc9, 0x46, 0x7d, 0xba, 0xef, 0x30, 0xc3,
+    0xce, 0x2f, 0x8f, 0xf8, 0xe5, 0xd0, 0xa0, 0x02, 0xb7, 0x0e, 0x6b, 0xce, 0xbb, 0x43, 0x53, 0x15,
+    0x43, 0x9b, 0xfe, 0x46, 0xab, 0xfe, 0x8b, 0xff, 0xc6, 0xb2, 0x20, 0xb8, 0x31, 0x13, 0xb2, 0x12,
+    0x6c, 0xb0, 0xd7, 0xdb, 0xa4, 0xd9, 0x8b, 0x27, 0x4d, 0xb0, 0xae, 0x00, 0x55, 0xdd, 0x82, 0xa7,
+    0x37, 0xcf, 0x42, 0x0b, 0x7d, 0xf1, 0xc7, 0x87, 0xbd, 0xa6, 0x14, 0xec, 0x6b, 0x9c, 0xa1, 0x05,
+    0x76, 0xb3, 0x73, 0x83, 0x44, 0x2f, 0xbc, 0x6e, 0x99, 0xd8, 0x19, 0x1a, 0xd6, 0x43, 0xd8, 0x09,
+    0xcf, 0x3c, 0x4c, 0x2a, 0x5b, 0x10, 0x68, 0x58, 0x99, 0xa6, 0x7f, 0x9d, 0xd8, 0x49, 0x43, 0x4a,
+    0x7a, 0x4b, 0x5b, 0xef, 0x51, 0x09, 0x2d, 0x17, 0x3f, 0x81, 0x49, 0xce, 0x91, 0xd4, 0xd4, 0xd0,
+    0x85, 0x75, 0x9a, 0xff, 0x86, 0xc3, 0x58, 0x59, 0x78, 0x38, 0xcf, 0xf9, 0x43, 0x43, 0xaf, 0x2d,
+    0x29, 0x14, 0x6d, 0x02, 0x39, 0xb8, 0x1b, 0x7c, 0xc5, 0x1a, 0xe3, 0x88, 0x7a, 0x53, 0xbf, 0xb9,
+    0xeb, 0x4b, 0x17, 0xbe, 0x74, 0x8f, 0xec, 0x7a, 0x41, 0x2b, 0x31, 0xd8, 0x39, 0x73, 0xa5, 0x41,
+    0x5f, 0x04, 0x73, 0xf8, 0x0c, 0xa7, 0x95, 0x14, 0x34, 0x17, 0x93, 0xe1, 0x1b, 0x92, 0xb8, 0x28,
+    0x8a, 0x40, 0xb0, 0x54, 0x54, 0x9c, 0x60, 0x3d, 0x2c, 0x5d, 0x0f, 0xc6, 0x1a, 0xf5, 0xd7, 0x6c,
+    0xa3, 0xaa, 0x5e, 0x23, 0x56, 0x0d, 0x86, 0x35, 0x6f, 0xd5, 0x57, 0xe7, 0x0a, 0x70, 0x38, 0x1a,
+    0x6a, 0xbf, 0xd9, 0xd9, 0xf7, 0xea, 0x4c, 0xbe, 0x1b, 0x82, 0x8a, 0xe5, 0xac, 0xcb, 0xbc, 0x54,
+    0x10, 0x82, 0xfb, 0xa5, 0xc0, 0x19, 0x41, 0x9f, 0x86, 0x99, 0x82, 0x58, 0xb9, 0xed, 0x06, 0x9f,
+    0xd6, 0x2d, 0xc6, 0xd4, 0x87, 0xae, 0x70, 0xae, 0x60, 0x61, 0xf7, 0x9a, 0x09, 0x48, 0xed, 0x28,
+    0x3b, 0x9d, 0x47, 0xa5, 0x22, 0xdb, 0x3c, 0x84, 0x72, 0x4b, 0x61, 0x49, 0xda, 0xda, 0xdc, 0x8d,
+    0xaf, 0x16, 0x33, 0x79, 0xa8, 0xb5, 0x6f, 0x1a, 0x59, 0xba, 0xf8, 0x5e, 0xa0, 0x56, 0xdd, 0x57,
+    0xf3, 0xf4, 0xa3, 0xe2, 0x4e, 0x34, 0xdb, 0xac, 0xfc, 0xe0, 0xd0, 0x95, 0x4f, 0x6a, 0x06, 0x63,
+    0xd8, 0x0a, 0x62, 0x40, 0x33, 0x20, 0x51, 0x71, 0xde, 0x81, 0x50, 0x15, 0x60, 0x2d, 0xb3, 0x54,
+    0x80, 0xef, 0x74, 0xbc, 0xbb, 0x5b, 0x71, 0xbb, 0x0f, 0x65, 0xc8, 0xf7, 0xf4, 0x5e, 0x4c, 0x1e,
+    0x87, 0x40, 0xe9, 0xb8, 0xec, 0x5e, 0x8c, 0x57, 0xa6, 0x2e, 0xb3, 0xea, 0x61, 0x26, 0xa9, 0x6d,
+    0x62, 0x01, 0x38, 0x56, 0xa3, 0x30, 0x6d, 0x94, 0x37, 0x7f, 0xe1, 0x18, 0x2a, 0x2f, 0x91, 0x3c,
+    0x26, 0x49, 0x32, 0xc3, 0xf9, 0xf8, 0x7a, 0x0c, 0xd4, 0x1b, 0x25, 0xf6, 0xf8, 0xc7, 0x5b, 0xad,
+    0x23, 0x36, 0xca, 0xb0, 0xf3, 0x84, 0xc9, 0x58, 0x3f, 0xbe, 0x33, 0x28, 0x1e, 0x72, 0xb6, 0x3e,
+    0x8b, 0x98, 0x1d, 0x52, 0xd8, 0xd3, 0xa2, 0x73, 0x93, 0x7f, 0xfa, 0x09, 0xaa, 0x28, 0x14, 0xf3,
+    0xef, 0x9f, 0xdb, 0xa7, 0xe3, 0xcf, 0xcf, 0x45, 0xbe, 0xbc, 0x09, 0x52, 0x78, 0x74, 0xe0, 0xb1,
+    0x6c, 0xbf, 0x2c, 0x4e, 0x94, 0xd6, 0xf1, 0xe7, 0xcf, 0x97, 0xcb, 0x65, 0x75, 0x09, 0x56, 0x55,
+    0x73, 0xfc, 0xbc, 0x06, 0xff, 0x60, 0xc0, 0x0b, 0xe7, 0x89, 0xe0, 0xcb, 0x43, 0xf5, 0xfc, 0x65,
+    0xc1, 0x6a, 0x72, 0x7f, 0x03, 0xff, 0x16, 0x37, 0x01, 0x86, 0xfd, 0x35, 0xa2, 0x27, 0x27, 0xfb,
+    0xb2, 0x28, 0xfc, 0xf5, 0x6a, 0xb7, 0x5e, 0x06, 0xb9, 0xbb, 0x59, 0x6d, 0x96, 0xf0, 0x9b, 0xbb,
+    0xc1, 0xd2, 0x0d, 0x5c, 0x7f, 0x75, 0xb7, 0x84, 0xdf, 0x3c, 0x5a, 0x46, 0x2b, 0xcf, 0xdb, 0xec,
+    0xb6, 0xf9, 0x6e, 0x15, 0x2d, 0x5d, 0xf8, 0xe0, 0x4b, 0xec, 0xe3, 0x75, 0xe1, 0x80, 0xd6, 0xf3,
+    0x2f, 0x8b, 0x9b, 0x75, 0x00, 0xf2, 0x5c, 0x7c, 0x16, 0x98, 0xd9, 0xc1, 0xf0, 0xf4, 0xd3, 0x58,
+    0xf9, 0x43, 0x1d, 0x6a, 0x0a, 0x69, 0x24, 0x0f, 0x7c, 0x87, 0x53, 0x7c, 0x18, 0xef, 0xe7, 0xa6,
+    0x66, 0x6e, 0x9e, 0xb4, 0x3b, 0x11, 0x62, 0x2a, 0x55, 0x67, 0x59, 0xa9, 0x46, 0xf4, 0x85, 0x6e,
+    0xa4, 0x6e, 0x33, 0x42, 0xc8, 0x26, 0xda, 0xac, 0xf2, 0xd2, 0x00, 0x30, 0x44, 0xee, 0xa2, 0xca,
+    0x70, 0xdc, 0xbb, 0x57, 0x93, 0x2b, 0x0b, 0xc8, 0xf0, 0x01, 0x9d, 0x73, 0x7b, 0xc0, 0x6f, 0x35,
+    0x70, 0xa3, 0xa1, 0x27, 0x66, 0x3f, 0xc6, 0x6c, 0xc3, 0xba, 0x5b, 0x59, 0xcb, 0xd6, 0x57, 0x44,
+    0xf8, 0xf9, 0x74, 0x9a, 0xd2, 0xc6, 0x66, 0xab, 0xaf, 0x54, 0x19, 0x37, 0x2c, 0x28, 0x08, 0x0e,
+    0xef, 0x84, 0x3b, 0xb3, 0xc6, 0xe8, 0x57, 0xd8, 0xd4, 0x69, 0x57, 0xf2, 0xfa, 0xec, 0x2e, 0x98,
+    0x2a, 0x82, 0x56, 0x40, 0x56, 0x37, 0xfc, 0xcf, 0x1b, 0x3e, 0x9f, 0xb3, 0xe7, 0x0f, 0xa3, 0x78,
+    0x00, 0x7b, 0x8c, 0xeb, 0x24, 0x5f, 0x0b, 0x56, 0x13, 0x2d, 0x2d, 0x9b, 0xd7, 0x33, 0x8a, 0xd7,
+    0x6a, 0x06, 0xff, 0x07, 0xef, 0x92, 0x04, 0x52, 0x3e, 0xd2, 0x8a, 0x8d, 0xf9, 0xad, 0x2c, 0x89,
+    0x86, 0x83, 0x8d, 0xb9, 0xbb, 0xe4, 0xf2, 0xe3, 0x6b, 0x23, 0x05, 0xfd, 0x1f, 0xc1, 0x33, 0x83,
+    0x73, 0xb5, 0x25, 0x00, 0x00,
+};
+
+// GP_DARK: 10266 -> 2910 bytes
+const uint8_t GP_DARK_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x5a, 0x59, 0x6f, 0xe3, 0xc8,
+    0x11, 0x7e, 0xf7, 0xaf, 0x50, 0xd6, 0x30, 0x3c, 0xce, 0x8a, 0x1c, 0x52, 0x14, 0x65, 0x89, 0xc4,
+    0x18, 0x1b, 0x2f, 0x10, 0xe4, 0x21, 0x4f, 0xc1, 0x20, 0x08, 0xb0, 0x30, 0x06, 0x4d, 0xb2, 0x25,
+    0x75, 0xcc, 0x0b, 0x64, 0xcb, 0xb2, 0x87, 0xd0, 0x7f, 0x4f, 0xf5, 0x45, 0x36, 0xd9, 0x4d, 0x7b,
+    0x76, 0x03, 0x04, 0x81, 0x2f, 0x8a, 0x7d, 0xd5, 0x5d, 0x5f, 0x55, 0xfb, 0xaa, 0xee, 0x32, 0xd2,
+    0xd6, 0x39, 0x7a, 0x8b, 0x48, 0x99, 0x93, 0x12, 0xc7, 0x97, 0x2b, 0xb7, 0x40, 0xa4, 0x4c, 0xf2,
+    0x2a, 0x7d, 0xee, 0x0a, 0xd4, 0x1c, 0x48, 0x19, 0xa1, 0x13, 0xad, 0xe2, 0x02, 0xbd, 0x3a, 0x67,
+    0x92, 0xd1, 0x63, 0xe4, 0x7b, 0xde, 0xcd, 0xe5, 0x0a, 0x2d, 0x51, 0xf4, 0x42, 0x5a, 0x42, 0x71,
+    0xd6, 0xa5, 0x55, 0x5e, 0x35, 0xd1, 0xf5, 0xfa, 0xd7, 0xbf, 0xfc, 0x35, 0xf4, 0x60, 0x28, 0x3a,
+    0x56, 0x2f, 0xb8, 0x51, 0xaf, 0x83, 0x6c, 0xb7, 0x5b, 0xfb, 0x97, 0xab, 0x6b, 0xbe, 0xe9, 0x23,
+    0x4a, 0x9f, 0x17, 0xa4, 0xac, 0x4f, 0xf4, 0x37, 0xfa, 0x56, 0xe3, 0x2f, 0x35, 0x6a, 0xdb, 0x73,
+    0xd5, 0x64, 0x4f, 0x4b, 0xfb, 0x38, 0xc5, 0xaf, 0x74, 0x6e, 0x2c, 0x43, 0x14, 0xcf, 0xae, 0x23,
+    0xc5, 0xec, 0x58, 0x79, 0x2a, 0x12, 0xdc, 0x8c, 0x46, 0xd9, 0x31, 0xa8, 0xc1, 0x48, 0x7f, 0xd7,
+    0xe2, 0x1c, 0xa7, 0x54, 0x7f, 0xe3, 0xb6, 0x39, 0xc9, 0x80, 0xb3, 0x04, 0x3e, 0x1c, 0x9a, 0xea,
+    0x54, 0x66, 0xd1, 0xb5, 0x1f, 0xf8, 0x1b, 0x1f, 0xcd, 0xb1, 0xd7, 0xa0, 0xf2, 0x80, 0x9f, 0x2c,
+    0x0b, 0xe2, 0xe1, 0x95, 0xd3, 0xe0, 0x1a, 0x23, 0x1a, 0x95, 0x95, 0x7c, 0x8a, 0xcd, 0xdd, 0xa2,
+    0xf4, 0x88, 0xd3, 0x67, 0x9c, 0xfd, 0x6c, 0x92, 0xe0, 0x28, 0x39, 0xdf, 0xa3, 0x5d, 0x90, 0x5e,
+    0xae, 0x92, 0x2a, 0x7b, 0xeb, 0xf6, 0x55, 0x49, 0x9d, 0x3d, 0x2a, 0x48, 0xfe, 0x16, 0xfd, 0x13,
+    0x37, 0x19, 0x2a, 0xf5, 0x13, 0x7b, 0x22, 0xe4, 0xd2, 0x24, 0x49, 0x62, 0xa1, 0x6c, 0x87, 0x56,
+    0x75, 0xe4, 0x87, 0xf5, 0x2b, 0xd0, 0x70, 0x6c, 0x3a, 0xa1, 0xf1, 0x5d, 0x78, 0x23, 0x87, 0x23,
+    0x18, 0x59, 0x78, 0x71, 0x02, 0x0a, 0xc3, 0x0d, 0x10, 0x0c, 0x16, 0x23, 0x9e, 0xf9, 0xba, 0x15,
+    0x0c, 0xb6, 0x15, 0xd0, 0xb7, 0xb8, 0x0e, 0x76, 0x6b, 0x6f, 0xbd, 0x65, 0x9b, 0xac, 0x94, 0x19,
+    0x6d, 0xf9, 0xd2, 0xcb, 0x55, 0x5b, 0xa3, 0x52, 0xd0, 0xd7, 0x92, 0xef, 0x38, 0xf2, 0x37, 0xfc,
+    0xb0, 0x1c, 0x25, 0x38, 0xef, 0xce, 0x47, 0x30, 0x28, 0x07, 0x66, 0xa4, 0x18, 0x76, 0x3f, 0x37,
+    0xa8, 0x8e, 0x87, 0x99, 0x2b, 0x0f, 0x66, 0xca, 0xcd, 0xbc, 0x85, 0xa0, 0xd1, 0x4d, 0x8f, 0xa8,
+    0xa1, 0x8f, 0xdc, 0x5c, 0x25, 0x25, 0x0d, 0xca, 0xc8, 0xa9, 0x05, 0x33, 0x1d, 0x66, 0x07, 0xf0,
+    0x28, 0x59, 0xf1, 0x6e, 0xd8, 0xaa, 0x43, 0x43, 0xb2, 0xde, 0xf4, 0xf7, 0x39, 0x7e, 0x8d, 0xff,
+    0x7d, 0x6a, 0x29, 0xd9, 0xbf, 0x81, 0x30, 0x4b, 0x8a, 0x4b, 0x1a, 0x71, 0x1a, 0x9c, 0x04, 0xd3,
+    0x33, 0xc6, 0x25, 0x53, 0x08, 0x5b, 0xb2, 0x70, 0x85, 0x63, 0x0c, 0x8e, 0xa0, 0x4e, 0xe0, 0xa7,
+    0xc1, 0xc6, 0x52, 0x6d, 0x2d, 0xee, 0x6a, 0x94, 0x65, 0xa4, 0x3c, 0x70, 0x61, 0x2e, 0x7c, 0x7f,
+    0x20, 0x86, 0xb1, 0xb1, 0x18, 0xcd, 0xb7, 0x51, 0x6e, 0xea, 0x77, 0x85, 0x56, 0x59, 0x10, 0x82,
+    0xbc, 0x5f, 0x9d, 0xf6, 0x88, 0xb2, 0xea, 0x0c, 0x5a, 0xf4, 0xfd, 0x05, 0xdb, 0x8d, 0xfd, 0xac,
+    0xf4, 0x1d, 0xbf, 0xa2, 0x44, 0x11, 0xc0, 0x35, 0xa3, 0x8f, 0xfd, 0x0d, 0xa3, 0x6c, 0xf0, 0x4e,
+    0xcf, 0xf3, 0x74, 0x11, 0xaf, 0xd8, 0xd1, 0x06, 0x35, 0x9c, 0x5c, 0x75, 0x92, 0x85, 0xb4, 0x75,
+    0x8a, 0xf6, 0xa1, 0x17, 0x2b, 0x96, 0x37, 0x72, 0xa2, 0xd2, 0x15, 0x7c, 0x74, 0x98, 0x04, 0xc4,
+    0x36, 0xfc, 0x91, 0x51, 0x43, 0x8f, 0xa4, 0x94, 0x9a, 0x1b, 0x2c, 0x53, 0xb3, 0xa9, 0x91, 0x3d,
+    0xa5, 0xd2, 0x9e, 0xf8, 0xaa, 0xaf, 0xe0, 0xad, 0xbd, 0x80, 0x7b, 0x71, 0x5a, 0xec, 0x7b, 0x62,
+    0x3c, 0x6a, 0x39, 0x48, 0x67, 0xe6, 0x48, 0xfe, 0x2c, 0xb9, 0xda, 0xa5, 0x3b, 0x8c, 0x7c, 0xdd,
+    0x31, 0x1c, 0xff, 0xbe, 0x67, 0xcb, 0x49, 0x2a, 0x4a, 0xab, 0x82, 0x79, 0x44, 0xac, 0x2c, 0x89,
+    0xcb, 0x97, 0x9d, 0x22, 0xa2, 0x69, 0x33, 0x36, 0x31, 0xf6, 0xcb, 0xc9, 0x48, 0x03, 0x41, 0x85,
+    0x54, 0x65, 0xd4, 0x54, 0xe7, 0x18, 0xe5, 0xe4, 0x50, 0xf6, 0x36, 0x97, 0xc2, 0x2f, 0xdc, 0x88,
+    0x79, 0xcc, 0xf6, 0x95, 0x0b, 0x88, 0x59, 0xe0, 0x19, 0x45, 0xab, 0xe6, 0x5c, 0xae, 0x2c, 0xf1,
+    0xcc, 0x08, 0x9b, 0xd6, 0x38, 0x6b, 0x04, 0x50, 0x23, 0x6a, 0x6a, 0x2f, 0xb8, 0x28, 0xc6, 0x6f,
+    0x58, 0x20, 0x02, 0x23, 0x7c, 0x5a, 0xca, 0xf8, 0xa8, 0x42, 0x67, 0x77, 0x35, 0xb8, 0xd8, 0x90,
+    0x2d, 0x56, 0x9e, 0x67, 0x98, 0x14, 0x44, 0x82, 0xde, 0x56, 0x02, 0xa5, 0x3d, 0x2d, 0x14, 0x8d,
+    0xc2, 0xcb, 0x9c, 0x1f, 0x40, 0x86, 0xa1, 0x24, 0x45, 0xb9, 0xc3, 0xa5, 0x13, 0x15, 0x24, 0xcb,
+    0x72, 0x1c, 0xd7, 0x15, 0xa4, 0x24, 0x2e, 0x5d, 0x9c, 0x23, 0x4a, 0x5e, 0xb0, 0x32, 0x42, 0x66,
+    0x93, 0x6b, 0x38, 0x66, 0x62, 0x11, 0x47, 0x4c, 0x0e, 0x47, 0x1a, 0xad, 0x39, 0x05, 0xa7, 0xa6,
+    0x85, 0x03, 0xea, 0x8a, 0x98, 0x22, 0xb6, 0x4b, 0x4a, 0x05, 0x82, 0xad, 0x30, 0x2e, 0x43, 0x6e,
+    0x72, 0x7c, 0x3b, 0x3d, 0x69, 0x3c, 0x55, 0x09, 0x54, 0xce, 0x5e, 0xdd, 0x0f, 0xb3, 0x57, 0xa6,
+    0xbd, 0xf9, 0xc6, 0x06, 0xbf, 0x4f, 0xfd, 0x53, 0xad, 0x8d, 0x01, 0x80, 0x23, 0x4c, 0xd8, 0xd4,
+    0x17, 0x0f, 0x3b, 0xe4, 0x3b, 0x53, 0x99, 0x1c, 0x84, 0x37, 0x4a, 0x64, 0x1c, 0x21, 0x5c, 0xae,
+    0xfa, 0x3d, 0x05, 0x23, 0x56, 0xdc, 0xa0, 0xd1, 0xd4, 0x9e, 0x92, 0x82, 0x8c, 0xc9, 0x4c, 0x4e,
+    0xc0, 0x63, 0xf9, 0xb4, 0x14, 0x7f, 0x3b, 0x29, 0x85, 0x30, 0x1c, 0x2b, 0x6e, 0x3d, 0x0a, 0xe7,
+    0xc3, 0x09, 0x81, 0xa7, 0x45, 0x1d, 0x96, 0x6e, 0x42, 0x7b, 0xb4, 0xe2, 0x38, 0xc5, 0x96, 0xc4,
+    0x34, 0x7e, 0xc5, 0x5c, 0x9e, 0x8f, 0xde, 0x35, 0x0c, 0xc9, 0x84, 0x80, 0x3c, 0x16, 0x56, 0xe4,
+    0x80, 0xf8, 0x24, 0x81, 0xd1, 0x9e, 0xe4, 0xb0, 0x4f, 0x94, 0x34, 0x8c, 0xbb, 0x12, 0xb7, 0xed,
+    0x27, 0xcf, 0xdd, 0x85, 0x77, 0xe3, 0x8d, 0x27, 0xa2, 0x18, 0x45, 0x12, 0x4b, 0x40, 0x98, 0xe6,
+    0x2f, 0x5b, 0x9c, 0x50, 0xb4, 0xa2, 0x94, 0x79, 0x86, 0x8d, 0x58, 0x39, 0x22, 0xa9, 0x15, 0x9f,
+    0x3a, 0x2d, 0xe3, 0x90, 0xb2, 0xc5, 0x94, 0x27, 0x02, 0x16, 0xce, 0x99, 0x4f, 0xb1, 0x04, 0x72,
+    0xaf, 0x8e, 0x89, 0xf6, 0x55, 0x7a, 0x6a, 0xa7, 0x26, 0x26, 0xde, 0x76, 0xd5, 0x89, 0x32, 0x0b,
+    0x13, 0x02, 0xbf, 0x88, 0x39, 0x9a, 0xa5, 0x40, 0xd4, 0xcc, 0x01, 0x4b, 0x4a, 0xed, 0xed, 0xb4,
+    0x1c, 0x09, 0xaf, 0x23, 0xb4, 0x07, 0x6e, 0x94, 0x83, 0x68, 0xee, 0xb4, 0xf2, 0xac, 0x09, 0x2b,
+    0xe6, 0xd1, 0x9a, 0xd9, 0x49, 0x8e, 0xf7, 0x34, 0x72, 0x18, 0x00, 0x30, 0x43, 0x83, 0x92, 0xd5,
+    0xed, 0x6d, 0x6c, 0xf7, 0x02, 0x13, 0x63, 0x05, 0x41, 0x6c, 0x15, 0x47, 0x30, 0xe4, 0xc7, 0xc5,
+    0xf5, 0x7e, 0xbf, 0x0f, 0x25, 0xdd, 0x12, 0xb6, 0x49, 0xfa, 0xb5, 0xa5, 0x6a, 0x32, 0x4f, 0x89,
+    0xeb, 0x9e, 0x51, 0xb7, 0x31, 0x17, 0x19, 0x54, 0x64, 0x9e, 0xf7, 0x63, 0x54, 0xdc, 0x2f, 0xa7,
+    0xc7, 0xc0, 0x6b, 0xcf, 0x4b, 0xd4, 0x61, 0x87, 0x06, 0xc0, 0xcd, 0x87, 0xc7, 0x05, 0xe9, 0x7f,
+    0x71, 0xdc, 0x3a, 0xf3, 0xb6, 0xf2, 0xb8, 0x72, 0x46, 0xb9, 0xe5, 0xff, 0x8b, 0x76, 0xff, 0xa8,
+    0x5c, 0x57, 0x52, 0xae, 0x3d, 0x3f, 0x1f, 0x48, 0x74, 0xf1, 0x87, 0x45, 0xba, 0x92, 0x22, 0xe5,
+    0x75, 0x1a, 0x29, 0xc9, 0xa3, 0x08, 0x0e, 0xf0, 0xe8, 0xe8, 0xf9, 0x45, 0x3e, 0x33, 0xb7, 0xfa,
+    0x13, 0x29, 0xea, 0xaa, 0xa1, 0xa8, 0xa4, 0x93, 0xd4, 0xa7, 0x0d, 0x0c, 0x4e, 0xa8, 0xbd, 0x84,
+    0x13, 0xda, 0x33, 0xa1, 0xe9, 0xb1, 0xd3, 0x20, 0x2e, 0x27, 0x20, 0x14, 0x7f, 0x2d, 0x22, 0xb7,
+    0xca, 0x59, 0xec, 0xbe, 0xd1, 0xe8, 0x0a, 0x40, 0x75, 0xfd, 0xf6, 0xa2, 0xbe, 0xe9, 0x2a, 0xc0,
+    0xdb, 0x84, 0xbe, 0x45, 0x9e, 0x9c, 0xef, 0xa9, 0xc9, 0x1e, 0x9b, 0x29, 0x6b, 0x9e, 0x91, 0x25,
+    0xb0, 0x5d, 0x06, 0x1a, 0x50, 0x02, 0x48, 0xf1, 0x64, 0x06, 0x6b, 0x6e, 0x2a, 0xa1, 0x32, 0x15,
+    0x2f, 0x6e, 0xc4, 0xa6, 0xb1, 0x86, 0xde, 0x4c, 0x43, 0x08, 0xd7, 0xec, 0x6b, 0x1b, 0xc6, 0xce,
+    0x19, 0x27, 0xcf, 0x84, 0x3a, 0x14, 0xea, 0x38, 0x79, 0x90, 0xeb, 0xb7, 0xf1, 0xf8, 0x63, 0x4f,
+    0x60, 0x94, 0xe0, 0x7d, 0xd5, 0xe0, 0x09, 0x9d, 0x21, 0xe4, 0x28, 0x0b, 0x99, 0x83, 0x75, 0x2a,
+    0x63, 0xdf, 0xf4, 0x69, 0x8d, 0x3f, 0x72, 0x82, 0xd7, 0xdc, 0x01, 0x38, 0xa9, 0x6b, 0x2b, 0xa9,
+    0x60, 0x23, 0x3f, 0x4a, 0xe5, 0xef, 0x2d, 0x24, 0xad, 0xf3, 0x15, 0x8f, 0xa3, 0x33, 0xe1, 0x4d,
+    0x11, 0xf1, 0x27, 0x30, 0x04, 0xfc, 0xaf, 0x4f, 0x8c, 0xfe, 0xbb, 0xd8, 0x29, 0xda, 0xf7, 0x86,
+    0xe7, 0x87, 0x2e, 0x57, 0x90, 0x2b, 0x98, 0x51, 0x58, 0xed, 0x49, 0x2b, 0x1d, 0xd7, 0x1a, 0x90,
+    0x5c, 0x0b, 0xef, 0x99, 0x84, 0x8b, 0xf5, 0x80, 0x2c, 0x99, 0xa4, 0x98, 0xa3, 0x28, 0xac, 0x30,
+    0xa9, 0x18, 0x04, 0xd7, 0x0a, 0x6c, 0x09, 0x33, 0x09, 0xa7, 0x50, 0x4b, 0x96, 0xf3, 0x1a, 0xbc,
+    0x0d, 0xd9, 0x3e, 0x4a, 0x18, 0xa8, 0x86, 0xf2, 0x1d, 0xe6, 0xa4, 0x32, 0xcb, 0x89, 0x39, 0xf7,
+    0x5a, 0x99, 0xc8, 0xfc, 0x67, 0x3b, 0x78, 0x82, 0xbf, 0x9a, 0x50, 0xd1, 0x17, 0x79, 0x23, 0x0b,
+    0x1a, 0x6b, 0xde, 0x68, 0x17, 0x4c, 0x4c, 0x5e, 0x2b, 0x8c, 0xf4, 0x65, 0xa4, 0x40, 0x07, 0x1c,
+    0x31, 0x41, 0xa2, 0xc6, 0x39, 0xb0, 0xad, 0xc1, 0xfe, 0x3e, 0x49, 0xbe, 0x97, 0xf2, 0xef, 0x9d,
+    0x8d, 0xdf, 0x28, 0x52, 0x0c, 0x0a, 0x1b, 0x70, 0xe8, 0x11, 0x20, 0x67, 0x37, 0xc7, 0xb5, 0xe2,
+    0x2d, 0xec, 0xed, 0xd9, 0x9f, 0x11, 0xe4, 0x7b, 0x78, 0x28, 0x60, 0xa4, 0xb8, 0xd2, 0x02, 0x3e,
+    0xb4, 0x04, 0xbd, 0xa4, 0xf0, 0x5c, 0x1f, 0x17, 0x0b, 0xcf, 0x5d, 0xe1, 0x22, 0xd6, 0xaa, 0xdc,
+    0x59, 0x65, 0xf3, 0x3a, 0x33, 0xe0, 0x14, 0x5e, 0x9f, 0x12, 0x5a, 0x9a, 0x95, 0xa5, 0x1e, 0x5b,
+    0xb5, 0x28, 0x1a, 0xfe, 0x2f, 0xd0, 0x26, 0x43, 0x51, 0xb2, 0xc6, 0x91, 0x98, 0xce, 0x5e, 0xf9,
+    0x48, 0xe2, 0xdf, 0x13, 0xe9, 0x9d, 0x9a, 0x94, 0xe6, 0x8d, 0xc2, 0xd6, 0x5e, 0xaf, 0x24, 0xf6,
+    0xc4, 0xd6, 0xee, 0x73, 0xc8, 0x48, 0x47, 0xd8, 0x94, 0xf7, 0x3d, 0xdc, 0x12, 0xbd, 0x50, 0x94,
+    0x3c, 0x9c, 0x72, 0x4b, 0x31, 0xcb, 0x8b, 0x54, 0xa3, 0x44, 0x6d, 0x69, 0x83, 0x21, 0xb0, 0xcf,
+    0x41, 0xd2, 0x9c, 0xb4, 0x20, 0x40, 0xfa, 0x96, 0x63, 0x87, 0x99, 0x82, 0x10, 0x89, 0xf2, 0x0f,
+    0xd1, 0x5f, 0xea, 0x15, 0x60, 0x10, 0xf4, 0x9e, 0x63, 0xf4, 0x6a, 0xd5, 0xa9, 0x7e, 0xc8, 0xc9,
+    0x87, 0xd8, 0x79, 0x22, 0x71, 0x5d, 0x19, 0x8a, 0x12, 0xa6, 0x5f, 0xee, 0xac, 0x93, 0xbd, 0xa5,
+    0xb8, 0x4d, 0xb5, 0x83, 0xc5, 0xf9, 0x72, 0xb2, 0xe8, 0xf1, 0x28, 0x22, 0x38, 0xbb, 0x03, 0x83,
+    0xe0, 0x15, 0xbd, 0xbd, 0x31, 0xe6, 0x59, 0xc1, 0x37, 0xa7, 0x60, 0x52, 0x1c, 0x5c, 0xbe, 0x7d,
+    0x4d, 0xd2, 0x67, 0x07, 0xbf, 0xe1, 0xac, 0xa9, 0xc0, 0xf7, 0x1a, 0x87, 0x3b, 0x16, 0xc4, 0x5a,
+    0x72, 0x38, 0x68, 0x4d, 0x07, 0x01, 0xb4, 0x65, 0x18, 0xef, 0x5d, 0x18, 0x42, 0x2b, 0xac, 0x68,
+    0x6b, 0x56, 0x51, 0x72, 0xf4, 0xb0, 0x9c, 0x4c, 0x20, 0x65, 0x39, 0x9e, 0x30, 0xeb, 0xe8, 0xaa,
+    0xbf, 0xc3, 0xb1, 0x42, 0xcd, 0xd7, 0x4d, 0x1d, 0x75, 0x4e, 0xe4, 0x72, 0xc5, 0x23, 0xed, 0x8b,
+    0xbc, 0xb5, 0x0d, 0x93, 0xb0, 0x7e, 0x94, 0x15, 0xc1, 0x04, 0xe3, 0xd9, 0x26, 0x14, 0xf9, 0x0e,
+    0x7c, 0x64, 0xf8, 0x35, 0xf2, 0x63, 0xbd, 0x15, 0x5a, 0x54, 0x65, 0xc5, 0x3b, 0x7b, 0x8a, 0x80,
+    0xbf, 0x77, 0x86, 0x33, 0x2e, 0x3c, 0xf8, 0xda, 0x8e, 0xb6, 0xe7, 0xa9, 0x58, 0x21, 0x56, 0xb6,
+    0xec, 0x1f, 0x93, 0x65, 0x7c, 0x01, 0xff, 0xf1, 0xb4, 0x65, 0x22, 0x89, 0xc8, 0x75, 0xd7, 0x52,
+    0x42, 0x96, 0x46, 0x74, 0xa7, 0x41, 0xa4, 0xc9, 0xbe, 0x0c, 0xec, 0x1a, 0x01, 0xe0, 0x72, 0x95,
+    0x61, 0x8a, 0x48, 0xde, 0x3e, 0xb4, 0xa7, 0x02, 0x94, 0xf0, 0xd6, 0x4d, 0x22, 0xe1, 0x6c, 0x14,
+    0x7a, 0x27, 0xce, 0xf4, 0xfd, 0x4a, 0x1e, 0xf5, 0x42, 0x83, 0x14, 0x06, 0x49, 0x4e, 0x2d, 0xb3,
+    0x0c, 0x5e, 0xb9, 0x29, 0xeb, 0x92, 0x94, 0xfc, 0x56, 0xd5, 0xb8, 0x7c, 0xea, 0xe9, 0x31, 0x96,
+    0xf2, 0x5a, 0xd1, 0xe3, 0xfd, 0xdf, 0x09, 0xed, 0x0f, 0x7f, 0x36, 0xef, 0x20, 0xd4, 0x94, 0x8c,
+    0xbc, 0x74, 0x66, 0x2f, 0x50, 0xf2, 0xa2, 0x13, 0x3c, 0x15, 0x1b, 0x1c, 0xb5, 0xee, 0xeb, 0xaa,
+    0xbe, 0x0e, 0x1d, 0xd2, 0x58, 0xda, 0x54, 0x79, 0x9e, 0x20, 0x55, 0x73, 0x6c, 0x3e, 0x9a, 0xc7,
+    0x70, 0xcc, 0xa8, 0x4f, 0xa9, 0xb9, 0xb9, 0xf7, 0xd1, 0x52, 0x9e, 0x2c, 0x2d, 0x20, 0x33, 0xdc,
+    0x4c, 0xc8, 0x16, 0x39, 0x88, 0xf5, 0xef, 0xe7, 0x49, 0xdd, 0xbe, 0x37, 0xe7, 0x23, 0x32, 0x67,
+    0x97, 0xfd, 0x30, 0x89, 0xeb, 0x69, 0x22, 0x57, 0x9d, 0x03, 0xd0, 0x21, 0x4a, 0xa0, 0xf8, 0xb1,
+    0xb6, 0x0a, 0xfb, 0xd1, 0x09, 0x8a, 0x34, 0x5a, 0x56, 0xd6, 0x6d, 0xa4, 0x97, 0x58, 0xc7, 0xfa,
+    0xbe, 0x96, 0x75, 0x94, 0x77, 0xed, 0xac, 0x23, 0xbc, 0x7d, 0x67, 0x27, 0x9a, 0x77, 0xee, 0xfa,
+    0xa1, 0x85, 0x35, 0x95, 0x6e, 0x04, 0x38, 0x69, 0x93, 0x7c, 0x7e, 0x98, 0xdf, 0xc3, 0xf4, 0x30,
+    0x19, 0xd5, 0xce, 0x11, 0x66, 0xe4, 0x6c, 0x96, 0x14, 0x2f, 0x87, 0xbd, 0x35, 0x98, 0x0d, 0xaf,
+    0xb6, 0x0c, 0x51, 0x88, 0x5e, 0x8a, 0x45, 0x0e, 0xc6, 0xc0, 0x20, 0x04, 0x63, 0x48, 0x48, 0xc0,
+    0x78, 0x2d, 0xd8, 0x17, 0x7d, 0x19, 0xd3, 0xc1, 0x36, 0x9b, 0x0d, 0x70, 0x07, 0xf9, 0x85, 0x6d,
+    0xdc, 0x99, 0xb5, 0x8b, 0xc4, 0xc8, 0xb2, 0xf8, 0x1e, 0x50, 0x10, 0xef, 0x91, 0xdf, 0x9b, 0x9d,
+    0xd4, 0x09, 0x64, 0x52, 0x36, 0x99, 0x78, 0xa9, 0x87, 0x65, 0xb7, 0xfc, 0x71, 0x94, 0x23, 0x47,
+    0x28, 0xcf, 0x88, 0xed, 0xe0, 0x6e, 0x4c, 0x35, 0x2a, 0xc8, 0xc0, 0x76, 0x39, 0xaa, 0x5b, 0x1c,
+    0xa9, 0x87, 0xb1, 0x30, 0x6f, 0x85, 0xd8, 0x6e, 0x9f, 0x3a, 0xa7, 0xa8, 0xbe, 0xeb, 0x39, 0x8c,
+    0x89, 0x79, 0x4f, 0x70, 0x9e, 0x31, 0x1a, 0x8e, 0xe2, 0x56, 0xc4, 0x4e, 0x2a, 0x2b, 0x1d, 0xfa,
+    0x39, 0xdf, 0x5a, 0x6b, 0x2e, 0xd7, 0xef, 0x03, 0xe4, 0x5c, 0xe6, 0xb5, 0x3a, 0x74, 0x1c, 0x72,
+    0xd2, 0x6c, 0x57, 0xbb, 0x67, 0x76, 0x4f, 0x5e, 0x71, 0xc6, 0xab, 0x57, 0x4f, 0x95, 0xae, 0xda,
+    0xad, 0xd3, 0xbb, 0x57, 0x57, 0x1c, 0x9a, 0xb5, 0x10, 0x8f, 0xe8, 0x4c, 0xe6, 0x4d, 0x4e, 0xcd,
+    0x61, 0x84, 0x73, 0x79, 0x49, 0x62, 0x74, 0x39, 0xaf, 0x0b, 0x5c, 0x9e, 0xbe, 0x56, 0x87, 0x43,
+    0x8e, 0x17, 0xfc, 0xd2, 0x6e, 0x7c, 0xcd, 0x61, 0xb6, 0x6b, 0x82, 0x01, 0x0f, 0xaf, 0xad, 0xfd,
+    0x01, 0x1d, 0xab, 0x31, 0x99, 0xda, 0xc2, 0x9f, 0xdb, 0x42, 0x80, 0x60, 0x92, 0x53, 0xd2, 0x0a,
+    0x62, 0xbd, 0xd4, 0x9a, 0x95, 0x9c, 0x26, 0x2a, 0x47, 0x4c, 0x55, 0x75, 0x88, 0xa7, 0x17, 0xe0,
+    0x42, 0xae, 0x3d, 0xac, 0xe4, 0x3d, 0x6a, 0xfd, 0x4a, 0x0d, 0x02, 0xe5, 0x42, 0x6f, 0xb9, 0x68,
+    0x55, 0xb4, 0x93, 0x9d, 0x1a, 0x24, 0xca, 0xe9, 0x55, 0x0b, 0x94, 0xfe, 0xf2, 0x8c, 0xdf, 0xf6,
+    0x0d, 0x2a, 0x70, 0xbb, 0x60, 0xdd, 0x8b, 0x6e, 0xdf, 0x54, 0xc5, 0xd0, 0xc7, 0xb8, 0xd0, 0xaa,
+    0xff, 0xe0, 0x5f, 0x80, 0x2f, 0x76, 0x26, 0x2b, 0x65, 0xa6, 0x79, 0x77, 0x4c, 0x99, 0xd4, 0xb5,
+    0xe0, 0x66, 0x64, 0x67, 0x9a, 0xfa, 0x75, 0xce, 0xac, 0xc1, 0x7e, 0xd7, 0xdb, 0xda, 0x2a, 0x46,
+    0x25, 0x54, 0x7e, 0xfc, 0x04, 0x46, 0xce, 0x42, 0xd0, 0xee, 0xd6, 0x50, 0x0c, 0x76, 0x9a, 0xdb,
+    0xae, 0x87, 0xd6, 0xb9, 0x70, 0xec, 0x31, 0xef, 0x91, 0x36, 0xa4, 0xb6, 0x68, 0x13, 0x80, 0x02,
+    0xdd, 0xe0, 0x22, 0x93, 0xe6, 0x91, 0x80, 0xbd, 0xfa, 0x2d, 0x64, 0x8f, 0xa0, 0xf8, 0xd0, 0x03,
+    0x9a, 0xc2, 0x16, 0x0d, 0xe9, 0xb0, 0x73, 0x3e, 0x46, 0x28, 0x7c, 0x41, 0x86, 0xd3, 0x4a, 0xea,
+    0x85, 0xcb, 0x69, 0xe4, 0x1b, 0x92, 0x3a, 0x84, 0x10, 0x48, 0x96, 0x0a, 0xe4, 0x0b, 0x3a, 0x61,
+    0xbb, 0x0c, 0xc6, 0x1a, 0xf6, 0x37, 0x88, 0x46, 0x75, 0xa1, 0x51, 0xab, 0xda, 0xe1, 0xda, 0x96,
+    0xfa, 0xe8, 0x5c, 0x21, 0x90, 0x65, 0x19, 0x60, 0xd0, 0xb9, 0x72, 0xcc, 0x3d, 0x91, 0x6f, 0x23,
+    0x41, 0x45, 0xb2, 0xc3, 0x36, 0xbe, 0x38, 0x11, 0x82, 0xfb, 0xa5, 0xc0, 0x19, 0x41, 0x9f, 0x86,
+    0x26, 0x86, 0x18, 0xb9, 0xeb, 0x06, 0x97, 0xd6, 0x2d, 0x66, 0xac, 0x0f, 0x5d, 0xe1, 0x5c, 0xc1,
+    0xc2, 0x49, 0x34, 0x13, 0x90, 0xda, 0x51, 0x76, 0x3a, 0xbf, 0x95, 0x8a, 0x6d, 0xf3, 0x33, 0x94,
+    0x0f, 0x0b, 0x4b, 0x32, 0x57, 0x8f, 0xa2, 0xa8, 0xba, 0x35, 0x65, 0x99, 0xe0, 0x5b, 0x81, 0x5a,
+    0x75, 0xbf, 0xce, 0x33, 0x8b, 0x0a, 0x2d, 0xe1, 0x6c, 0x5d, 0xf4, 0x83, 0xcd, 0x5d, 0xde, 0xfe,
+    0x19, 0xf4, 0x7d, 0x2f, 0x98, 0x05, 0xe9, 0x83, 0xd4, 0xc4, 0x79, 0x7b, 0x42, 0x55, 0x0c, 0x9d,
+    0x98, 0x9e, 0x9a, 0xf8, 0x4e, 0x71, 0xbd, 0xbd, 0x13, 0xff, 0x8d, 0x00, 0x88, 0xe7, 0x5b, 0xfa,
+    0x20, 0x7a, 0x9a, 0x43, 0x2c, 0x5c, 0x38, 0xec, 0x26, 0x8f, 0x83, 0x60, 0x87, 0x55, 0x91, 0x43,
+    0xb7, 0x53, 0x5b, 0xc4, 0x62, 0x6c, 0xa4, 0xfa, 0x6b, 0x5a, 0x7f, 0x70, 0xfe, 0xf2, 0x74, 0xad,
+    0xaa, 0x52, 0xfd, 0xf2, 0xd4, 0xca, 0xb9, 0x4c, 0xf2, 0xfe, 0x90, 0xe4, 0x41, 0x85, 0x61, 0x92,
+    0x4d, 0x81, 0xb3, 0xbb, 0x0a, 0x59, 0xd7, 0x64, 0x9a, 0x0a, 0xc6, 0x8c, 0xf5, 0x3d, 0xc1, 0x11,
+    0xc5, 0x43, 0x3a, 0xd6, 0xdb, 0x1e, 0xb3, 0xfd, 0x90, 0x69, 0x63, 0xea, 0xd4, 0xe4, 0x9f, 0x7e,
+    0x02, 0xb8, 0x82, 0x22, 0xfe, 0xf9, 0x73, 0xfb, 0x72, 0xf8, 0xf9, 0xb5, 0xc8, 0x97, 0x37, 0x41,
+    0x0a, 0x8f, 0x0b, 0x78, 0x2c, 0xdb, 0x2f, 0xb7, 0x47, 0x4a, 0xeb, 0xe8, 0xf3, 0xe7, 0xf3, 0xf9,
+    0xec, 0x9e, 0x03, 0xb7, 0x6a, 0x0e, 0x9f, 0x57, 0xe0, 0x03, 0x6c, 0xf2, 0xed, 0xe2, 0x85, 0xe0,
+    0xf3, 0x63, 0xf5, 0xfa, 0xe5, 0x96, 0xc1, 0x7f, 0x7f, 0x03, 0xdf, 0xb7, 0x37, 0x01, 0x86, 0xf5,
+    0x35, 0xa2, 0xc7, 0x45, 0xf6, 0xe5, 0xb6, 0xf0, 0x57, 0xee, 0x76, 0xb5, 0x0c, 0x72, 0x67, 0xe3,
+    0x6e, 0x96, 0xf0, 0x93, 0x3b, 0xc1, 0xd2, 0x09, 0x1c, 0xdf, 0xdd, 0x2d, 0xe1, 0x27, 0x0f, 0x97,
+    0xa1, 0xeb, 0x79, 0x9b, 0xed, 0x7d, 0xbe, 0x75, 0xc3, 0xa5, 0x03, 0xbf, 0xf8, 0x10, 0xfb, 0xf5,
+    0xfd, 0x76, 0x01, 0x5a, 0xcf, 0xbf, 0xdc, 0xde, 0xac, 0x02, 0x90, 0xe7, 0xed, 0x67, 0xb1, 0x33,
+    0x3b, 0x18, 0x9e, 0x7e, 0x32, 0x95, 0x3f, 0x40, 0xde, 0xb1, 0x90, 0x0c, 0x79, 0xe0, 0x1d, 0x4e,
+    0xf1, 0xde, 0x5c, 0xcf, 0x4d, 0x6d, 0xbc, 0xd8, 0x6a, 0x77, 0xfc, 0xde, 0xd0, 0xad, 0x14, 0x84,
+    0x9a, 0xa4, 0x13, 0x51, 0x82, 0x3a, 0xa1, 0xba, 0x35, 0x59, 0x43, 0xc6, 0xd0, 0x1a, 0xa0, 0xe7,
+    0x06, 0x26, 0x43, 0x74, 0x2e, 0xaa, 0x0c, 0x47, 0xbd, 0x7b, 0x35, 0xb9, 0xb2, 0x80, 0x0c, 0xef,
+    0xd1, 0x29, 0x9f, 0x5e, 0x1d, 0x4c, 0x22, 0xb1, 0xd1, 0x49, 0xc5, 0xec, 0x6b, 0x54, 0x6b, 0x4e,
+    0xee, 0x70, 0x56, 0xb2, 0xca, 0xe6, 0xb6, 0x3b, 0x9f, 0x60, 0xdd, 0x94, 0x36, 0x53, 0xb6, 0x7a,
+    0x10, 0xca, 0xb8, 0x61, 0x41, 0x41, 0x70, 0xb8, 0x13, 0xee, 0xcc, 0x6a, 0xb0, 0x5f, 0x61, 0x51,
+    0xa7, 0xfd, 0x7b, 0x81, 0xde, 0x26, 0x0c, 0x6c, 0x38, 0xc7, 0x05, 0xb2, 0xba, 0xe1, 0x3f, 0x85,
+    0x78, 0x2b, 0x70, 0xda, 0xea, 0x30, 0xe2, 0x01, 0xac, 0x19, 0x5d, 0x5b, 0xf9, 0x5a, 0xb0, 0xb2,
+    0x54, 0xcf, 0xec, 0x12, 0x40, 0xfe, 0x8b, 0x94, 0x48, 0xf1, 0x7f, 0xf0, 0xce, 0x4a, 0x6c, 0xca,
+    0xbb, 0x67, 0x11, 0x77, 0x64, 0xf5, 0x4a, 0x62, 0xa4, 0xe1, 0xe0, 0x51, 0x33, 0x5f, 0x72, 0xf9,
+    0xf1, 0x55, 0x9f, 0x9a, 0xfd, 0x1f, 0xb3, 0x2a, 0x6d, 0x11, 0x1a, 0x28, 0x00, 0x00,
+};
+
+const gp_gzip_asset_t GP_GZIP_TABLE[] = {
+    {GP_JS_TOP, GP_JS_TOP_GZ, sizeof(GP_JS_TOP_GZ), "\"e8889933c71b708b\""},
+    {GP_JS_CANVAS, GP_JS_CANVAS_GZ, sizeof(GP_JS_CANVAS_GZ), "\"932615c5af3061d5\""},
+    {GP_LIGHT, GP_LIGHT_GZ, sizeof(GP_LIGHT_GZ), "\"491710243c67b986\""},
+    {GP_DARK, GP_DARK_GZ, sizeof(GP_DARK_GZ), "\"1a6f1a254e9b3f49\""},
+};
@@ -20,6 +20,12 @@ extern WebServer *_gp_s;
 #include "canvas.h"
 #include "scripts.h"
 #include "parsers.h"
+#include "themes.h"
+
+// Author: Vereshchynskyi Nazar. gzip_assets.h is made by scripts/gzip_assets.py
+#ifdef GP_GZIP_ASSETS
+#include "gzip_assets.h"
+#endif
 
 extern int _gp_bufsize;
 extern String* _GPP;
@@ -88,6 +94,11 @@ public:
         
         server.begin(port);
         
+        #ifdef GP_GZIP_ASSETS
+        const char* headers[] = {"If-None-Match", "Accept-Encoding"};
+        server.collectHeaders(headers, 2);
+        #endif
+        
         #if defined(FS_H)
         if (_fs) server.serveStatic("/gp_data", *_fs, "/gp_data", GP_CACHE_PRD); 
         #endif
@@ -672,10 +683,41 @@ public:
     }
     
     void sendFile_P(PGM_P file_P, const char* type) {
+        #ifdef GP_GZIP_ASSETS
+        for (const gp_gzip_asset_t& asset : GP_GZIP_TABLE) {
+            if (asset.plain == file_P) {
+                // one url, gzipped or plain by Accept-Encoding, so shared caches must key on it
+                server.sendHeader(F("Vary"), F("Accept-Encoding"));
+                
+                if (server.header(F("Accept-Encoding")).indexOf(F("gzip")) >= 0) {
+                    sendGzipFile_P(asset, type);
+                    return;
+                }
+                break;
+            }
+        }
+        #endif
+        
         if (_cache) server.sendHeader(F("Cache-Control"), GP_CACHE_PRD);
         server.send_P(200, type, file_P, strlen_P(file_P));
     }
     
+    #ifdef GP_GZIP_ASSETS
+    // Author: Vereshchynskyi Nazar. a matching ETag costs an empty 304 instead of the file
+    void sendGzipFile_P(const gp_gzip_asset_t& asset, const char* type) {
+        server.sendHeader(F("Cache-Control"), _cache ? F(GP_GZIP_CACHE_PRD) : F("no-cache"));
+        server.sendHeader(F("ETag"), asset.etag);
+        
+        if (server.header(F("If-None-Match")) == asset.etag) {
+            server.send(304);
+            return;
+        }
+        
+        server.sendHeader(F("Content-Encoding"), F("gzip"));
+        server.send_P(200, type, (PGM_P) asset.gzip, asset.size);
+    }
+    #endif
+    
     // задать размер буфера страницы, байт (умолч. 1000)
     void setBufferSize(int sz) {
         _bufsize = sz;
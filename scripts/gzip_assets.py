@@ -0,0 +1,104 @@
+# Project: Solar Battery Control System
+#
+# Author: Vereshchynskyi Nazar
+# Email: verechnazar12@gmail.com
+# Version: 1.3.1
+# Date: 04.02.2025
+#
+# Gzips the built-in GyverPortal scripts and themes into gzip_assets.h, so the
+# portal sends them compressed (GP_GZIP_ASSETS). Runs before every build as a
+# PlatformIO pre-script and only rewrites the header when the sources change.
+# Can also be run by hand: python scripts/gzip_assets.py
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+	# PlatformIO runs the script through SCons, there is no __file__
+	Import("env")
+	ROOT = env["PROJECT_DIR"]
+except NameError:
+	ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+GP_SRC = os.path.join(ROOT, "lib", "GyverPortal", "src")
+OUTPUT = os.path.join(GP_SRC, "gzip_assets.h")
+
+# header -> PROGMEM strings served by portal.h
+ASSETS = {
+	"scripts.h": ["GP_JS_TOP", "GP_JS_CANVAS"],
+	"themes.h": ["GP_LIGHT", "GP_DARK"],
+}
+
+RAW_STRING = re.compile(r'const char (\w+)\[\] PROGMEM = R"\((.*?)\)";', re.S)
+
+
+def read_assets():
+	assets = []
+
+	for header, names in ASSETS.items():
+		with open(os.path.join(GP_SRC, header), encoding="utf-8") as file:
+			strings = dict(RAW_STRING.findall(file.read()))
+
+		for name in names:
+			if name not in strings:
+				raise SystemExit("gzip_assets: %s not found in %s" % (name, header))
+
+			assets.append((name, strings[name].encode("utf-8")))
+
+	return assets
+
+
+def make_header(assets):
+	lines = [
+		"// generated by scripts/gzip_assets.py, do not edit",
+		"#pragma once",
+		"",
+		"struct gp_gzip_asset_t {",
+		"    PGM_P plain;",
+		"    const uint8_t* gzip;",
+		"    size_t size;",
+		"    const char* etag;",
+		"};",
+		"",
+	]
+	table = []
+
+	for name, data in assets:
+		# mtime 0 keeps the output and the ETag the same from build to build
+		packed = gzip.compress(data, 9, mtime=0)
+		etag = '"%s"' % hashlib.sha1(data).hexdigest()[:16]
+
+		lines.append("// %s: %u -> %u bytes" % (name, len(data), len(packed)))
+		lines.append("const uint8_t %s_GZ[] PROGMEM = {" % name)
+
+		for i in range(0, len(packed), 16):
+			lines.append("    " + ", ".join("0x%02x" % byte for byte in packed[i:i + 16]) + ",")
+
+		lines.append("};")
+		lines.append("")
+		table.append('    {%s, %s_GZ, sizeof(%s_GZ), "%s"},' % (name, name, name, etag.replace('"', '\\"')))
+
+	lines.append("const gp_gzip_asset_t GP_GZIP_TABLE[] = {")
+	lines.extend(table)
+	lines.append("};")
+	lines.append("")
+
+	return "\n".join(lines)
+
+
+def main():
+	header = make_header(read_assets())
+
+	if os.path.exists(OUTPUT):
+		with open(OUTPUT, encoding="utf-8") as file:
+			if file.read() == header:
+				return
+
+	with open(OUTPUT, "w", encoding="utf-8", newline="\n") as file:
+		file.write(header)
+
+	print("gzip_assets: %s updated" % os.path.relpath(OUTPUT, ROOT))
+
+
+main()
@@ -0,0 +1,133 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+// the Blynk elements of the core managers, core.h does not know BlynkParam and SystemManager
+#ifdef MODULE_MANAGER_BLYNK_SUPPORT
+void SensorsManager::addBlynkElementCodes(DynamicArray<String>* array) {
+	if (array == NULL) {
+		return;
+	}
+
+	array->add(String("HSt"));
+	array->add(String("HSh"));
+
+	for (uint8_t i = 0; i < ds18b20_data.size();i++) {
+		array->add(String("HSdst") + getDS18B20Name(i));
+	}
+}
+
+bool SensorsManager::blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals) {
+	if (link == NULL) {
+		return false;
+	}
+
+	*decimals = 2;
+
+	if (!strcmp(link->element_code, "HSt")) {
+		*centi = getAM2320TCenti();
+		return true;
+	}
+	
+	if (!strcmp(link->element_code, "HSh")) {
+		*centi = getAM2320HCenti();
+		return true;
+	}
+
+	for (uint8_t i = 0;i < getDS18B20Count();i++) {
+		if (!getDS18B20Status(i)) {
+			char element_code[BLYNK_ELEMENT_CODE_SIZE] = "HSdst";
+			strcat(element_code, getDS18B20Name(i));
+
+			if (!strcmp(link->element_code, element_code)) {
+				*centi = getDS18B20TCenti(i);
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+blynk_handler_t SensorsManager::blynkElementHandler(const char* code) {
+	return NULL;
+}
+#endif
+
+
+#ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
+void SolarSystemManager::addBlynkElementCodes(DynamicArray<String>* array) {
+	if (array == NULL) {
+		return;
+	}
+
+	array->add(String("SSSs"));
+	array->add(String("HSSpu"));
+	array->add(String("SSEp"));
+	array->add(String("SSEd"));
+	array->add(String("SSEm"));
+	array->add(String("SSEl"));
+}
+
+bool SolarSystemManager::blynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals) {
+	if (link == NULL) {
+		return false;
+	}
+
+	*decimals = 0;
+
+	if (!strcmp(link->element_code, "SSSs")) {
+		*centi = getWorkFlag() * 100;
+		return true;
+	}
+	
+	if (!strcmp(link->element_code, "HSSpu")) {
+		*centi = getReleFlag() * 100;
+		return true;
+	}
+
+	// centi holds at most 327.67: kW and kWh for now and the day, MWh for the rest
+	*decimals = 2;
+
+	if (!strcmp(link->element_code, "SSEp")) {
+		*centi = min(energy.getPower() / 10, (uint32_t) INT16_MAX);
+		return true;
+	}
+
+	if (!strcmp(link->element_code, "SSEd")) {
+		*centi = min(energy.getDayEnergy() / 10, (uint32_t) INT16_MAX);
+		return true;
+	}
+
+	if (!strcmp(link->element_code, "SSEm")) {
+		*centi = min(energy.getMonthEnergy() / 10000, (uint32_t) INT16_MAX);
+		return true;
+	}
+
+	if (!strcmp(link->element_code, "SSEl")) {
+		*centi = min(energy.getLifetimeEnergy() / 10000, (uint32_t) INT16_MAX);
+		return true;
+	}
+
+	return false;
+}
+
+blynk_handler_t SolarSystemManager::blynkElementHandler(const char* code) {
+	if (!strcmp(code, "SSSs")) {
+		return BLYNK_HANDLER(system->getSolarSystemManager()->setWorkFlag(param.asInt()));
+	}
+	
+	if (!strcmp(code, "HSSpu")) {
+		return BLYNK_HANDLER(system->getSolarSystemManager()->setReleFlag(param.asInt(), RELE_REASON_BLYNK));
+	}
+
+	return NULL;
+}
+#endif
@@ -13,48 +13,69 @@ BlynkManager::BlynkManager() {
 	makeDefault();
 }
 
+void BlynkManager::begin() {
+	queue.begin();
+}
+
 
 void BlynkManager::tick() {
 	NetworkManager* network = system->getNetworkManager();
 
-	if (!getWorkFlag() || network->getStatus() != WL_CONNECTED) {
+	if (!getWorkFlag() || !*getAuth()) {
 		return;
 	}
 
-	if (network->getStatus() == WL_CONNECTED && !getStatus()) {
-		connectBlynk();
+	if (network->getStatus() != WL_CONNECTED) {
+		if (connect_state != BLYNK_CONNECT_IDLE) {
+			disconnectBlynk();
+		}
+	}
+	else {
+		connectTick();
 	}
 
+	// data is collected offline too, it goes to the queue then
 	if (millis() - send_data_timer > SEC_TO_MLS(getSendDataTime()) ) {
 		send_data_timer = millis();
+		PROFILE(system->getProfiler(), PROFILE_BLYNK_SEND, sendData());
+	}
 
-		if (getStatus()) {
-			sendData();
-		}
+	if (connect_state != BLYNK_CONNECT_READY) {
+		return;
 	}
-	
+
+	replayTick();
 	Blynk.run();
 }
 
 void BlynkManager::makeDefault() {
 	links.~DynamicArray();
+	memset(port_links, BLYNK_NO_LINK, sizeof(port_links));
 
 	work_flag = DEFAULT_BLYNK_WORK_STATUS;
 	send_data_time = DEFAULT_BLYNK_SEND_DATA_TIME;
+	silence_time = DEFAULT_BLYNK_SILENCE_TIME;
 	memset(auth, 0, BLYNK_AUTH_SIZE);
 
 	send_data_timer = 0;
-	blynk_reconnect_timer = 0;
+	replay_timer = 0;
+
+	connect_state = BLYNK_CONNECT_IDLE;
+	connect_timer = 0;
+	connect_delay = SEC_TO_MLS(BLYNK_RECONNECT_MIN_TIME);
+	server_ip = 0;
 }
 
 void BlynkManager::writeSettings(char* buffer) {
 	setParameter(buffer, "SBs", getWorkFlag());
 	setParameter(buffer, "SBsdt", getSendDataTime());
+	setParameter(buffer, "SBsl", getSilenceTime());
 	setParameter(buffer, "SBa", (const char*) getAuth());
 
 	for (uint8_t i = 0;i < links.size();i++) {
 		setParameter(buffer, String("SBLp") + i, getLinkPort(i));
 		setParameter(buffer, String("SBLe") + i, (const char*) getLinkElementCode(i));
+		setParameter(buffer, String("SBLdb") + i, getLinkDeadband(i));
 	}
 }
 
@@ -64,16 +85,21 @@ void BlynkManager::readSettings(char* buffer) {
 
 	getParameter(buffer, "SBs", &work_flag);
 	getParameter(buffer, "SBsdt", &send_data_time);
+	getParameter(buffer, "SBsl", &silence_time);
 	getParameter(buffer, "SBa", auth, BLYNK_AUTH_SIZE);
 
 	while (getParameter(buffer, String("SBLe") + link_index, element_code, BLYNK_ELEMENT_CODE_SIZE)) {
 		if (addLink()) {
 			uint8_t link_port;
+			uint16_t link_deadband;
 			setLinkElementCode(link_index, element_code);
 
 			if (getParameter(buffer, String("SBLp") + link_index, &link_port)) {
 				setLinkPort(link_index, link_port);
 			}
+			if (getParameter(buffer, String("SBLdb") + link_index, &link_deadband)) {
+				setLinkDeadband(link_index, link_deadband);
+			}
 		}
 
 		link_index++;
@@ -81,13 +107,20 @@ void BlynkManager::readSettings(char* buffer) {
 	
 	setWorkFlag(work_flag);
 	setSendDataTime(send_data_time);
+	setSilenceTime(silence_time);
 	setAuth(auth);
 }
 
 
 bool BlynkManager::addLink() {
+	if (links.size() >= BLYNK_LINKS_MAX) {
+		return false;
+	}
+
 	if (links.add()) {
+		*links[links.size() - 1].element_code = '\0';
 		setLinkPort(links.size() - 1, links.size() - 1);
+		setLinkDeadband(links.size() - 1, DEFAULT_BLYNK_DEADBAND);
 
 		return true;
 	}
@@ -97,6 +130,7 @@ bool BlynkManager::addLink() {
 
 bool BlynkManager::deleteLink(uint8_t index) {
 	if (links.del(index)) {
+		updateHandlers();
 		return true;
 	}
 
@@ -137,6 +171,10 @@ void BlynkManager::setSendDataTime(uint8_t time) {
 	send_data_time = constrain(time, 0, 100);
 }
 
+void BlynkManager::setSilenceTime(uint16_t time) {
+	silence_time = constrain(time, 0, BLYNK_SILENCE_TIME_MAX);
+}
+
 void BlynkManager::setAuth(String auth) {
 	if (!*auth.c_str()) {
 		strcpy(this->auth, "");
@@ -145,7 +183,13 @@ void BlynkManager::setAuth(String auth) {
 		return;
 	}
 	
-	strcpy(this->auth, auth.c_str());
+	if (strcmp(this->auth, auth.c_str())) {
+		strcpy(this->auth, auth.c_str());
+
+		disconnectBlynk();
+		connect_timer = 0;
+		connect_delay = SEC_TO_MLS(BLYNK_RECONNECT_MIN_TIME);
+	}
 }
 
 
@@ -155,6 +199,9 @@ void BlynkManager::setLinkPort(uint8_t index, uint8_t port) {
 	}
 
 	links[index].port = port;
+	links[index].sent_flag = false;
+
+	updateHandlers();
 }
 
 void BlynkManager::setLinkElementCode(uint8_t index, String code) {
@@ -163,6 +210,17 @@ void BlynkManager::setLinkElementCode(uint8_t index, String code) {
 	}
 
 	strcpy(links[index].element_code, code.c_str());
+	links[index].sent_flag = false;
+
+	updateHandlers();
+}
+
+void BlynkManager::setLinkDeadband(uint8_t index, uint16_t deadband) {
+	if (!isCorrectLinkIndex(index)) {
+		return;
+	}
+
+	links[index].deadband = deadband;
 }
 
 
@@ -174,6 +232,10 @@ bool BlynkManager::getStatus() {
 	return Blynk.connected();
 }
 
+uint8_t BlynkManager::getConnectState() {
+	return connect_state;
+}
+
 
 bool BlynkManager::getWorkFlag() {
 	return work_flag;
@@ -183,6 +245,10 @@ uint8_t BlynkManager::getSendDataTime() {
 	return send_data_time;
 }
 
+uint16_t BlynkManager::getSilenceTime() {
+	return silence_time;
+}
+
 char* BlynkManager::getAuth() {
 	return auth;
 }
@@ -208,6 +274,18 @@ char* BlynkManager::getLinkElementCode(uint8_t index) {
 	return links[index].element_code;
 }
 
+uint16_t BlynkManager::getLinkDeadband(uint8_t index) {
+	if (!isCorrectLinkIndex(index)) {
+		return 0;
+	}
+
+	return links[index].deadband;
+}
+
+BlynkQueue* BlynkManager::getQueue() {
+	return &queue;
+}
+
 
 bool BlynkManager::isCorrectLinkIndex(uint8_t index) {
 	if (index >= getLinksCount()) {
@@ -232,41 +310,298 @@ int8_t BlynkManager::scanLinkIndex(String element_code) {
 }
 
 
-void BlynkManager::connectBlynk() {
-	if (!*getAuth()) {
-		return;
+// one step per tick: dns, tcp connect, login, so the loop never waits for the cloud
+void BlynkManager::connectTick() {
+	switch (connect_state) {
+	case BLYNK_CONNECT_IDLE: {
+		if (connect_timer && millis() - connect_timer < connect_delay) {
+			break;
+		}
+		connect_timer = millis();
+
+		// jittered exponential backoff, reset once the login succeeds
+		connect_delay = min(connect_delay * 2, (uint32_t) SEC_TO_MLS(BLYNK_RECONNECT_MAX_TIME));
+		connect_delay += (int32_t) connect_delay * random(-BLYNK_RECONNECT_JITTER, BLYNK_RECONNECT_JITTER + 1) / 100;
+
+		ip_addr_t address;
+		dns_done_flag = false;
+		err_t result = dns_gethostbyname(BLYNK_DEFAULT_DOMAIN, &address, dnsFound, NULL);
+
+		if (result == ERR_OK) {
+			server_ip = ip_addr_get_ip4_u32(&address);
+			connect_state = BLYNK_CONNECT_TCP;
+			armBlynk();
+		}
+		else if (result == ERR_INPROGRESS) {
+			connect_state = BLYNK_CONNECT_RESOLVE;
+		}
+
+		break;
 	}
 
-	if (!blynk_reconnect_timer || millis() - blynk_reconnect_timer >= SEC_TO_MLS(BLYNK_RECONNECT_TIME)) {
-		blynk_reconnect_timer = millis();
+	case BLYNK_CONNECT_RESOLVE:
+		if (dns_done_flag) {
+			dns_done_flag = false;
+
+			if (!dns_ip) {
+				disconnectBlynk();
+				break;
+			}
+
+			server_ip = dns_ip;
+			connect_state = BLYNK_CONNECT_TCP;
+			connect_timer = millis();
+			armBlynk();
+		}
+		else if (millis() - connect_timer >= BLYNK_DNS_TIMEOUT) {
+			disconnectBlynk();
+		}
+
+		break;
+
+	case BLYNK_CONNECT_TCP:
+		// Blynk.run() makes the tcp connect and sends the login, the step bounds one attempt and a slow server gets the next tick
+		_blynkWifiClient.setTimeout(BLYNK_CONNECT_STEP_TIME);
+		Blynk.run();
+		_blynkWifiClient.setTimeout(BLYNK_TIMEOUT_MS);
 
-		Blynk.config(this->auth);
-		Blynk.connect(10);
+		if (!_blynkTransport.connected()) {
+			if (millis() - connect_timer >= BLYNK_CONNECT_TIMEOUT) {
+				disconnectBlynk();
+			}
+			else {
+				armBlynk();
+			}
+
+			break;
+		}
+
+		connect_state = BLYNK_CONNECT_LOGIN;
+		connect_timer = millis();
+		break;
+
+	case BLYNK_CONNECT_LOGIN:
+		Blynk.run();
+
+		if (Blynk.connected()) {
+			connect_state = BLYNK_CONNECT_READY;
+			connect_delay = SEC_TO_MLS(BLYNK_RECONNECT_MIN_TIME);
+
+			// the server keeps nothing for a new session, so every link is sent again
+			for (uint8_t i = 0;i < links.size();i++) {
+				links[i].sent_flag = false;
+			}
+		}
+		else if (Blynk.isTokenInvalid()) {
+			disconnectBlynk();
+			connect_delay = SEC_TO_MLS(BLYNK_RECONNECT_MAX_TIME);
+		}
+		else if (!_blynkTransport.connected() || millis() - connect_timer >= BLYNK_LOGIN_TIMEOUT) {
+			disconnectBlynk();
+		}
+
+		break;
+
+	case BLYNK_CONNECT_READY:
+		if (!Blynk.connected()) {
+			disconnectBlynk();
+		}
+
+		break;
 	}
 }
 
+// run() connects only 5 sec after the last attempt, config() moves the last attempt back so the next tick makes one
+void BlynkManager::armBlynk() {
+	Blynk.config(this->auth, IPAddress(server_ip));
+	Blynk.connect(0); // only arms the connection, run() does the rest
+}
+
 void BlynkManager::disconnectBlynk() {
+	// Blynk must not reconnect on its own, that is a blocking connect inside run()
 	Blynk.disconnect();
+	connect_state = BLYNK_CONNECT_IDLE;
+}
+
+void BlynkManager::dnsFound(const char* name, const ip_addr_t* ipaddr, void* callback_arg) {
+	dns_ip = (ipaddr != NULL) ? ip_addr_get_ip4_u32(ipaddr) : 0;
+	dns_done_flag = true;
 }
 
 
+// only changed values are sent, all of them packed into one write
 void BlynkManager::sendData() {
+	blynk_record_t records[BLYNK_LINKS_MAX];
+	uint8_t record_links[BLYNK_LINKS_MAX];
+	uint8_t count = 0;
+	uint32_t unix = system->getTimeManager()->getUnix();
+
+	for (uint8_t i = 0;i < links.size();i++) {
+		blynk_link_t* link = &links[i];
+		int16_t centi;
+		uint8_t decimals;
+
+		if (!system->makeBlynkElementValue(link, &centi, &decimals)) {
+			continue;
+		}
+
+		bool silence_flag = silence_time && millis() - link->send_timer >= SEC_TO_MLS((uint32_t) silence_time);
+
+		if (link->sent_flag && !silence_flag && abs(centi - link->last_centi) <= link->deadband) {
+			continue;
+		}
+
+		records[count] = {unix, centi, link->port, decimals};
+		record_links[count++] = i;
+	}
+
+	uint8_t packet[BLYNK_PACKET_SIZE];
+	uint8_t sent_count = 0;
+
+	// a failed write disconnects, what is left goes to the queue
+	while (connect_state == BLYNK_CONNECT_READY && sent_count < count) {
+		uint16_t length = 0;
+		uint8_t packet_count = 0;
+
+		while (sent_count + packet_count < count && length + BLYNK_FRAME_SIZE <= BLYNK_PACKET_SIZE) {
+			blynk_record_t* record = &records[sent_count + packet_count++];
+			char buffer[CENTI_STRING_SIZE];
+
+			length += makeFrame(&packet[length], record->port, centiToString(record->centi, record->decimals, buffer));
+		}
+
+		if (!writePacket(packet, length)) {
+			break;
+		}
+
+		sent_count += packet_count;
+	}
+
+	for (uint8_t i = 0;i < count;i++) {
+		blynk_link_t* link = &links[record_links[i]];
+
+		if (i >= sent_count) {
+			// without time a record can not be placed on the chart later
+			if (unix < BLYNK_QUEUE_MIN_UNIX) {
+				continue;
+			}
+
+			queue.push(&records[i]);
+		}
+
+		link->last_centi = records[i].centi;
+		link->send_timer = millis();
+		link->sent_flag = true;
+	}
+}
+
+// queued records go out as timestamped groups: "t\0ms", values, "e"
+void BlynkManager::replayTick() {
+	if (!queue.getCount() || millis() - replay_timer < BLYNK_REPLAY_TIME) {
+		return;
+	}
+	replay_timer = millis();
+
+	// BLYNK_REPLAY_COUNT records fit the packet even if each one has its own group
+	blynk_record_t records[BLYNK_REPLAY_COUNT];
+	uint8_t packet[BLYNK_PACKET_SIZE];
+	uint16_t length = 0;
+	uint8_t count = queue.read(records, BLYNK_REPLAY_COUNT);
+
+	for (uint8_t i = 0;i < count;i++) {
+		char buffer[CENTI_STRING_SIZE];
+
+		if (!i || records[i].unix != records[i - 1].unix) {
+			if (i) {
+				length += makeGroupFrame(&packet[length], 0);
+			}
+
+			length += makeGroupFrame(&packet[length], records[i].unix);
+		}
+
+		length += makeFrame(&packet[length], records[i].port, centiToString(records[i].centi, records[i].decimals, buffer));
+	}
+
+	if (count) {
+		length += makeGroupFrame(&packet[length], 0);
+
+		// the batch stays queued until it is written
+		if (!writePacket(packet, length)) {
+			return;
+		}
+	}
+
+	queue.pop(count);
+}
+
+// BLYNK_CMD_HARDWARE frame, the same one virtualWrite() makes: "vw\0port\0value"
+uint8_t BlynkManager::makeFrame(uint8_t* frame, uint8_t port, const char* value) {
+	uint16_t body_length = sprintf((char*) &frame[BLYNK_HEADER_SIZE], "vw%c%u%c%s", '\0', port, '\0', value);
+
+	return makeHeader(frame, BLYNK_CMD_HARDWARE, body_length);
+}
+
+// BLYNK_CMD_GROUP frame as Blynk.beginGroup(ms) / endGroup() make it, 0 ends the group
+uint8_t BlynkManager::makeGroupFrame(uint8_t* frame, uint32_t unix) {
+	char* body = (char*) &frame[BLYNK_HEADER_SIZE];
+	uint16_t body_length = unix ? sprintf(body, "t%c%lu000", '\0', (unsigned long) unix) : sprintf(body, "e");
+
+	return makeHeader(frame, BLYNK_CMD_GROUP, body_length);
+}
+
+uint8_t BlynkManager::makeHeader(uint8_t* frame, uint8_t command, uint16_t body_length) {
+	uint16_t id = Blynk.getNextMsgId();
+
+	frame[0] = command;
+	frame[1] = id >> 8;
+	frame[2] = id;
+	frame[3] = body_length >> 8;
+	frame[4] = body_length;
+
+	return BLYNK_HEADER_SIZE + body_length;
+}
+
+// element codes are compared only here, an incoming write is one table lookup
+void BlynkManager::updateHandlers() {
+	memset(port_links, BLYNK_NO_LINK, sizeof(port_links));
+
 	for (uint8_t i = 0;i < links.size();i++) {
-		system->makeBlynkElementSend(&Blynk, &links[i]);
+		links[i].handler = system->makeBlynkElementHandler(links[i].element_code);
+
+		// with several links on one port the first one gets the writes
+		if (links[i].handler != NULL && port_links[links[i].port] == BLYNK_NO_LINK) {
+			port_links[links[i].port] = i;
+		}
+	}
+}
+
+bool BlynkManager::writePacket(uint8_t* packet, uint16_t length) {
+	if (_blynkTransport.write(packet, length) != length) {
+		disconnectBlynk();
+		return false;
 	}
+
+	return true;
 }
 
 extern SystemManager systemManager;
 BLYNK_WRITE_DEFAULT() {
 	BlynkManager* blynk = systemManager.getBlynkManager();
 
-	for (uint8_t i = 0;i < blynk->getLinksCount();i++) {
-		if (blynk->getLinkPort(i) == request.pin) {
-			systemManager.makeBlynkElementParse(blynk->getLinkElementCode(i), param);
-		}
+	if (request.pin < 0 || request.pin >= BLYNK_PORTS_COUNT) {
+		return;
+	}
+
+	uint8_t link_index = blynk->port_links[request.pin];
+
+	if (link_index != BLYNK_NO_LINK) {
+		blynk->links[link_index].handler(&systemManager, param);
 	}
 }
 
+volatile bool BlynkManager::dns_done_flag = false;
+volatile uint32_t BlynkManager::dns_ip = 0;
+
 WiFiClient BlynkManager::_blynkWifiClient = WiFiClient();
 BlynkArduinoClient BlynkManager::_blynkTransport = BlynkArduinoClient(_blynkWifiClient);
 BlynkWifi BlynkManager::Blynk = BlynkWifi(_blynkTransport); 
\ No newline at end of file
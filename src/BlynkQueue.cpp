@@ -0,0 +1,125 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+BlynkQueue::BlynkQueue() {
+	head = 0;
+	count = 0;
+
+	file_count = 0;
+	file_read = 0;
+	drop_count = 0;
+}
+
+void BlynkQueue::begin() {
+	int32_t file_size = halFileSize(BLYNK_QUEUE_FILE);
+
+	// records left from the last run are replayed too
+	if (file_size > 0) {
+		file_count = min(file_size / sizeof(blynk_record_t), (size_t) BLYNK_QUEUE_FILE_MAX);
+	}
+}
+
+
+void BlynkQueue::push(blynk_record_t* record) {
+	if (count == BLYNK_QUEUE_SIZE) {
+		spill();
+
+		if (count == BLYNK_QUEUE_SIZE) {
+			drop_count++;
+			return;
+		}
+	}
+
+	records[(head + count) % BLYNK_QUEUE_SIZE] = *record;
+	count++;
+}
+
+// the file is read out before RAM, a batch never mixes them
+uint8_t BlynkQueue::read(blynk_record_t* records, uint8_t count) {
+	uint8_t result = 0;
+
+	if (file_read < file_count) {
+		int32_t size = min((uint16_t) count, (uint16_t) (file_count - file_read)) * sizeof(blynk_record_t);
+
+		size = halFileRead(BLYNK_QUEUE_FILE, records, size, file_read * sizeof(blynk_record_t));
+		return (size > 0) ? size / sizeof(blynk_record_t) : 0;
+	}
+
+	for (;result < count && result < this->count;result++) {
+		records[result] = this->records[(head + result) % BLYNK_QUEUE_SIZE];
+	}
+
+	return result;
+}
+
+void BlynkQueue::pop(uint8_t count) {
+	if (file_read < file_count) {
+		file_read = min((uint16_t) (file_read + count), file_count);
+
+		if (file_read == file_count) {
+			halFileRemove(BLYNK_QUEUE_FILE);
+
+			file_count = 0;
+			file_read = 0;
+		}
+
+		return;
+	}
+
+	count = min(count, this->count);
+	head = (head + count) % BLYNK_QUEUE_SIZE;
+	this->count -= count;
+}
+
+void BlynkQueue::clear() {
+	halFileRemove(BLYNK_QUEUE_FILE);
+
+	head = 0;
+	count = 0;
+	file_count = 0;
+	file_read = 0;
+}
+
+
+uint16_t BlynkQueue::getCount() {
+	return file_count - file_read + count;
+}
+
+uint16_t BlynkQueue::getDropCount() {
+	return drop_count;
+}
+
+
+// RAM goes to the file as one block, so the flash is written once per BLYNK_QUEUE_SIZE records
+void BlynkQueue::spill() {
+	if (file_count + count > BLYNK_QUEUE_FILE_MAX) {
+		return;
+	}
+
+	// the ring is at most two blocks
+	uint8_t first_count = min((uint8_t) (BLYNK_QUEUE_SIZE - head), count);
+
+	if (!halFileWrite(BLYNK_QUEUE_FILE, &records[head], first_count * sizeof(blynk_record_t), true)) {
+		return;
+	}
+
+	if (first_count < count && !halFileWrite(BLYNK_QUEUE_FILE, records, (count - first_count) * sizeof(blynk_record_t), true)) {
+		// the wrapped part stays in RAM
+		file_count += first_count;
+		head = 0;
+		count -= first_count;
+		return;
+	}
+
+	file_count += count;
+	head = 0;
+	count = 0;
+}
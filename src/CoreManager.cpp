@@ -0,0 +1,74 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "core.h"
+
+CoreManager::CoreManager() {
+	save_settings_request = false;
+}
+
+void CoreManager::begin() {
+	time.setSystemManager(this);
+	sensors.setSystemManager(this);
+	solar.setSystemManager(this);
+
+	time.begin();
+	sensors.begin();
+	solar.begin();
+}
+
+
+void CoreManager::tick() {
+	time.tick();
+	sensors.tick();
+	solar.tick();
+}
+
+void CoreManager::writeSettings(char* buffer) {
+	time.writeSettings(buffer);
+	sensors.writeSettings(buffer);
+	solar.writeSettings(buffer);
+}
+
+void CoreManager::readSettings(char* buffer) {
+	time.readSettings(buffer);
+	sensors.readSettings(buffer);
+	solar.readSettings(buffer);
+}
+
+
+bool CoreManager::ntpSync(TimeManager* time) {
+	return false;
+}
+
+bool CoreManager::deleteBlynkLink(String element_code) {
+	return false;
+}
+
+bool CoreManager::modifyBlynkLinkElementCode(String previous_code, String new_code) {
+	return false;
+}
+
+
+void CoreManager::saveSettingsRequest() {
+	save_settings_request = true;
+}
+
+
+TimeManager* CoreManager::getTimeManager() {
+	return &time;
+}
+
+SensorsManager* CoreManager::getSensorsManager() {
+	return &sensors;
+}
+
+SolarSystemManager* CoreManager::getSolarSystemManager() {
+	return &solar;
+}
@@ -26,7 +26,10 @@ void DisplayManager::begin() {
 
 
 void DisplayManager::tick() {
+	EncoderQueue* enc = getSystemManager()->getEncoder();
+
 	if (!getWorkFlag()) {
+		enc->clear();
 		return;
 	}
 	
@@ -42,6 +45,21 @@ void DisplayManager::tick() {
 		}
 	}
 	
+	for (uint8_t i = 0;i < ENC_QUEUE_SIZE && enc->next();i++) {
+		if (action()) {
+			enc->clear();
+			break;
+		}
+
+		Window* window = getWindowFromStack();
+		if (window == NULL) {
+			break;
+		}
+
+		window->print(getLcdManager(), this, getSystemManager());
+	}
+	enc->resetStates();
+
 	if (!backlight_flag) {
 		return;
 	}
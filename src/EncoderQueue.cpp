@@ -0,0 +1,138 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+EncoderQueue::EncoderQueue() {
+	head = 0;
+	tail = 0;
+	lost_count = 0;
+
+	event_type = ENC_EVENT_NONE;
+	event_step = 0;
+	last_turn_type = ENC_EVENT_NONE;
+	last_turn_time = 0;
+	accel = 1;
+}
+
+// Producer side: called only from SystemManager::encoderPoll() (ISR or interrupts disabled)
+ICACHE_RAM_ATTR void EncoderQueue::push(uint8_t type) {
+	uint8_t next_head = (head + 1) & (ENC_QUEUE_SIZE - 1);
+
+	if (next_head == tail) {
+		lost_count++;
+		return;
+	}
+
+	events[head].type = type;
+	events[head].time = millis();
+	head = next_head;
+}
+
+// Consumer side: main loop only
+bool EncoderQueue::next() {
+	event_type = ENC_EVENT_NONE;
+	event_step = 0;
+
+	if (tail == head) {
+		return false;
+	}
+
+	event_type = events[tail].type;
+	uint32_t event_time = events[tail].time;
+	tail = (tail + 1) & (ENC_QUEUE_SIZE - 1);
+
+	if (event_type >= ENC_EVENT_LEFT && event_type <= ENC_EVENT_RIGHT_H) {
+		if (event_type == last_turn_type && event_time - last_turn_time < ENC_FAST_TIME) {
+			accel = min(accel + 1, ENC_ACCEL_MAX);
+		}
+		else {
+			accel = 1;
+		}
+
+		last_turn_type = event_type;
+		last_turn_time = event_time;
+		event_step = (event_type == ENC_EVENT_LEFT || event_type == ENC_EVENT_LEFT_H) ? -accel : accel;
+	}
+
+	return true;
+}
+
+void EncoderQueue::clear() {
+	tail = head;
+	resetStates();
+}
+
+
+bool EncoderQueue::isTurn() {
+	return event_type >= ENC_EVENT_LEFT && event_type <= ENC_EVENT_RIGHT_H;
+}
+
+bool EncoderQueue::isLeft(bool keep_flag) {
+	return checkEvent(ENC_EVENT_LEFT, keep_flag);
+}
+
+bool EncoderQueue::isRight(bool keep_flag) {
+	return checkEvent(ENC_EVENT_RIGHT, keep_flag);
+}
+
+bool EncoderQueue::isLeftH(bool keep_flag) {
+	return checkEvent(ENC_EVENT_LEFT_H, keep_flag);
+}
+
+bool EncoderQueue::isRightH(bool keep_flag) {
+	return checkEvent(ENC_EVENT_RIGHT_H, keep_flag);
+}
+
+bool EncoderQueue::isPress() {
+	return checkEvent(ENC_EVENT_PRESS, false);
+}
+
+bool EncoderQueue::isClick() {
+	return checkEvent(ENC_EVENT_CLICK, false);
+}
+
+bool EncoderQueue::isHolded() {
+	return checkEvent(ENC_EVENT_HOLDED, false);
+}
+
+void EncoderQueue::resetStates() {
+	event_type = ENC_EVENT_NONE;
+	event_step = 0;
+}
+
+
+int8_t EncoderQueue::getStep() {
+	return event_step;
+}
+
+int8_t EncoderQueue::getStep(int32_t range) {
+	if (range >= ENC_ACCEL_RANGE || event_step == 0) {
+		return event_step;
+	}
+
+	return (event_step < 0) ? -1 : 1;
+}
+
+uint16_t EncoderQueue::getLostCount() {
+	return lost_count;
+}
+
+
+bool EncoderQueue::checkEvent(uint8_t type, bool keep_flag) {
+	if (event_type != type) {
+		return false;
+	}
+
+	if (!keep_flag) {
+		event_type = ENC_EVENT_NONE;
+	}
+
+	return true;
+}
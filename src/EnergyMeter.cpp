@@ -0,0 +1,115 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "core.h"
+
+EnergyMeter::EnergyMeter() {
+	memset(&totals, 0, sizeof(energy_totals_t));
+	memset(power, 0, sizeof(power));
+
+	units = 0;
+	save_flag = false;
+	save_timer = 0;
+}
+
+void EnergyMeter::begin() {
+	if (halFileSize(ENERGY_FILE) == sizeof(energy_totals_t)) {
+		halFileRead(ENERGY_FILE, &totals, sizeof(energy_totals_t), 0);
+	}
+
+	save_timer = halMillis();
+}
+
+
+// the day and month totals start over once the clock is set and shows a new date
+void EnergyMeter::tick(uint32_t unix, uint8_t day, uint8_t month) {
+	if (unix >= TIME_MIN_UNIX && (day != totals.day || month != totals.month)) {
+		totals.day_energy = 0;
+
+		if (month != totals.month) {
+			totals.month_energy = 0;
+		}
+
+		totals.day = day;
+		totals.month = month;
+		save();
+	}
+
+	if (save_flag && halMillis() - save_timer >= SEC_TO_MLS(ENERGY_SAVE_TIME)) {
+		save();
+	}
+}
+
+// Q = m * c * dT in fixed point, what is below 1 Wh waits for the next read
+void EnergyMeter::add(uint8_t loop, uint8_t flow, uint16_t cp, int16_t delta_centi, uint32_t time) {
+	if (loop >= SOLAR_LOOPS_MAX) {
+		return;
+	}
+
+	// heat going back to the source is not a harvest
+	if (delta_centi <= 0) {
+		power[loop] = 0;
+		return;
+	}
+
+	power[loop] = (uint64_t) flow * cp * delta_centi / 60000;
+	units += (uint64_t) flow * cp * delta_centi * time;
+
+	if (units >= ENERGY_UNITS_PER_WH) {
+		uint32_t energy = units / ENERGY_UNITS_PER_WH;
+
+		units %= ENERGY_UNITS_PER_WH;
+		totals.day_energy += energy;
+		totals.month_energy += energy;
+		totals.lifetime_energy += energy;
+		save_flag = true;
+	}
+}
+
+void EnergyMeter::clear() {
+	totals.day_energy = 0;
+	totals.month_energy = 0;
+	totals.lifetime_energy = 0;
+	units = 0;
+
+	save();
+}
+
+
+// W, all loops
+uint32_t EnergyMeter::getPower() {
+	uint32_t result = 0;
+
+	for (uint8_t i = 0;i < SOLAR_LOOPS_MAX;i++) {
+		result += power[i];
+	}
+
+	return result;
+}
+
+uint32_t EnergyMeter::getDayEnergy() {
+	return totals.day_energy;
+}
+
+uint32_t EnergyMeter::getMonthEnergy() {
+	return totals.month_energy;
+}
+
+uint32_t EnergyMeter::getLifetimeEnergy() {
+	return totals.lifetime_energy;
+}
+
+
+void EnergyMeter::save() {
+	save_timer = halMillis();
+
+	if (halFileWrite(ENERGY_FILE, &totals, sizeof(energy_totals_t), false)) {
+		save_flag = false;
+	}
+}
@@ -9,8 +9,55 @@
 
 #include "data.h"
 
+static const uint8_t* const glyphs[LCD_GLYPHS_COUNT] = {LT, UB, RT, LL, LB, LR, UMB, wifi, down_symbol};
+
 LcdManager::LcdManager() : LiquidCrystal_I2C(0x27, 20, 4) {
+	resetGlyphs();
+}
+
+void LcdManager::init() {
+	LiquidCrystal_I2C::init();
+	resetGlyphs();
+}
+
+
+uint8_t LcdManager::loadGlyph(uint8_t glyph) {
+	uint8_t slot = 0;
+
+	if (glyph >= LCD_GLYPHS_COUNT) {
+		return ' ';
+	}
+	glyphs_tick++;
+
+	for (uint8_t i = 0;i < LCD_CGRAM_SLOTS;i++) {
+		if (cgram_glyph[i] == glyph) {
+			cgram_use[i] = glyphs_tick;
+			return i;
+		}
+
+		if (cgram_use[i] < cgram_use[slot]) {
+			slot = i;
+		}
+	}
+
+	createChar(slot, glyphs[glyph]);
+	cgram_glyph[slot] = glyph;
+	cgram_use[slot] = glyphs_tick;
 
+	return slot;
+}
+
+void LcdManager::easyWriteGlyph(uint8_t x, uint8_t y, uint8_t glyph) {
+	uint8_t slot = loadGlyph(glyph);
+
+	setCursor(x, y);
+	write(slot);
+}
+
+void LcdManager::resetGlyphs() {
+	memset(cgram_glyph, LCD_EMPTY_SLOT, LCD_CGRAM_SLOTS);
+	memset(cgram_use, 0, sizeof(cgram_use));
+	glyphs_tick = 0;
 }
 
 
@@ -39,6 +86,16 @@ void LcdManager::easyPrint(uint8_t x, uint8_t y, float number) {
 	print(number, 2);
 }
 
+void LcdManager::easyPrintCenti(uint8_t x, uint8_t y, int16_t centi, uint8_t decimals) {
+	setCursor(x, y);
+	printCenti(centi, decimals);
+}
+
+void LcdManager::printCenti(int16_t centi, uint8_t decimals) {
+	char buffer[CENTI_STRING_SIZE];
+	print(centiToString(centi, decimals, buffer));
+}
+
 void LcdManager::easyWrite(uint8_t x, uint8_t y, uint8_t code) {
 	setCursor(x, y);
 	write(code);
@@ -0,0 +1,305 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+static const char* const network_modes[] = {"off", "sta", "ap_sta", "auto"};
+static const char* const ip_modes[] = {"dhcp", "static", "cached"};
+static const char* const solar_modes[] = {"bang", "hyst", "pid"};
+
+static const char* solarSensorName(SystemManager* system, uint8_t solar_sensor) {
+	int8_t sensor_index = system->getSolarSystemManager()->getSensor(solar_sensor);
+
+	return (sensor_index >= 0) ? system->getSensorsManager()->getDS18B20Name(sensor_index) : "NONE";
+}
+
+static const char* solarGainText(float gain) {
+	static char text[CENTI_STRING_SIZE];
+
+	return centiToString(floatToCenti(gain), 2, text);
+}
+
+static const char* pumpTimeText(SystemManager* system) {
+	static char text[MENU_COUNTERS_TEXT_SIZE];
+	ReleJournal* journal = system->getSolarSystemManager()->getJournal();
+
+	snprintf(text, sizeof(text), "%luh/%lu", (unsigned long) (journal->getRunTime(SOLAR_MAIN_LOOP) / 3600), (unsigned long) journal->getStarts(SOLAR_MAIN_LOOP));
+	return text;
+}
+
+static const char* solarFlowText(SystemManager* system) {
+	static char text[CENTI_STRING_SIZE];
+
+	return centiToString(system->getSolarSystemManager()->getLoop(SOLAR_MAIN_LOOP)->flow * 10, 1, text);
+}
+
+static const char* energyText(SystemManager* system) {
+	static char text[CENTI_STRING_SIZE];
+
+	// kWh of today
+	return centiToString(min(system->getSolarSystemManager()->getEnergyMeter()->getDayEnergy() / 10, (uint32_t) INT16_MAX), 2, text);
+}
+
+static const char* watchdogText(SystemManager* system) {
+	static char text[MENU_COUNTERS_TEXT_SIZE];
+	SafetyWatchdog* watchdog = system->getSolarSystemManager()->getWatchdog();
+
+	snprintf(text, MENU_COUNTERS_TEXT_SIZE, "%lu/%lu", (unsigned long) watchdog->getStallCount(), (unsigned long) watchdog->getResetCount());
+	return text;
+}
+
+static const char* ipConfigText(SystemManager* system, uint8_t index) {
+	static char text[NETWORK_IP_STRING_SIZE];
+
+	return system->getNetworkManager()->getIpConfigString(index, text);
+}
+
+static const char* blynkQueueText(SystemManager* system) {
+	static char text[MENU_COUNTERS_TEXT_SIZE];
+	BlynkQueue* queue = system->getBlynkManager()->getQueue();
+
+	snprintf(text, MENU_COUNTERS_TEXT_SIZE, "%u/%u", queue->getCount(), queue->getDropCount());
+	return text;
+}
+
+static const menu_item_t settings_items[] = {
+	{"Network", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(MenuWindow(&network_settings_menu))},
+	{"Blynk", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(MenuWindow(&blynk_settings_menu))},
+	{"Solar", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(MenuWindow(&solar_settings_menu))},
+	{"System", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(MenuWindow(&system_settings_menu))},
+};
+
+static const menu_item_t network_settings_items[] = {
+	{"Mode", MENU_CYCLE, NETWORK_OFF, NETWORK_AUTO,
+		MENU_GET(system->getNetworkManager()->getMode()),
+		MENU_SET(system->getNetworkManager()->setMode(value)),
+		MENU_TEXT(network_modes[constrain(system->getNetworkManager()->getMode(), NETWORK_OFF, NETWORK_AUTO)]),
+		NULL, NULL},
+	{"WiFi", MENU_WINDOW, 0, 0, NULL, NULL,
+		MENU_TEXT(system->getNetworkManager()->getWifiSsid()),
+		NULL, MENU_OPEN(WifiSettingsWindow)},
+	{"Ssid", MENU_STRING, 0, NETWORK_SSID_PASS_SIZE, NULL, NULL,
+		MENU_TEXT(system->getNetworkManager()->getApSsid()),
+		MENU_SET_TEXT(system->getNetworkManager()->setAp(text, NULL)),
+		NULL},
+	{"Pass", MENU_STRING, 0, NETWORK_SSID_PASS_SIZE, NULL, NULL,
+		MENU_TEXT(system->getNetworkManager()->getApPass()),
+		MENU_SET_TEXT(system->getNetworkManager()->setAp(NULL, text)),
+		NULL},
+	{"Ip", MENU_WINDOW, 0, 0, NULL, NULL,
+		MENU_TEXT(ip_modes[constrain(system->getNetworkManager()->getIpMode(), NETWORK_IP_DHCP, NETWORK_IP_CACHED)]),
+		NULL, MENU_OPEN(MenuWindow(&ip_settings_menu))},
+};
+
+static const menu_item_t ip_settings_items[] = {
+	{"Mode", MENU_CYCLE, NETWORK_IP_DHCP, NETWORK_IP_CACHED,
+		MENU_GET(system->getNetworkManager()->getIpMode()),
+		MENU_SET(system->getNetworkManager()->setIpMode(value)),
+		MENU_TEXT(ip_modes[constrain(system->getNetworkManager()->getIpMode(), NETWORK_IP_DHCP, NETWORK_IP_CACHED)]),
+		NULL, NULL},
+	{"Ip", MENU_STRING, 0, NETWORK_IP_STRING_SIZE, NULL, NULL,
+		MENU_TEXT(ipConfigText(system, NETWORK_IP_ADDRESS)),
+		MENU_SET_TEXT(system->getNetworkManager()->setIpConfig(NETWORK_IP_ADDRESS, text)),
+		NULL},
+	{"Gw", MENU_STRING, 0, NETWORK_IP_STRING_SIZE, NULL, NULL,
+		MENU_TEXT(ipConfigText(system, NETWORK_IP_GATEWAY)),
+		MENU_SET_TEXT(system->getNetworkManager()->setIpConfig(NETWORK_IP_GATEWAY, text)),
+		NULL},
+	{"Mask", MENU_STRING, 0, NETWORK_IP_STRING_SIZE, NULL, NULL,
+		MENU_TEXT(ipConfigText(system, NETWORK_IP_SUBNET)),
+		MENU_SET_TEXT(system->getNetworkManager()->setIpConfig(NETWORK_IP_SUBNET, text)),
+		NULL},
+	{"Dns", MENU_STRING, 0, NETWORK_IP_STRING_SIZE, NULL, NULL,
+		MENU_TEXT(ipConfigText(system, NETWORK_IP_DNS)),
+		MENU_SET_TEXT(system->getNetworkManager()->setIpConfig(NETWORK_IP_DNS, text)),
+		NULL},
+	{"Apply", MENU_ACTION, 0, 0, NULL, MENU_SET(system->getNetworkManager()->reconnect()), NULL, NULL, NULL},
+};
+
+static const menu_item_t blynk_settings_items[] = {
+	{"Status", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getBlynkManager()->getWorkFlag()),
+		MENU_SET(system->getBlynkManager()->setWorkFlag(value)),
+		NULL, NULL, NULL},
+	{"Send time", MENU_NUMBER, 0, 100,
+		MENU_GET(system->getBlynkManager()->getSendDataTime()),
+		MENU_SET(system->getBlynkManager()->setSendDataTime(value)),
+		NULL, NULL, NULL},
+	{"Silence", MENU_NUMBER, 0, BLYNK_SILENCE_TIME_MAX,
+		MENU_GET(system->getBlynkManager()->getSilenceTime()),
+		MENU_SET(system->getBlynkManager()->setSilenceTime(value)),
+		NULL, NULL, NULL},
+	{"Auth", MENU_ACTION, 0, 0, NULL,
+		MENU_SET(system->getBlynkManager()->setAuth("")),
+		MENU_TEXT(*system->getBlynkManager()->getAuth() ? "SET" : "UNSET"),
+		NULL, NULL},
+	{"Links", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(BlynkLinksSettingsWindow)},
+	{"Queue", MENU_ACTION, 0, 0, NULL,
+		MENU_SET(system->getBlynkManager()->getQueue()->clear()),
+		MENU_TEXT(blynkQueueText(system)),
+		NULL, NULL},
+};
+
+static const menu_item_t solar_settings_items[] = {
+	{"Status", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getSolarSystemManager()->getWorkFlag()),
+		MENU_SET(system->getSolarSystemManager()->setWorkFlag(value)),
+		NULL, NULL, NULL},
+	{"Error on", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getSolarSystemManager()->getErrorOnFlag()),
+		MENU_SET(system->getSolarSystemManager()->setErrorOnFlag(value)),
+		NULL, NULL, NULL},
+	{"Rele invert", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getSolarSystemManager()->getReleInvertFlag()),
+		MENU_SET(system->getSolarSystemManager()->setReleInvertFlag(value)),
+		NULL, NULL, NULL},
+	{"Delta", MENU_NUMBER, SOLAR_DELTA_MIN, SOLAR_DELTA_MAX,
+		MENU_GET(system->getSolarSystemManager()->getDelta()),
+		MENU_SET(system->getSolarSystemManager()->setDelta(value)),
+		NULL, NULL, NULL},
+	{"Mode", MENU_CYCLE, SOLAR_MODE_BANG_BANG, SOLAR_MODE_PID,
+		MENU_GET(system->getSolarSystemManager()->getMode()),
+		MENU_SET(system->getSolarSystemManager()->setMode(value)),
+		MENU_TEXT(solar_modes[constrain(system->getSolarSystemManager()->getMode(), SOLAR_MODE_BANG_BANG, SOLAR_MODE_PID)]),
+		NULL, NULL},
+	{"Hyster", MENU_NUMBER, SOLAR_HYSTERESIS_MIN, SOLAR_HYSTERESIS_MAX,
+		MENU_GET(system->getSolarSystemManager()->getHysteresis()),
+		MENU_SET(system->getSolarSystemManager()->setHysteresis(value)),
+		NULL, NULL, NULL},
+	{"Min on", MENU_NUMBER, 0, SOLAR_DWELL_TIME_MAX,
+		MENU_GET(system->getSolarSystemManager()->getMinOnTime()),
+		MENU_SET(system->getSolarSystemManager()->setMinOnTime(value)),
+		NULL, NULL, NULL},
+	{"Min off", MENU_NUMBER, 0, SOLAR_DWELL_TIME_MAX,
+		MENU_GET(system->getSolarSystemManager()->getMinOffTime()),
+		MENU_SET(system->getSolarSystemManager()->setMinOffTime(value)),
+		NULL, NULL, NULL},
+	{"Kp", MENU_NUMBER, 0, SOLAR_PID_GAIN_MAX * 100,
+		MENU_GET(floatToCenti(system->getSolarSystemManager()->getPidKp())),
+		MENU_SET(system->getSolarSystemManager()->setPidKp(value * 0.01f)),
+		MENU_TEXT(solarGainText(system->getSolarSystemManager()->getPidKp())),
+		NULL, NULL},
+	{"Ki", MENU_NUMBER, 0, SOLAR_PID_GAIN_MAX * 100,
+		MENU_GET(floatToCenti(system->getSolarSystemManager()->getPidKi())),
+		MENU_SET(system->getSolarSystemManager()->setPidKi(value * 0.01f)),
+		MENU_TEXT(solarGainText(system->getSolarSystemManager()->getPidKi())),
+		NULL, NULL},
+	{"Kd", MENU_NUMBER, 0, SOLAR_PID_GAIN_MAX * 100,
+		MENU_GET(floatToCenti(system->getSolarSystemManager()->getPidKd())),
+		MENU_SET(system->getSolarSystemManager()->setPidKd(value * 0.01f)),
+		MENU_TEXT(solarGainText(system->getSolarSystemManager()->getPidKd())),
+		NULL, NULL},
+	{"Window", MENU_NUMBER, SOLAR_PID_WINDOW_MIN, SOLAR_PID_WINDOW_MAX,
+		MENU_GET(system->getSolarSystemManager()->getPidWindow()),
+		MENU_SET(system->getSolarSystemManager()->setPidWindow(value)),
+		NULL, NULL, NULL},
+	{"Predict", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getSolarSystemManager()->getPredictFlag()),
+		MENU_SET(system->getSolarSystemManager()->setPredictFlag(value)),
+		NULL, NULL, NULL},
+	{"Predict min", MENU_NUMBER, 1, SOLAR_PREDICT_TIME_MAX,
+		MENU_GET(system->getSolarSystemManager()->getPredictTime()),
+		MENU_SET(system->getSolarSystemManager()->setPredictTime(value)),
+		NULL, NULL, NULL},
+	{"Battery", MENU_NUMBER, -1, DS_SENSORS_MAX_COUNT - 1,
+		MENU_GET(system->getSolarSystemManager()->getBatterySensor()),
+		MENU_SET(system->getSolarSystemManager()->setBatterySensor(value)),
+		MENU_TEXT(solarSensorName(system, 0)),
+		NULL, NULL},
+	{"Boiler", MENU_NUMBER, -1, DS_SENSORS_MAX_COUNT - 1,
+		MENU_GET(system->getSolarSystemManager()->getBoilerSensor()),
+		MENU_SET(system->getSolarSystemManager()->setBoilerSensor(value)),
+		MENU_TEXT(solarSensorName(system, 1)),
+		NULL, NULL},
+	{"Exit", MENU_NUMBER, -1, DS_SENSORS_MAX_COUNT - 1,
+		MENU_GET(system->getSolarSystemManager()->getExitSensor()),
+		MENU_SET(system->getSolarSystemManager()->setExitSensor(value)),
+		MENU_TEXT(solarSensorName(system, 2)),
+		NULL, NULL},
+	{"Flow l/min", MENU_NUMBER, 0, SOLAR_FLOW_MAX,
+		MENU_GET(system->getSolarSystemManager()->getLoop(SOLAR_MAIN_LOOP)->flow),
+		MENU_SET(system->getSolarSystemManager()->setLoopFlow(SOLAR_MAIN_LOOP, value)),
+		MENU_TEXT(solarFlowText(system)),
+		NULL, NULL},
+	{"Fluid cp", MENU_NUMBER, SOLAR_FLUID_CP_MIN, SOLAR_FLUID_CP_MAX,
+		MENU_GET(system->getSolarSystemManager()->getFluidCp()),
+		MENU_SET(system->getSolarSystemManager()->setFluidCp(value)),
+		NULL, NULL, NULL},
+	{"Energy kWh", MENU_ACTION, 0, 0, NULL,
+		MENU_SET(system->getSolarSystemManager()->getEnergyMeter()->clear()),
+		MENU_TEXT(energyText(system)),
+		NULL, NULL},
+	{"Pump", MENU_ACTION, 0, 0, NULL,
+		MENU_SET(system->getSolarSystemManager()->getJournal()->clearCounters()),
+		MENU_TEXT(pumpTimeText(system)),
+		NULL, NULL},
+};
+
+static const menu_item_t system_settings_items[] = {
+	{"Time", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(MenuWindow(&time_settings_menu))},
+	{"DS18B20", MENU_WINDOW, 0, 0, NULL, NULL, NULL, NULL, MENU_OPEN(DS18B20SensorsSettingsWindow)},
+	{"Reset All", MENU_ACTION, 0, 0, NULL, MENU_SET(system->resetAll()), NULL, NULL, NULL},
+	{"Stalls", MENU_ACTION, 0, 0, NULL,
+		MENU_SET(system->getSolarSystemManager()->getWatchdog()->clear()),
+		MENU_TEXT(watchdogText(system)),
+		NULL, NULL},
+	{"Time data", MENU_NUMBER, 0, 100,
+		MENU_GET(system->getSensorsManager()->getReadDataTime()),
+		MENU_SET(system->getSensorsManager()->setReadDataTime(value)),
+		NULL, NULL, NULL},
+	{"Median", MENU_NUMBER, 1, DS_MEDIAN_MAX,
+		MENU_GET(system->getSensorsManager()->getFilterMedian()),
+		MENU_SET(system->getSensorsManager()->setFilterMedian(value)),
+		NULL, NULL, NULL},
+	{"Rate max", MENU_NUMBER, 0, DS_FILTER_RATE_MAX,
+		MENU_GET(system->getSensorsManager()->getFilterRate()),
+		MENU_SET(system->getSensorsManager()->setFilterRate(value)),
+		NULL, NULL, NULL},
+	{"Auto reset", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getDisplayManager()->getAutoResetFlag()),
+		MENU_SET(system->getDisplayManager()->setAutoResetFlag(value)),
+		NULL, NULL, NULL},
+	{"Time display", MENU_NUMBER, 0, 255,
+		MENU_GET(system->getDisplayManager()->getBacklightOffTime()),
+		MENU_SET(system->getDisplayManager()->setBacklightOffTime(value)),
+		NULL, NULL, NULL},
+	{"Display fps", MENU_NUMBER, 1, 255,
+		MENU_GET(system->getDisplayManager()->getFps()),
+		MENU_SET(system->getDisplayManager()->setFps(value)),
+		NULL, NULL, NULL},
+	{"Buzzer", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getBuzzerFlag()),
+		MENU_SET(system->setBuzzerFlag(value)),
+		NULL, NULL, NULL},
+};
+
+static const menu_item_t time_settings_items[] = {
+	{"Ntp sync", MENU_TOGGLE, 0, 1,
+		MENU_GET(system->getTimeManager()->getNtpFlag()),
+		MENU_SET(system->getTimeManager()->setNtpFlag(value)),
+		NULL, NULL, NULL},
+	{"Gmt", MENU_NUMBER, -12, 12,
+		MENU_GET(system->getTimeManager()->getGmt()),
+		MENU_SET(system->getTimeManager()->setGmt(value)),
+		NULL, NULL, NULL},
+	{"Time", MENU_WINDOW, 0, 0,
+		MENU_GET(!system->getTimeManager()->getNtpFlag()),
+		NULL, NULL, NULL, MENU_OPEN(SetTimeWindow)},
+};
+
+
+#define MENU(TITLE, SAVE_FLAG, ITEMS) {TITLE, SAVE_FLAG, sizeof(ITEMS) / sizeof(menu_item_t), ITEMS}
+
+const menu_t settings_menu = MENU("Menu", true, settings_items);
+const menu_t network_settings_menu = MENU(NULL, false, network_settings_items);
+const menu_t ip_settings_menu = MENU(NULL, false, ip_settings_items);
+const menu_t blynk_settings_menu = MENU(NULL, false, blynk_settings_items);
+const menu_t solar_settings_menu = MENU(NULL, false, solar_settings_items);
+const menu_t system_settings_menu = MENU(NULL, false, system_settings_items);
+const menu_t time_settings_menu = MENU(NULL, false, time_settings_items);
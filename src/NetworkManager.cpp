@@ -14,7 +14,10 @@ NetworkManager::NetworkManager() {
 }
 
 void NetworkManager::begin() {
-	udp.begin(2390);
+	ntp.begin();
+
+	wifi_got_ip_handler = WiFi.onStationModeGotIP(onWifiGotIp);
+	wifi_disconnected_handler = WiFi.onStationModeDisconnected(onWifiDisconnected);
 }
 
 
@@ -22,10 +25,29 @@ void NetworkManager::makeDefault() {
 	mode = DEFAULT_NETWORK_MODE;
 	setAp("", "");
   	setWifi("", "");
+
+	ip_mode = DEFAULT_NETWORK_IP_MODE;
+	memset(ip_config, 0, sizeof(ip_config));
+	*lease_ssid = 0;
 	
 	reset_request = true;
-	tick_allow = true;
 	wifi_reconnect_timer = 0;
+	wifi_reconnect_delay = SEC_TO_MLS(NETWORK_RECONNECT_MIN_TIME);
+
+	memset(wifi_bssid, 0, NETWORK_BSSID_SIZE);
+	wifi_channel = 0;
+	wifi_fast_flag = true;
+
+	wifi_dhcp_flag = true;
+	lease_check_flag = false;
+	lease_check_timer = 0;
+
+	*connect_ssid = 0;
+	*connect_pass = 0;
+	connect_state = NETWORK_CONNECT_IDLE;
+	connect_time = 0;
+	connect_auto_save = false;
+	connect_timer = 0;
 	
 	web_update_codes.clear();
 	web_blynk.element_codes.clear();
@@ -35,10 +57,6 @@ void NetworkManager::makeDefault() {
 }
 
 void NetworkManager::tick() {
-	if (!tick_allow) {
-		return;
-	}
-	
 	if (reset_request) {
 		Serial.println("reset");
 
@@ -90,7 +108,22 @@ void NetworkManager::tick() {
 	}
 
 
-	if (WiFi.getMode() == WIFI_STA || WiFi.getMode() == WIFI_AP_STA) {
+	if (connect_request) {
+		connect_request = false;
+
+		if (*getWifiSsid()) {
+			beginConnect(getWifiSsid(), getWifiPass());
+		}
+		else {
+			WiFi.disconnect();
+			connect_state = NETWORK_CONNECT_IDLE;
+		}
+	}
+	connectTick();
+	wifiLinkTick();
+	leaseCheckTick();
+
+	if (isWifiOn() && connect_state != NETWORK_CONNECT_PENDING) {
 		if (getStatus() != WL_CONNECTED) {
 			connect();
 		}
@@ -103,6 +136,15 @@ void NetworkManager::writeSettings(char* buffer) {
 	setParameter(buffer, "SNm", getMode());
 	setParameter(buffer, "SNWs", (const char*) getWifiSsid());
 	setParameter(buffer, "SNWp", (const char*) getWifiPass());
+	setParameter(buffer, "SNWb", wifi_bssid, NETWORK_BSSID_SIZE);
+	setParameter(buffer, "SNWch", wifi_channel);
+	setParameter(buffer, "SNim", getIpMode());
+	setParameter(buffer, "SNia", getIpConfig(NETWORK_IP_ADDRESS));
+	setParameter(buffer, "SNig", getIpConfig(NETWORK_IP_GATEWAY));
+	setParameter(buffer, "SNin", getIpConfig(NETWORK_IP_SUBNET));
+	setParameter(buffer, "SNid", getIpConfig(NETWORK_IP_DNS));
+	setParameter(buffer, "SNil", (const char*) lease_ssid);
+	ntp.writeSettings(buffer);
 	setParameter(buffer, "SNAs", (const char*) getApSsid());
 	setParameter(buffer, "SNAp", (const char*) getApPass());
 }
@@ -111,51 +153,181 @@ void NetworkManager::readSettings(char* buffer) {
 	getParameter(buffer, "SNm", &mode);
 	getParameter(buffer, "SNWs", ssid_sta, NETWORK_SSID_PASS_SIZE);
 	getParameter(buffer, "SNWp", pass_sta, NETWORK_SSID_PASS_SIZE);
+	getParameter(buffer, "SNWb", wifi_bssid, NETWORK_BSSID_SIZE);
+	getParameter(buffer, "SNWch", &wifi_channel);
+	getParameter(buffer, "SNim", &ip_mode);
+	getParameter(buffer, "SNia", &ip_config[NETWORK_IP_ADDRESS]);
+	getParameter(buffer, "SNig", &ip_config[NETWORK_IP_GATEWAY]);
+	getParameter(buffer, "SNin", &ip_config[NETWORK_IP_SUBNET]);
+	getParameter(buffer, "SNid", &ip_config[NETWORK_IP_DNS]);
+	getParameter(buffer, "SNil", lease_ssid, NETWORK_SSID_PASS_SIZE);
+	ntp.readSettings(buffer);
 	getParameter(buffer, "SNAs", ssid_ap, NETWORK_SSID_PASS_SIZE);
 	getParameter(buffer, "SNAp", pass_ap, NETWORK_SSID_PASS_SIZE);
 	
 	setMode(mode);
 	setAp(ssid_ap, pass_ap);
+	setIpMode(ip_mode);
 	tick();
 }
 
-bool NetworkManager::connect(String ssid, String pass, uint8_t connect_time, bool auto_save) {
-	bool connect_status = false;
-	
-	if (!ssid[0]) {
-		if (!wifi_reconnect_timer || millis() - wifi_reconnect_timer >= SEC_TO_MLS(NETWORK_RECONNECT_TIME)) {
-			wifi_reconnect_timer = millis();
+void NetworkManager::connect() {
+	if (!*getWifiSsid()) {
+		return;
+	}
+
+	if (wifi_reconnect_timer && millis() - wifi_reconnect_timer < wifi_reconnect_delay) {
+		return;
+	}
+	wifi_reconnect_timer = millis();
 
-			WiFi.begin(getWifiSsid(), getWifiPass());
-			connect_status = getStatus();
+	wifiBegin(getWifiSsid(), getWifiPass());
+
+	// jittered exponential backoff, so many devices dropped by one AP do not retry in step
+	wifi_reconnect_delay = min(wifi_reconnect_delay * 2, (uint32_t) SEC_TO_MLS(NETWORK_RECONNECT_MAX_TIME));
+	wifi_reconnect_delay += (int32_t) wifi_reconnect_delay * random(-NETWORK_RECONNECT_JITTER, NETWORK_RECONNECT_JITTER + 1) / 100;
+}
+
+void NetworkManager::reconnect() {
+	connect_request = true;
+}
+
+void NetworkManager::beginConnect(const char* ssid, const char* pass, uint8_t connect_time, bool auto_save) {
+	if (getMode() == NETWORK_OFF || ssid == NULL || !*ssid) {
+		connect_state = NETWORK_CONNECT_FAIL;
+		return;
+	}
+
+	if (ssid != connect_ssid) {
+		strcpy(connect_ssid, ssid);
+	}
+	if (pass != connect_pass) {
+		strcpy(connect_pass, (pass != NULL) ? pass : "");
+	}
+
+	this->connect_time = connect_time;
+	connect_auto_save = auto_save;
+	connect_timer = millis();
+	connect_state = NETWORK_CONNECT_PENDING;
+
+	wifi_got_ip_flag = false;
+	wifi_disconnect_reason = 0;
+
+	// the mode is left as is, so the AP and the portal keep running
+	wifiBegin(connect_ssid, connect_pass);
+	wifi_reconnect_timer = millis();
+}
+
+void NetworkManager::connectTick() {
+	if (connect_state != NETWORK_CONNECT_PENDING) {
+		return;
+	}
+
+	// begin() with the current network does not reconnect, so there is no GotIP event
+	if (wifi_got_ip_flag || (getStatus() == WL_CONNECTED && WiFi.SSID() == connect_ssid)) {
+		connect_state = NETWORK_CONNECT_OK;
+
+		if (connect_auto_save) {
+			setWifi(connect_ssid, connect_pass);
+			// already on this network, it must not be joined again
+			connect_request = false;
+
+			system->saveSettingsRequest();
 		}
+
+		return;
+	}
+
+	if (wifi_disconnect_reason == WIFI_DISCONNECT_REASON_AUTH_FAIL || millis() - connect_timer >= SEC_TO_MLS(connect_time)) {
+		connect_state = NETWORK_CONNECT_FAIL;
+
+		// back to the saved network on the next tick
+		wifi_reconnect_timer = 0;
+	}
+}
+
+void NetworkManager::wifiBegin(const char* ssid, const char* pass) {
+	applyIpConfig(ssid);
+
+	// the cached AP is tried once, it skips the scan; any retry falls back to a full scan
+	if (wifi_fast_flag && wifi_channel && !strcmp(ssid, getWifiSsid())) {
+		WiFi.begin(ssid, pass, wifi_channel, wifi_bssid);
 	}
 	else {
-		uint32_t connect_timer = millis();
-		tick_allow = false;
-		
-		off();
-   		WiFi.mode(WIFI_STA);
 		WiFi.begin(ssid, pass);
+	}
 
-		while (connect_time && millis() - connect_timer < SEC_TO_MLS(connect_time)) {
-			if (getStatus() == WL_CONNECTED) {
-				connect_status = true;
-				break;
-			}
-			
-			system->tick();
-		}
-		
-		if (auto_save && getStatus()) {
-			setWifi(ssid.c_str(), pass.c_str());
+	wifi_fast_flag = false;
+}
+
+void NetworkManager::wifiLinkTick() {
+	if (!wifi_link_flag) {
+		return;
+	}
+	wifi_link_flag = false;
+
+	wifi_reconnect_delay = SEC_TO_MLS(NETWORK_RECONNECT_MIN_TIME);
+	wifi_fast_flag = true;
+
+	if (WiFi.SSID() != getWifiSsid()) {
+		return;
+	}
+
+	if (getIpMode() == NETWORK_IP_CACHED && wifi_dhcp_flag) {
+		uint32_t lease[NETWORK_IP_CONFIG_COUNT] = {WiFi.localIP(), WiFi.gatewayIP(), WiFi.subnetMask(), WiFi.dnsIP()};
+
+		if (memcmp(lease, ip_config, sizeof(ip_config)) || strcmp(lease_ssid, getWifiSsid())) {
+			memcpy(ip_config, lease, sizeof(ip_config));
+			strcpy(lease_ssid, getWifiSsid());
+			system->saveSettingsRequest();
 		}
+	}
 
-   		tick_allow = true;
-		reset_request = true;
+	uint8_t* bssid = WiFi.BSSID();
+	uint8_t channel = WiFi.channel();
+
+	if (channel != wifi_channel || memcmp(bssid, wifi_bssid, NETWORK_BSSID_SIZE)) {
+		memcpy(wifi_bssid, bssid, NETWORK_BSSID_SIZE);
+		wifi_channel = channel;
+
+		system->saveSettingsRequest();
+	}
+}
+
+void NetworkManager::applyIpConfig(const char* ssid) {
+	bool static_flag = (getIpMode() == NETWORK_IP_STATIC);
+
+	// a remembered lease is used as a static address until it is revalidated, only on its own network
+	if (getIpMode() == NETWORK_IP_CACHED && getIpConfig(NETWORK_IP_ADDRESS) && !strcmp(lease_ssid, ssid)) {
+		static_flag = true;
+
+		lease_check_flag = true;
+		lease_check_timer = millis();
 	}
 
-	return connect_status;
+	if (static_flag && getIpConfig(NETWORK_IP_ADDRESS)) {
+		wifi_dhcp_flag = false;
+		WiFi.config(IPAddress(getIpConfig(NETWORK_IP_ADDRESS)), IPAddress(getIpConfig(NETWORK_IP_GATEWAY)), IPAddress(getIpConfig(NETWORK_IP_SUBNET)), IPAddress(getIpConfig(NETWORK_IP_DNS)));
+	}
+	else {
+		wifi_dhcp_flag = true;
+		WiFi.config(IPAddress(0u), IPAddress(0u), IPAddress(0u));
+	}
+}
+
+void NetworkManager::leaseCheckTick() {
+	if (!lease_check_flag || getStatus() != WL_CONNECTED) {
+		return;
+	}
+
+	if (millis() - lease_check_timer < SEC_TO_MLS(NETWORK_LEASE_CHECK_TIME)) {
+		return;
+	}
+	lease_check_flag = false;
+
+	// restarts the DHCP client on the live link, GotIP then brings the fresh lease
+	wifi_dhcp_flag = true;
+	WiFi.config(IPAddress(0u), IPAddress(0u), IPAddress(0u));
 }
 
 void NetworkManager::off() {
@@ -175,41 +347,22 @@ bool NetworkManager::isApOn() {
 }
 
 
+void NetworkManager::onWifiGotIp(const WiFiEventStationModeGotIP& event) {
+	wifi_got_ip_flag = true;
+	wifi_link_flag = true;
+}
+
+void NetworkManager::onWifiDisconnected(const WiFiEventStationModeDisconnected& event) {
+	wifi_disconnect_reason = event.reason;
+}
+
+
 bool NetworkManager::ntpSync(TimeManager* time) {
-	uint8_t packet[48];
-	static uint32_t last_send_timer;
-
-	if (getStatus() == WL_CONNECTED) {
-		if (!last_send_timer || millis() - last_send_timer >= SEC_TO_MLS(UDP_RESEND_TIME)) {
-			last_send_timer = millis();
-
-			packet[0] = 0b11100011;  // LI, Version, Mode
-			packet[1] = 0;           // Stratum, or type of clock
-			packet[2] = 6;           // Polling Interval
-			packet[3] = 0xEC;        // Peer Clock Precision
-			// 8 bytes of zero for Root Delay & Root Dispersion
-			packet[12] = 49;
-			packet[13] = 0x4E;
-			packet[14] = 49;
-			packet[15] = 52;
-		
-			udp.beginPacket(NTP_SERVER, NTP_PORT);
-			udp.write(packet, 48);
-			udp.endPacket();
-		}
+	if (getStatus() != WL_CONNECTED) {
+		return false;
 	}
 
-	if (udp.parsePacket()) {
-		udp.read(packet, 48);
-		
-		uint32_t ntp_time = (word(packet[40], packet[41]) << 16) | word(packet[42], packet[43]);
-		int32_t unix_time = ntp_time - 2208988800UL;
-		time->setUnix(unix_time);
-		
-		return true;
-	}
-	
-	return false;
+	return ntp.tick(time);
 }
 
 
@@ -227,13 +380,22 @@ void NetworkManager::setWifi(String* ssid, String* pass) {
 }
 void NetworkManager::setWifi(const char* ssid, const char* pass) {
 	if (ssid != NULL) {
+		if (strcmp(ssid_sta, ssid)) {
+			wifi_channel = 0;
+
+			if (getIpMode() == NETWORK_IP_CACHED) {
+				memset(ip_config, 0, sizeof(ip_config));
+				*lease_ssid = 0;
+			}
+		}
+
 		strcpy(ssid_sta, ssid);
 	}
 	if (pass != NULL) {
 		strcpy(pass_sta, pass);
 	}
 
-	reset_request = true;
+	connect_request = true;
 }
 
 void NetworkManager::setAp(String* ssid, String* pass) {
@@ -253,6 +415,34 @@ void NetworkManager::setAp(const char* ssid, const char* pass) {
 }
 
 
+void NetworkManager::setIpMode(uint8_t ip_mode) {
+	this->ip_mode = constrain(ip_mode, NETWORK_IP_DHCP, NETWORK_IP_CACHED);
+}
+
+bool NetworkManager::setIpConfig(uint8_t index, const char* text) {
+	IPAddress address;
+
+	if (text == NULL || !address.fromString(text)) {
+		return false;
+	}
+
+	setIpConfig(index, (uint32_t) address);
+	return true;
+}
+
+void NetworkManager::setIpConfig(uint8_t index, uint32_t address) {
+	if (index >= NETWORK_IP_CONFIG_COUNT) {
+		return;
+	}
+
+	ip_config[index] = address;
+}
+
+
+NtpClient* NetworkManager::getNtpClient() {
+	return &ntp;
+}
+
 SystemManager* NetworkManager::getSystemManager() {
 	return system;
 }
@@ -261,6 +451,19 @@ wl_status_t NetworkManager::getStatus() {
   	return WiFi.status();
 }
 
+uint8_t NetworkManager::getConnectState() {
+	return connect_state;
+}
+
+uint8_t NetworkManager::getConnectTimeLeft() {
+	if (connect_state != NETWORK_CONNECT_PENDING) {
+		return 0;
+	}
+
+	uint32_t connect_time_passed = (millis() - connect_timer) / 1000;
+	return (connect_time_passed < connect_time) ? connect_time - connect_time_passed : 0;
+}
+
 
 uint8_t NetworkManager::getMode() {
   	return mode;
@@ -282,6 +485,25 @@ char* NetworkManager::getApPass() {
   	return pass_ap;
 }
 
+uint8_t NetworkManager::getIpMode() {
+	return ip_mode;
+}
+
+uint32_t NetworkManager::getIpConfig(uint8_t index) {
+	return (index < NETWORK_IP_CONFIG_COUNT) ? ip_config[index] : 0;
+}
+
+char* NetworkManager::getIpConfigString(uint8_t index, char* buffer) {
+	uint32_t address = getIpConfig(index);
+
+	// IPAddress keeps the first octet in the lowest byte
+	sprintf(buffer, "%u.%u.%u.%u", (uint8_t) address, (uint8_t) (address >> 8), (uint8_t) (address >> 16), (uint8_t) (address >> 24));
+	return buffer;
+}
+
 
 SystemManager* NetworkManager::system = NULL;
+volatile bool NetworkManager::wifi_got_ip_flag = false;
+volatile bool NetworkManager::wifi_link_flag = false;
+volatile uint8_t NetworkManager::wifi_disconnect_reason = 0;
 GyverPortal NetworkManager::ui = GyverPortal(&LittleFS);
\ No newline at end of file
@@ -0,0 +1,291 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+NtpClient::NtpClient() {
+	makeDefault();
+}
+
+void NtpClient::begin() {
+	udp.begin(NTP_LOCAL_PORT);
+}
+
+
+bool NtpClient::tick(TimeManager* time) {
+	switch (state) {
+	case NTP_IDLE:
+		if (failed_count >= NTP_SERVERS_COUNT) {
+			if (millis() - state_timer < SEC_TO_MLS(NTP_RETRY_TIME)) {
+				break;
+			}
+
+			failed_count = 0;
+		}
+
+		resolve();
+		break;
+
+	case NTP_RESOLVE:
+		if (!server_ip && dns_done_flag) {
+			dns_done_flag = false;
+
+			if (dns_index == server_index && dns_ip) {
+				server_ip = dns_ip;
+				dns_timer = millis();
+			}
+		}
+
+		if (server_ip) {
+			send(time);
+		}
+		else if (millis() - state_timer >= NTP_TIMEOUT) {
+			nextServer();
+		}
+
+		break;
+
+	case NTP_WAIT:
+		if (receive(time)) {
+			state = NTP_IDLE;
+			failed_count = 0;
+
+			return true;
+		}
+
+		if (millis() - state_timer >= NTP_TIMEOUT) {
+			nextServer();
+		}
+
+		break;
+	}
+
+	return false;
+}
+
+void NtpClient::makeDefault() {
+	state = NTP_IDLE;
+	server_index = 0;
+	failed_count = 0;
+	state_timer = 0;
+
+	server_ip = 0;
+	server_port = NTP_PORT;
+	dns_timer = 0;
+
+	memset(request_timestamp, 0, sizeof(request_timestamp));
+	request_local_ms = 0;
+
+	offset = 0;
+	round_trip = 0;
+	stratum = 0;
+
+	setServer(0, DEFAULT_NTP_SERVER_0);
+	setServer(1, DEFAULT_NTP_SERVER_1);
+	setServer(2, DEFAULT_NTP_SERVER_2);
+}
+
+void NtpClient::writeSettings(char* buffer) {
+	for (uint8_t i = 0;i < NTP_SERVERS_COUNT;i++) {
+		setParameter(buffer, String("SNns") + i, (const char*) getServer(i));
+	}
+}
+
+void NtpClient::readSettings(char* buffer) {
+	for (uint8_t i = 0;i < NTP_SERVERS_COUNT;i++) {
+		getParameter(buffer, String("SNns") + i, servers[i], NTP_SERVER_SIZE);
+	}
+
+	server_ip = 0;
+}
+
+
+void NtpClient::setServer(uint8_t index, const char* server) {
+	if (index >= NTP_SERVERS_COUNT || server == NULL) {
+		return;
+	}
+
+	strncpy(servers[index], server, NTP_SERVER_SIZE - 1);
+	servers[index][NTP_SERVER_SIZE - 1] = '\0';
+
+	if (index == server_index) {
+		server_ip = 0;
+	}
+}
+
+
+char* NtpClient::getServer(uint8_t index) {
+	return (index < NTP_SERVERS_COUNT) ? servers[index] : NULL;
+}
+
+int32_t NtpClient::getOffset() {
+	return offset;
+}
+
+uint16_t NtpClient::getDelay() {
+	return round_trip;
+}
+
+uint8_t NtpClient::getStratum() {
+	return stratum;
+}
+
+
+void NtpClient::resolve() {
+	char host[NTP_SERVER_SIZE];
+	char* port = NULL;
+
+	strcpy(host, servers[server_index]);
+	port = strchr(host, ':');
+	server_port = NTP_PORT;
+
+	if (port != NULL) {
+		*port = '\0';
+		server_port = atoi(port + 1);
+	}
+
+	if (!*host || !server_port) {
+		nextServer();
+		return;
+	}
+
+	state = NTP_RESOLVE;
+	state_timer = millis();
+
+	if (server_ip && millis() - dns_timer < MIN_TO_MLS(NTP_DNS_CACHE_TIME)) {
+		return;
+	}
+	server_ip = 0;
+
+	// lwIP answers from its own cache (or for a literal address) at once, otherwise calls back later
+	ip_addr_t address;
+	dns_done_flag = false;
+	err_t result = dns_gethostbyname(host, &address, dnsFound, (void*) (uintptr_t) server_index);
+
+	if (result == ERR_OK) {
+		server_ip = ip_addr_get_ip4_u32(&address);
+		dns_timer = millis();
+	}
+	else if (result != ERR_INPROGRESS) {
+		nextServer();
+	}
+}
+
+void NtpClient::send(TimeManager* time) {
+	uint8_t packet[NTP_PACKET_SIZE] = {0};
+
+	packet[0] = 0b00100011; // LI 0, version 4, mode 3 (client)
+
+	request_local_ms = time->getUnixMillis();
+	writeTimestamp(&packet[40], request_local_ms);
+
+	// the low fraction bits are below 1 ms, random there makes a stale or forged reply unmatchable
+	packet[46] = random(256);
+	packet[47] = random(256);
+	memcpy(request_timestamp, &packet[40], sizeof(request_timestamp));
+
+	while (udp.parsePacket()) {
+		udp.flush();
+	}
+
+	udp.beginPacket(IPAddress(server_ip), server_port);
+	udp.write(packet, NTP_PACKET_SIZE);
+	udp.endPacket();
+
+	state = NTP_WAIT;
+	state_timer = millis();
+}
+
+bool NtpClient::receive(TimeManager* time) {
+	uint8_t packet[NTP_PACKET_SIZE];
+	int packet_size = udp.parsePacket();
+
+	if (!packet_size) {
+		return false;
+	}
+
+	uint64_t receive_local_ms = time->getUnixMillis();
+
+	if (packet_size < NTP_PACKET_SIZE || (uint32_t) udp.remoteIP() != server_ip || udp.remotePort() != server_port) {
+		udp.flush();
+		return false;
+	}
+	udp.read(packet, NTP_PACKET_SIZE);
+
+	uint8_t leap = packet[0] >> 6;
+	uint8_t mode = packet[0] & 0b111;
+
+	if (leap == 3 || mode != 4 || !packet[1] || packet[1] > 15) {
+		return false;
+	}
+
+	if (memcmp(&packet[24], request_timestamp, sizeof(request_timestamp))) {
+		return false;
+	}
+
+	uint64_t server_receive_ms = readTimestamp(&packet[32]);
+	uint64_t server_transmit_ms = readTimestamp(&packet[40]);
+
+	if (!server_receive_ms || !server_transmit_ms) {
+		return false;
+	}
+
+	// t1 request sent, t2 server receive, t3 server transmit, t4 reply received
+	int64_t sample_offset = ((int64_t) (server_receive_ms - request_local_ms) + (int64_t) (server_transmit_ms - receive_local_ms)) / 2;
+	int64_t sample_delay = (int64_t) (receive_local_ms - request_local_ms) - (int64_t) (server_transmit_ms - server_receive_ms);
+
+	offset = constrain(sample_offset, (int64_t) INT32_MIN, (int64_t) INT32_MAX);
+	round_trip = constrain(sample_delay, (int64_t) 0, (int64_t) UINT16_MAX);
+	stratum = packet[1];
+
+	time->adjustUnixMillis(sample_offset);
+	return true;
+}
+
+void NtpClient::nextServer() {
+	server_ip = 0;
+	server_index = (server_index + 1) % NTP_SERVERS_COUNT;
+	failed_count++;
+
+	state = NTP_IDLE;
+	state_timer = millis();
+}
+
+void NtpClient::dnsFound(const char* name, const ip_addr_t* ipaddr, void* callback_arg) {
+	dns_ip = (ipaddr != NULL) ? ip_addr_get_ip4_u32(ipaddr) : 0;
+	dns_index = (uint8_t) (uintptr_t) callback_arg;
+	dns_done_flag = true;
+}
+
+
+uint64_t NtpClient::readTimestamp(const uint8_t* buffer) {
+	uint32_t seconds = ((uint32_t) buffer[0] << 24) | ((uint32_t) buffer[1] << 16) | ((uint32_t) buffer[2] << 8) | buffer[3];
+	uint32_t fraction = ((uint32_t) buffer[4] << 24) | ((uint32_t) buffer[5] << 16) | ((uint32_t) buffer[6] << 8) | buffer[7];
+
+	if (seconds < NTP_UNIX_OFFSET) {
+		return 0;
+	}
+
+	return (uint64_t) (seconds - NTP_UNIX_OFFSET) * 1000 + (((uint64_t) fraction * 1000) >> 32);
+}
+
+void NtpClient::writeTimestamp(uint8_t* buffer, uint64_t unix_ms) {
+	uint32_t seconds = unix_ms / 1000 + NTP_UNIX_OFFSET;
+	uint32_t fraction = ((uint64_t) (unix_ms % 1000) << 32) / 1000;
+
+	for (uint8_t i = 0;i < 4;i++) {
+		buffer[i] = seconds >> (24 - i * 8);
+		buffer[4 + i] = fraction >> (24 - i * 8);
+	}
+}
+
+
+volatile bool NtpClient::dns_done_flag = false;
+volatile uint32_t NtpClient::dns_ip = 0;
+volatile uint8_t NtpClient::dns_index = 0;
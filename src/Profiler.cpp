@@ -0,0 +1,94 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "data.h"
+
+#ifdef PROFILER_SUPPORT
+
+static const char* profile_names[PROFILE_COUNT] = {
+	"loop", "time", "sensors", "solar", "display", "network", "blynk",
+	"save_settings", "read_settings", "web_build", "web_action", "blynk_send",
+};
+
+Profiler::Profiler() {
+	clear();
+	report_timer = 0;
+}
+
+bool Profiler::tick() {
+	if (!PROFILE_REPORT_TIME) {
+		return false;
+	}
+
+	if (halMillis() - report_timer >= SEC_TO_MLS(PROFILE_REPORT_TIME)) {
+		report_timer = halMillis();
+		return true;
+	}
+
+	return false;
+}
+
+profile_mark_t Profiler::mark() {
+	return {halMicros(), halFreeHeap()};
+}
+
+void Profiler::add(uint8_t section, profile_mark_t* mark) {
+	if (section >= PROFILE_COUNT) {
+		return;
+	}
+
+	profile_t* profile = &profiles[section];
+	uint32_t time = halMicros() - mark->time;
+	uint32_t heap = halFreeHeap();
+
+	profile->count++;
+	profile->time += time;
+	profile->time_max = max(profile->time_max, time);
+	profile->heap += (int32_t) mark->heap - (int32_t) heap;
+
+	if (heap < mark->heap) {
+		profile->heap_drops++;
+	}
+
+	heap_min = min(heap_min, heap);
+}
+
+void Profiler::clear() {
+	memset(profiles, 0, sizeof(profiles));
+	heap_min = UINT32_MAX;
+}
+
+
+// {"uptime":s,"heap":{...},"loop":{"n":calls,"avg":mcs,"max":mcs,"heap":bytes,"drops":calls},...}
+char* Profiler::makeJson(char* buffer, uint16_t size) {
+	uint16_t length = snprintf(buffer, size, "{\"uptime\":%u,\"heap\":{\"free\":%u,\"min\":%u,\"frag\":%u}",
+		halMillis() / 1000, halFreeHeap(), (heap_min == UINT32_MAX) ? halFreeHeap() : heap_min, halHeapFragmentation());
+
+	for (uint8_t i = 0;i < PROFILE_COUNT && length < size;i++) {
+		profile_t* profile = &profiles[i];
+
+		length += snprintf(buffer + length, size - length, ",\"%s\":{\"n\":%u,\"avg\":%u,\"max\":%u,\"heap\":%d,\"drops\":%u}",
+			profile_names[i], profile->count, profile->count ? profile->time / profile->count : 0, profile->time_max, profile->heap, profile->heap_drops);
+	}
+
+	if (length + 1 < size) {
+		strcat(buffer, "}");
+	}
+
+	return buffer;
+}
+
+profile_t* Profiler::getProfile(uint8_t section) {
+	if (section >= PROFILE_COUNT) {
+		return NULL;
+	}
+
+	return &profiles[section];
+}
+#endif
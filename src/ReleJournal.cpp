@@ -0,0 +1,192 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "core.h"
+
+static const char* const rele_reasons[] = {"delta_on", "delta_off", "error_on", "web", "blynk", "lcd", "system"};
+
+ReleJournal::ReleJournal() {
+	head = 0;
+	count = 0;
+	file_index = 0;
+
+	memset(counters, 0, sizeof(counters));
+	memset(run_timers, 0, sizeof(run_timers));
+	counters_flag = false;
+	flush_timer = 0;
+}
+
+void ReleJournal::begin() {
+	rele_counters_file_t file;
+
+	// a file of another size is from another build or was cut, the counters start over
+	if (halFileSize(RELE_COUNTERS_FILE) == sizeof(file) && halFileRead(RELE_COUNTERS_FILE, &file, sizeof(file), 0) == sizeof(file)) {
+		memcpy(counters, file.counters, sizeof(counters));
+		file_index = file.file_index & 1;
+	}
+
+	flush_timer = halMillis();
+}
+
+
+void ReleJournal::tick() {
+	if (halMillis() - flush_timer >= SEC_TO_MLS(RELE_JOURNAL_FLUSH_TIME)) {
+		flush();
+	}
+}
+
+void ReleJournal::push(rele_event_t* event) {
+	if (event->loop >= SOLAR_LOOPS_MAX) {
+		return;
+	}
+
+	if (event->rele_flag) {
+		counters[event->loop].starts++;
+		run_timers[event->loop] = max(halMillis(), (uint32_t) 1);
+	}
+	else {
+		addRunTime(event->loop);
+		run_timers[event->loop] = 0;
+	}
+	counters_flag = true;
+
+	if (count == RELE_JOURNAL_SIZE) {
+		flush();
+
+		// the file is not writable, the oldest event goes
+		if (count == RELE_JOURNAL_SIZE) {
+			head = (head + 1) % RELE_JOURNAL_SIZE;
+			count--;
+		}
+	}
+
+	events[(head + count) % RELE_JOURNAL_SIZE] = *event;
+	count++;
+}
+
+// RAM goes to the file as one block, the counters are rewritten with it
+void ReleJournal::flush() {
+	flush_timer = halMillis();
+
+	if (count) {
+		char buffer[RELE_JOURNAL_SIZE * RELE_JOURNAL_LINE_SIZE];
+		uint16_t length = 0;
+
+		for (uint8_t i = 0;i < count;i++) {
+			rele_event_t* event = &events[(head + i) % RELE_JOURNAL_SIZE];
+			char source_t[CENTI_STRING_SIZE];
+			char sink_t[CENTI_STRING_SIZE];
+
+			length += snprintf(&buffer[length], RELE_JOURNAL_LINE_SIZE, "%lu,%u,%s,%u,%s,%s\n",
+				(unsigned long) event->unix, event->loop, rele_reasons[constrain(event->reason, RELE_REASON_DELTA_ON, RELE_REASON_SYSTEM)],
+				event->rele_flag, centiToString(event->source_centi, 2, source_t), centiToString(event->sink_centi, 2, sink_t));
+		}
+
+		if (halFileSize(getFile()) + length > RELE_JOURNAL_FILE_MAX) {
+			file_index ^= 1;
+			halFileRemove(getFile());
+			counters_flag = true;
+		}
+
+		if (halFileWrite(getFile(), buffer, length, true)) {
+			head = 0;
+			count = 0;
+		}
+	}
+
+	for (uint8_t i = 0;i < SOLAR_LOOPS_MAX;i++) {
+		if (run_timers[i]) {
+			addRunTime(i);
+			counters_flag = true;
+		}
+	}
+
+	if (!counters_flag) {
+		return;
+	}
+
+	rele_counters_file_t file;
+
+	memset(&file, 0, sizeof(file));
+	memcpy(file.counters, counters, sizeof(counters));
+	file.file_index = file_index;
+
+	if (halFileWrite(RELE_COUNTERS_FILE, &file, sizeof(file), false)) {
+		counters_flag = false;
+	}
+}
+
+// the counters follow the loops down
+void ReleJournal::deleteLoop(uint8_t index) {
+	if (index >= SOLAR_LOOPS_MAX) {
+		return;
+	}
+
+	for (uint8_t i = index;i < SOLAR_LOOPS_MAX - 1;i++) {
+		counters[i] = counters[i + 1];
+		run_timers[i] = run_timers[i + 1];
+	}
+
+	memset(&counters[SOLAR_LOOPS_MAX - 1], 0, sizeof(rele_counter_t));
+	run_timers[SOLAR_LOOPS_MAX - 1] = 0;
+	counters_flag = true;
+}
+
+void ReleJournal::clearCounters() {
+	for (uint8_t i = 0;i < SOLAR_LOOPS_MAX;i++) {
+		counters[i].starts = 0;
+		counters[i].run_time = 0;
+
+		if (run_timers[i]) {
+			run_timers[i] = max(halMillis(), (uint32_t) 1);
+		}
+	}
+
+	counters_flag = true;
+	flush();
+}
+
+
+uint8_t ReleJournal::getCount() {
+	return count;
+}
+
+uint32_t ReleJournal::getStarts(uint8_t loop) {
+	if (loop >= SOLAR_LOOPS_MAX) {
+		return 0;
+	}
+
+	return counters[loop].starts;
+}
+
+// sec, the current run included
+uint32_t ReleJournal::getRunTime(uint8_t loop) {
+	if (loop >= SOLAR_LOOPS_MAX) {
+		return 0;
+	}
+
+	return counters[loop].run_time + (run_timers[loop] ? (halMillis() - run_timers[loop]) / 1000 : 0);
+}
+
+
+// whole seconds go to the counter, the rest stays in the timer
+void ReleJournal::addRunTime(uint8_t loop) {
+	if (!run_timers[loop]) {
+		return;
+	}
+
+	uint32_t run_time = (halMillis() - run_timers[loop]) / 1000;
+
+	counters[loop].run_time += run_time;
+	run_timers[loop] = max(run_timers[loop] + SEC_TO_MLS(run_time), (uint32_t) 1);
+}
+
+const char* ReleJournal::getFile() {
+	return file_index ? RELE_JOURNAL_FILE_1 : RELE_JOURNAL_FILE_0;
+}
@@ -0,0 +1,128 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "core.h"
+
+SafetyWatchdog::SafetyWatchdog() {
+	feed_timer = 0;
+	stall_flag = false;
+	outputs_count = 0;
+
+	memset(&rtc, 0, sizeof(watchdog_rtc_t));
+	memset(&counters, 0, sizeof(watchdog_counters_t));
+}
+
+void SafetyWatchdog::begin() {
+	watchdog_rtc_t last_rtc;
+	uint8_t reason = halResetReason();
+
+	if (halFileSize(WATCHDOG_FILE) == sizeof(watchdog_counters_t)) {
+		halFileRead(WATCHDOG_FILE, &counters, sizeof(watchdog_counters_t), 0);
+	}
+
+	// a stall that ended in a reset never reached the file
+	if (halRtcRead(WATCHDOG_RTC_OFFSET, &last_rtc, sizeof(watchdog_rtc_t)) && last_rtc.magic == WATCHDOG_RTC_MAGIC) {
+		counters.stall_count += last_rtc.stall_count;
+		counters.stall_time_max = max(counters.stall_time_max, last_rtc.stall_time_max);
+	}
+
+	if (reason == HAL_RESET_WDT || reason == HAL_RESET_SOFT_WDT || reason == HAL_RESET_EXCEPTION) {
+		counters.reset_count++;
+	}
+
+	rtc.magic = WATCHDOG_RTC_MAGIC;
+	rtc.stall_count = 0;
+	rtc.stall_time_max = 0;
+	halRtcWrite(WATCHDOG_RTC_OFFSET, &rtc, sizeof(watchdog_rtc_t));
+
+	save();
+	halTickerAttach(WATCHDOG_CHECK_TIME, check, this);
+}
+
+
+// moves finished stalls from RTC memory to the file
+void SafetyWatchdog::tick() {
+	if (!rtc.stall_count || stall_flag) {
+		return;
+	}
+
+	counters.stall_count += rtc.stall_count;
+	counters.stall_time_max = max(counters.stall_time_max, rtc.stall_time_max);
+
+	rtc.stall_count = 0;
+	rtc.stall_time_max = 0;
+	halRtcWrite(WATCHDOG_RTC_OFFSET, &rtc, sizeof(watchdog_rtc_t));
+
+	save();
+}
+
+void SafetyWatchdog::feed(const uint8_t* pins, const bool* safe_levels, uint8_t count) {
+	count = min(count, (uint8_t) SOLAR_LOOPS_MAX);
+
+	memcpy(this->pins, pins, count);
+	memcpy(this->safe_levels, safe_levels, count * sizeof(bool));
+	outputs_count = count;
+
+	feed_timer = max(halMillis(), (uint32_t) 1);
+	stall_flag = false;
+}
+
+void SafetyWatchdog::clear() {
+	memset(&counters, 0, sizeof(watchdog_counters_t));
+
+	rtc.stall_count = 0;
+	rtc.stall_time_max = 0;
+	halRtcWrite(WATCHDOG_RTC_OFFSET, &rtc, sizeof(watchdog_rtc_t));
+
+	save();
+}
+
+
+bool SafetyWatchdog::getStallFlag() {
+	return stall_flag;
+}
+
+uint32_t SafetyWatchdog::getStallCount() {
+	return counters.stall_count + rtc.stall_count;
+}
+
+uint32_t SafetyWatchdog::getResetCount() {
+	return counters.reset_count;
+}
+
+uint32_t SafetyWatchdog::getStallTimeMax() {
+	return max(counters.stall_time_max, rtc.stall_time_max);
+}
+
+
+// runs from the ticker: the relays are held in the fail-safe state until loop() feeds again
+void SafetyWatchdog::check(void* arg) {
+	SafetyWatchdog* watchdog = (SafetyWatchdog*) arg;
+	uint32_t stall_time = halMillis() - watchdog->feed_timer;
+
+	if (!watchdog->feed_timer || stall_time < SEC_TO_MLS(WATCHDOG_DEADLINE)) {
+		return;
+	}
+
+	for (uint8_t i = 0;i < watchdog->outputs_count;i++) {
+		halDigitalWrite(watchdog->pins[i], watchdog->safe_levels[i]);
+	}
+
+	if (!watchdog->stall_flag) {
+		watchdog->stall_flag = true;
+		watchdog->rtc.stall_count++;
+	}
+
+	watchdog->rtc.stall_time_max = max(watchdog->rtc.stall_time_max, stall_time / 1000);
+	halRtcWrite(WATCHDOG_RTC_OFFSET, &watchdog->rtc, sizeof(watchdog_rtc_t));
+}
+
+void SafetyWatchdog::save() {
+	halFileWrite(WATCHDOG_FILE, &counters, sizeof(watchdog_counters_t), false);
+}
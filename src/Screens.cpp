@@ -9,15 +9,176 @@
 
 #include "data.h"
 
-void MainWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	SolarSystemManager* solar = system->getSolarSystemManager();
-	Encoder* enc = system->getEncoder();
+MenuWindow::MenuWindow(const menu_t* menu) {
+	this->menu = menu;
+}
+
+void MenuWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
+	EncoderQueue* enc = system->getEncoder();
+	const menu_item_t* item = &menu->items[cursor];
+
+	if (edit_flag) {
+		edit_flag = false;
+
+		if (*edit_text) {
+			item->set_text(system, edit_text);
+		}
+	}
+
+	if (print_title_flag) {
+		print_title_flag = false;
+
+		if (menu->title != NULL) {
+			lcd->printTitle(1, menu->title);
+		}
+	}
+
+	if (print_flag) {
+		print_flag = false;
+
+		for (uint8_t i = 0;i < MENU_ROWS;i++) {
+			printItem(lcd, system, (cursor / MENU_ROWS) * MENU_ROWS + i);
+		}
+	}
+	lcd->easyPrint(0, cursor % MENU_ROWS, ">");
+
+	if (enc->isLeft(true) || enc->isRight(true)) {
+		lcd->easyPrint(0, cursor % MENU_ROWS, " ");
+
+		if (windowCursorTick(cursor, enc->isLeft() ? -1 : 1, menu->items_count - 1)) {
+			print_flag = true;
+			lcd->clear();
+		}
+
+		enc->isRight();
+	}
+	item = &menu->items[cursor];
+
+	if (enc->isLeftH(true) || enc->isRightH(true)) {
+		if (item->type == MENU_NUMBER) {
+			int32_t value = item->get(system);
+
+			smartIncr(value, enc->getStep(item->max - item->min), item->min, item->max);
+			item->set(system, value);
+
+			lcd->clearLine(cursor % MENU_ROWS);
+			printItem(lcd, system, cursor);
+		}
+
+		enc->isLeftH();
+		enc->isRightH();
+	}
+
+	if (enc->isClick()) {
+		switch (item->type) {
+		case MENU_TOGGLE:
+			item->set(system, !item->get(system));
+			break;
+		case MENU_CYCLE:
+			{
+			int32_t value = item->get(system) + 1;
+			item->set(system, (value > item->max) ? item->min : value);
+			}
+
+			break;
+		case MENU_ACTION:
+			if (isItemEnabled(system, item)) {
+				item->set(system, 0);
+			}
+
+			break;
+		case MENU_WINDOW:
+			if (isItemEnabled(system, item)) {
+				print_flag = true;
+				lcd->clear();
+
+				display->addWindowToStack(item->open(system));
+				return;
+			}
+
+			break;
+		case MENU_STRING:
+			{
+			KeyboardWindow* keyboard = new KeyboardWindow;
+
+			strncpy(edit_text, item->text(system), MENU_TEXT_SIZE - 1);
+			edit_text[MENU_TEXT_SIZE - 1] = '\0';
+			keyboard->setString(edit_text, constrain(item->max, 1, MENU_TEXT_SIZE));
+
+			edit_flag = true;
+			print_flag = true;
+			lcd->clear();
+
+			display->addWindowToStack(keyboard);
+			}
+
+			return;
+		}
+
+		lcd->clearLine(cursor % MENU_ROWS);
+		printItem(lcd, system, cursor);
+	}
+
+	if (enc->isHolded()) {
+		system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
+		lcd->clear();
+
+		if (menu->save_flag) {
+			system->saveSettingsRequest();
+		}
+
+		display->deleteWindowFromStack(this);
+	}
+}
+
+void MenuWindow::printItem(LcdManager* lcd, SystemManager* system, uint8_t index) {
+	if (index >= menu->items_count) {
+		return;
+	}
+
+	const menu_item_t* item = &menu->items[index];
+	uint8_t row = index % MENU_ROWS;
 
-	if (create_symbol_flag) {
-		create_symbol_flag = false;
-		makeSymbols(lcd);
+	lcd->easyPrint(1, row, item->label);
+
+	if ((item->type == MENU_ACTION || item->type == MENU_WINDOW) && item->text == NULL) {
+		if (isItemEnabled(system, item)) {
+			lcd->easyPrint(MENU_OK_COLUMN, row, "[ok]");
+		}
+
+		return;
+	}
+
+	lcd->print(" [");
+
+	if (item->text != NULL) {
+		const char* text = item->text(system);
+		// long values (ip addresses) are cut so they do not wrap onto another row
+		uint8_t text_size = constrain(MENU_COLUMNS - 4 - (int16_t) strlen(item->label), 0, MENU_TEXT_SIZE);
+
+		for (uint8_t i = 0;i < text_size && text[i];i++) {
+			lcd->write(text[i]);
+		}
+	}
+	else if (item->type == MENU_TOGGLE) {
+		lcd->print(item->get(system) ? "ON" : "OFF");
+	}
+	else {
+		lcd->print(item->get(system));
 	}
 
+	lcd->print("]");
+}
+
+bool MenuWindow::isItemEnabled(SystemManager* system, const menu_item_t* item) {
+	return (item->get == NULL || item->get(system));
+}
+
+
+void MainWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
+	SolarSystemManager* solar = system->getSolarSystemManager();
+	EncoderQueue* enc = system->getEncoder();
+
 	switch(cursor) {
 		case 0: printHome(lcd, system); break;
 		case 1: printSensors(lcd, system); break;
@@ -37,36 +198,34 @@ void MainWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager*
 	if (enc->isClick()) {
 		switch (cursor) {
 		case 1:
-			create_symbol_flag = true;
 			lcd->clear();
 
 			display->addWindowToStack(new DS18B20Window);
 			break;
 		case 2:
-			solar->setReleFlag(!solar->getReleFlag());
+			solar->setReleFlag(!solar->getReleFlag(), RELE_REASON_LCD);
 			break;
 		}
 	}
 	if (enc->isHolded()) {
-		create_symbol_flag = true;
 		lcd->clear();
 
 		switch (cursor) {
 		case 0:
-			display->addWindowToStack(new SettingsWindow);
+			display->addWindowToStack(new MenuWindow(&settings_menu));
 			break;
 		case 1:
 			display->addWindowToStack(new DS18B20SensorsSettingsWindow);
 			break;
 		case 2:
-			display->addWindowToStack(new SolarSettingsWindow);
+			display->addWindowToStack(new MenuWindow(&solar_settings_menu));
 			break;
 		case 3:
 		case 4:
-			display->addWindowToStack(new NetworkSettingsWindow);
+			display->addWindowToStack(new MenuWindow(&network_settings_menu));
 			break;
 		case 5:
-			display->addWindowToStack(new BlynkSettingsWindow);
+			display->addWindowToStack(new MenuWindow(&blynk_settings_menu));
 			break;
 		}
 	}
@@ -81,6 +240,7 @@ void MainWindow::printHome(LcdManager* lcd, SystemManager* system) {
 
 	uint8_t H = time->hour();
 	uint8_t M = time->minute();
+	uint8_t wifi_code = lcd->loadGlyph(GLYPH_WIFI);
 
 	lcd->easyPrint(0, 0, (time->getStatus() && IS_EVEN_SECOND(millis()) ) ? "T" : " ");
 	lcd->print((sensors->getAM2320Status() && IS_EVEN_SECOND(millis()) ) ? "A" : " ");
@@ -101,7 +261,7 @@ void MainWindow::printHome(LcdManager* lcd, SystemManager* system) {
 		lcd->write(32);
 	}
 	else {
-		lcd->write((network->getStatus() == WL_CONNECTED || IS_EVEN_SECOND(millis()) ) ? 7 : 32);
+		lcd->write((network->getStatus() == WL_CONNECTED || IS_EVEN_SECOND(millis()) ) ? wifi_code : 32);
 	}
 
 	if (!blynk->getWorkFlag()) {
@@ -130,40 +290,44 @@ void MainWindow::printSensors(LcdManager* lcd, SystemManager* system) {
 
 	lcd->easyPrint(0, 0, (!solar->getBatterySensorStatus() || IS_EVEN_SECOND(millis()) ) ? "BAT" : "   ");
 	lcd->print(":");
-	lcd->print(solar->getBatteryT(), 2);
+	lcd->printCenti(solar->getBatteryTCenti());
 	lcd->write(223);
 
 	lcd->easyPrint(0, 1, (!solar->getBoilerSensorStatus() || IS_EVEN_SECOND(millis()) ) ? "BOI" : "   ");
 	lcd->print(":");
-	lcd->print(solar->getBoilerT(), 2);
+	lcd->printCenti(solar->getBoilerTCenti());
 	lcd->write(223);
 
 	lcd->easyPrint(0, 2, (!solar->getExitSensorStatus() || IS_EVEN_SECOND(millis()) ) ? "EXT" : "   ");
 	lcd->print(":");
-	lcd->print(solar->getExitT(), 2);
+	lcd->printCenti(solar->getExitTCenti());
 	lcd->write(223);
 
 	lcd->easyPrint(12, 0, (!sensors->getAM2320Status() || IS_EVEN_SECOND(millis()) ) ? "T" : " ");
 	lcd->print(":");
-	lcd->print(sensors->getAM2320T(), 2);
+	lcd->printCenti(sensors->getAM2320TCenti());
 	lcd->write(223);
 
 	lcd->easyPrint(12, 1, (!sensors-> getAM2320Status() || IS_EVEN_SECOND(millis()) ) ? "H" : " ");
 	lcd->print(":");
-	lcd->print(sensors->getAM2320H(), 2);
+	lcd->printCenti(sensors->getAM2320HCenti());
 	lcd->print("%");
 }
 
 void MainWindow::printSolar(LcdManager* lcd, SystemManager* system) {
 	SolarSystemManager* solar = system->getSolarSystemManager();
+	int16_t boiler_t = solar->getBoilerTCenti();
+	int16_t battery_t = solar->getBatteryTCenti();
 
 	for (byte i = 0;i < 3;i++) {
 		lcd->easyPrint(1, i, "|");
 		lcd->easyPrint(5, i, "|");
 	}
 	if (!solar->getBoilerSensorStatus() || IS_EVEN_SECOND(millis()) ) {
-		lcd->easyPrint(2, 0, (int8_t)solar->getBoilerT());
-		lcd->easyPrint(2, 1, String(".") + (int8_t)((solar->getBoilerT() - (int8_t)solar->getBoilerT()) * 100) );
+		lcd->easyPrint(2, 0, (int32_t) (boiler_t / 100));
+		lcd->easyPrint(2, 1, ".");
+		lcd->print(abs(boiler_t % 100) / 10);
+		lcd->print(abs(boiler_t % 100) % 10);
 		lcd->easyWrite(4, 2, 223);
 	}
 	else {
@@ -176,7 +340,7 @@ void MainWindow::printSolar(LcdManager* lcd, SystemManager* system) {
 	lcd->easyPrint(8, 1, (solar->getWorkFlag()) ? "ON " : "OFF");
 
 	if (!solar->getExitSensorStatus() || IS_EVEN_SECOND(millis()) ) {
-		lcd->easyPrint(7, 2, solar->getExitT());
+		lcd->easyPrintCenti(7, 2, solar->getExitTCenti());
 		lcd->write(223);
 	}
 	else {
@@ -205,8 +369,9 @@ void MainWindow::printSolar(LcdManager* lcd, SystemManager* system) {
 	lcd->easyPrint(15, 3, "-----");
 
 	if (!solar->getBatterySensorStatus() || IS_EVEN_SECOND(millis()) ) {
-		lcd->easyPrint(14, 1, (int)solar->getBatteryT());
-		lcd->easyPrint(15, 2, String(".") + (int)((solar->getBatteryT() - (int)solar->getBatteryT()) * 10) );
+		lcd->easyPrint(14, 1, (int32_t) (battery_t / 100));
+		lcd->easyPrint(15, 2, ".");
+		lcd->print(abs(battery_t % 100) / 10);
 		lcd->write(223);
 	}
 	else {
@@ -297,131 +462,39 @@ void MainWindow::printAp(LcdManager* lcd, SystemManager* system) {
 }
 
 void MainWindow::printDigit(LcdManager* lcd, uint8_t x, uint8_t y, uint8_t digit) {
-	switch (digit) {
-	case 0:
-		lcd->setCursor(x, y);
-		lcd->write(0);
-		lcd->write(1);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(3);
-		lcd->write(4);
-		lcd->write(5);
-		break;
-	case 1:
-		lcd->setCursor(x, y);
-		lcd->write(32);
-		lcd->write(1);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(32);
-		lcd->write(32);
-		lcd->write(5);
-		break;
-	case 2:
-		lcd->setCursor(x, y);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(3);
-		lcd->write(6);
-		lcd->write(6);
-		break;
-	case 3:
-		lcd->setCursor(x, y);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->write(5);
-		break;
-	case 4:
-		lcd->setCursor(x, y);
-		lcd->write(3);
-		lcd->write(4);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(32);
-		lcd->write(32);
-		lcd->write(5);
-		break;
-	case 5:
-		lcd->setCursor(x, y);
-		lcd->write(0);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->setCursor(x, y + 1);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->write(5);
-		break;
-	case 6:
-		lcd->setCursor(x, y);
-		lcd->write(0);
-		lcd->write(6);
-		lcd->write(6);
-		lcd->setCursor(x, y + 1);
-		lcd->write(3);
-		lcd->write(6);
-		lcd->write(5);
-		break;
-	case 7:
-		lcd->setCursor(x, y);
-		lcd->write(1);
-		lcd->write(1);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(32);
-		lcd->write(32);
-		lcd->write(0);
-		break;
-	case 8:
-		lcd->setCursor(x, y);
-		lcd->write(0);
-		lcd->write(6);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(3);
-		lcd->write(6);
-		lcd->write(5);
-		break;
-	case 9:
-		lcd->setCursor(x, y);
-		lcd->write(0);
-		lcd->write(6);
-		lcd->write(2);
-		lcd->setCursor(x, y + 1);
-		lcd->write(32);
-		lcd->write(4);
-		lcd->write(5);
-		break;
-	case 10:
-		lcd->setCursor(x, y);
-		lcd->print("   ");
-		lcd->setCursor(x, y + 1);
-		lcd->print("   ");
-		break;
-	}
-}
-
-void MainWindow::makeSymbols(LcdManager* lcd) {
-	lcd->createChar(0, LT);
-	lcd->createChar(1, UB);
-	lcd->createChar(2, RT);
-	lcd->createChar(3, LL);
-	lcd->createChar(4, LB);
-	lcd->createChar(5, LR);
-	lcd->createChar(6, UMB);
-	lcd->createChar(7, wifi);
+	static const uint8_t big_digits[10][6] = {
+		{GLYPH_LT, GLYPH_UB, GLYPH_RT, GLYPH_LL, GLYPH_LB, GLYPH_LR},
+		{' ', GLYPH_UB, GLYPH_RT, ' ', ' ', GLYPH_LR},
+		{GLYPH_UMB, GLYPH_UMB, GLYPH_RT, GLYPH_LL, GLYPH_UMB, GLYPH_UMB},
+		{GLYPH_UMB, GLYPH_UMB, GLYPH_RT, GLYPH_UMB, GLYPH_UMB, GLYPH_LR},
+		{GLYPH_LL, GLYPH_LB, GLYPH_RT, ' ', ' ', GLYPH_LR},
+		{GLYPH_LT, GLYPH_UMB, GLYPH_UMB, GLYPH_UMB, GLYPH_UMB, GLYPH_LR},
+		{GLYPH_LT, GLYPH_UMB, GLYPH_UMB, GLYPH_LL, GLYPH_UMB, GLYPH_LR},
+		{GLYPH_UB, GLYPH_UB, GLYPH_RT, ' ', ' ', GLYPH_LT},
+		{GLYPH_LT, GLYPH_UMB, GLYPH_RT, GLYPH_LL, GLYPH_UMB, GLYPH_LR},
+		{GLYPH_LT, GLYPH_UMB, GLYPH_RT, ' ', GLYPH_LB, GLYPH_LR}
+	};
+	uint8_t codes[6];
+
+	// glyphs are loaded before positioning: an upload moves the lcd address into CGRAM
+	for (uint8_t i = 0;i < 6;i++) {
+		codes[i] = (digit < 10) ? lcd->loadGlyph(big_digits[digit][i]) : ' ';
+	}
+
+	lcd->setCursor(x, y);
+	lcd->write(codes[0]);
+	lcd->write(codes[1]);
+	lcd->write(codes[2]);
+	lcd->setCursor(x, y + 1);
+	lcd->write(codes[3]);
+	lcd->write(codes[4]);
+	lcd->write(codes[5]);
 }
 
 
 void DS18B20Window::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
 	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 
 	if (!sensors->getDS18B20Count()) {
 		lcd->easyPrint(1, 0, "NO DS18B20");
@@ -433,7 +506,7 @@ void DS18B20Window::print(LcdManager* lcd, DisplayManager* display, SystemManage
 			if (ds_index < sensors->getDS18B20Count()) {
 				lcd->easyPrint(0, i, (!sensors->getDS18B20Status(ds_index) || IS_EVEN_SECOND(millis()) ) ? sensors->getDS18B20Name(ds_index) : "  ");
 				lcd->print(":");
-				lcd->print(sensors->getDS18B20T(ds_index), 2);
+				lcd->printCenti(sensors->getDS18B20TCenti(ds_index));
 				lcd->write(223);
 				lcd->print("   ");
 			}
@@ -464,174 +537,46 @@ void DS18B20Window::print(LcdManager* lcd, DisplayManager* display, SystemManage
 }
 
 
-void SettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	Encoder* enc = system->getEncoder();
-
-	if (print_title_flag) {
-		print_title_flag = false;
-		lcd->printTitle(1, "Menu");
-	}
+void WifiSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
+	NetworkManager* network = system->getNetworkManager();
+	EncoderQueue* enc = system->getEncoder();
 
-	if (print_flag) {
-		print_flag = false;
+	if (initialization_flag) {
+		initialization_flag = false;
 
-		lcd->easyPrint(1, 0, "Network       [ok]");
-		lcd->easyPrint(1, 1, "Blynk         [ok]");
-		lcd->easyPrint(1, 2, "Solar         [ok]");
-		lcd->easyPrint(1, 3, "System        [ok]");
+		strcat(ssid_to_set, network->getWifiSsid());
+		strcat(pass_to_set, network->getWifiPass());
 	}
-	lcd->easyPrint(0, cursor, ">");
 
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor, " ");
-		windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 3);
-		
-		enc->isRight();
-	}
-		
-	if (enc->isClick()) {
-		print_flag = true;
-		lcd->clear();
+	if (connect_flag) {
+		uint8_t connect_state = network->getConnectState();
 
-		switch (cursor) {
-		case 0:
-			display->addWindowToStack(new NetworkSettingsWindow);
-			break;
+		lcd->easyPrint(0, 0, "Connecting to:");
+		lcd->easyPrint(2, 1, ssid_to_set);
 
-		case 1:
-			display->addWindowToStack(new BlynkSettingsWindow);
-			break;
-		
-		case 2:
-			display->addWindowToStack(new SolarSettingsWindow);
-			break;
+		if (connect_state == NETWORK_CONNECT_PENDING) {
+			lcd->easyPrint(2, 2, network->getConnectTimeLeft());
+			lcd->print("s ");
 
-		case 3:
-			display->addWindowToStack(new SystemSettingsWindow);
-			break;
+			return;
 		}
-	}
-	if (enc->isHolded()) {
-		system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
-
-		system->saveSettingsRequest();
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
-void NetworkSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	NetworkManager* network = system->getNetworkManager();
-	Encoder* enc = system->getEncoder();
-
-	if (*ssid_ap_to_set || *pass_ap_to_set) {
-		network->setAp((*ssid_ap_to_set) ? ssid_ap_to_set : NULL, (*pass_ap_to_set) ? pass_ap_to_set : NULL);
-
-		*ssid_ap_to_set = '\0';
-		*pass_ap_to_set = '\0';
-	}
-	
-	if (print_flag) {
-		print_flag = false;
+		lcd->easyPrint(2, 2, (connect_state == NETWORK_CONNECT_OK) ? "OK " : "ERR");
 
-		lcd->easyPrint(1, 0, "Mode [");
-
-		switch (network->getMode()) {
-		case NETWORK_OFF:
-			lcd->print("off");
-			break;
-		case NETWORK_STA:
-			lcd->print("sta");
-			break;
-		case NETWORK_AP_STA:
-			lcd->print("ap_sta");
-			break;
-		case NETWORK_AUTO:
-			lcd->print("auto");
-			break;
+		if (!connect_result_timer) {
+			connect_result_timer = millis();
 		}
-		lcd->print("]");
-		
-		lcd->easyPrint(1, 1, "WiFi [");
-		lcd->print(network->getWifiSsid());
-		lcd->print("]");
-
-		lcd->easyPrint(1, 2, "Ssid [");
-		lcd->print(network->getApSsid());
-		lcd->print("]");
-		
-		lcd->easyPrint(1, 3, "Pass [");
-		lcd->print(network->getApPass());
-		lcd->print("]");
-	}
-	lcd->easyPrint(0, cursor, ">");
-
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor, " ");
-		windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 3);
-		
-		enc->isRight();
-	}
-
-	if (enc->isClick()) {
-		print_flag = true;
-
-		switch (cursor) {
-		case 0:
-			lcd->clearLine(cursor);
-			network->setMode((network->getMode() == NETWORK_AUTO) ? NETWORK_OFF : network->getMode() + 1);
-			
-			break;
-		case 1:
-			lcd->clear();
-			display->addWindowToStack(new WifiSettingsWindow);
-
-			break;
-		case 2:
-			{
-			KeyboardWindow* keyboard = new KeyboardWindow;
-
-			strcat(ssid_ap_to_set, network->getApSsid());
-			keyboard->setString(ssid_ap_to_set, NETWORK_SSID_PASS_SIZE);
-
-			lcd->clear();
-			display->addWindowToStack(keyboard);
-			}
-
-			break;
-		case 3:
-			{
-			KeyboardWindow* keyboard = new KeyboardWindow;
-
-			strcat(pass_ap_to_set, network->getApPass());
-			keyboard->setString(pass_ap_to_set, NETWORK_SSID_PASS_SIZE);
-
-			lcd->clear();
-			display->addWindowToStack(keyboard);
-			}
-
-			break;
+		if (millis() - connect_result_timer < SCREEN_CONNECT_RESULT_TIME) {
+			return;
 		}
-	}
-	if (enc->isHolded()) {
-		system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
 
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
-void WifiSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	NetworkManager* network = system->getNetworkManager();
-	Encoder* enc = system->getEncoder();
-
-	if (initialization_flag) {
-		initialization_flag = false;
+		connect_flag = false;
+		connect_result_timer = 0;
+		lcd->clear();
 
-		strcat(ssid_to_set, network->getWifiSsid());
-		strcat(pass_to_set, network->getWifiPass());
+		if (connect_state == NETWORK_CONNECT_OK) {
+			display->deleteWindowFromStack(this);
+			return;
+		}
 	}
 
 	if (print_flag) {
@@ -652,131 +597,41 @@ void WifiSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemM
 	if (enc->isLeft(true) || enc->isRight(true)) {
 		lcd->easyPrint(0, cursor, " ");
 		windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 2);
-		
-		enc->isRight();
-	}
-
-	if (enc->isClick()) {
-		print_flag = true;
-		lcd->clear();
-
-		switch (cursor) {
-		case 0:
-			{
-			SetWifiStationWindow* set_wifi_station_window = new SetWifiStationWindow;
-			set_wifi_station_window->setString(ssid_to_set, NETWORK_SSID_PASS_SIZE);
-
-			display->addWindowToStack(set_wifi_station_window);			
-			}
-
-			break;
-		case 1:
-			{
-			KeyboardWindow* keyboard = new KeyboardWindow;
-			keyboard->setString(pass_to_set, NETWORK_SSID_PASS_SIZE);
-
-			display->addWindowToStack(keyboard);			
-			}
-
-			break;
-		case 2:
-			if (!*ssid_to_set) {
-				network->setWifi("", "");
-			}
-			else {
-				bool connect_flag = false;
-				display->setWorkFlag(false);
-				
-				lcd->easyPrint(0, 0, "Connecting to:");
-				lcd->easyPrint(2, 1, ssid_to_set);
-				lcd->easyPrint(2, 2, "...");
-
-				connect_flag = network->connect(ssid_to_set, pass_to_set, 10, true);
-
-				lcd->easyPrint(2, 2, (connect_flag) ? "OK " : "ERR");
-			
-				delay(500);
-				lcd->clear();
-
-				display->setWorkFlag(true);
-
-				if (connect_flag) {
-					display->deleteWindowFromStack(this);
-				}
-			}
-
-			break;
-		}
-	}
-	if (enc->isHolded()) {
-		system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
-
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
-void BlynkSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	BlynkManager* blynk = system->getBlynkManager();
-	Encoder* enc = system->getEncoder();
-
-	if (print_flag) {
-		print_flag = false;
-
-		lcd->easyPrint(1, 0, "Status [");
-		lcd->print(blynk->getWorkFlag() ? "ON" : "OFF");
-		lcd->print("]");
-
-		lcd->easyPrint(1, 1, "Send time [");
-		lcd->print(blynk->getSendDataTime());
-		lcd->print("]");
-
-		lcd->easyPrint(1, 2, "Auth [");
-		lcd->print((*blynk->getAuth()) ? "SET" : "UNSET");
-		lcd->print("]");
-
-		lcd->easyPrint(1, 3, "Links         [ok]");
-	}
-	lcd->easyPrint(0, cursor, ">");
-
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor, " ");
-		windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 3);
-			
-		enc->isRight();
-	}
-
-	if (enc->isLeftH(true) || enc->isRightH(true)) {
-		print_flag = true;
-		lcd->clearLine(cursor % 4);
-
-		switch (cursor) {
-		case 1:
-			blynk->setSendDataTime(blynk->getSendDataTime() + (enc->isLeftH() ? -1 : 1));
-			break;
-		}
-
-		enc->isRightH();
+		
+		enc->isRight();
 	}
 
 	if (enc->isClick()) {
 		print_flag = true;
-		
+		lcd->clear();
+
 		switch (cursor) {
 		case 0:
-			lcd->clearLine(cursor);
-			blynk->setWorkFlag(!blynk->getWorkFlag());
+			{
+			SetWifiStationWindow* set_wifi_station_window = new SetWifiStationWindow;
+			set_wifi_station_window->setString(ssid_to_set, NETWORK_SSID_PASS_SIZE);
+
+			display->addWindowToStack(set_wifi_station_window);			
+			}
 
 			break;
-		case 2:
-			lcd->clearLine(cursor);
-			blynk->setAuth("");
+		case 1:
+			{
+			KeyboardWindow* keyboard = new KeyboardWindow;
+			keyboard->setString(pass_to_set, NETWORK_SSID_PASS_SIZE);
+
+			display->addWindowToStack(keyboard);			
+			}
 
 			break;
-		case 3:
-			lcd->clear();
-			display->addWindowToStack(new BlynkLinksSettingsWindow);
+		case 2:
+			if (!*ssid_to_set) {
+				network->setWifi("", "");
+			}
+			else {
+				connect_flag = true;
+				network->beginConnect(ssid_to_set, pass_to_set, NETWORK_CONNECT_TIME, true);
+			}
 
 			break;
 		}
@@ -792,7 +647,7 @@ void BlynkSettingsWindow::print(LcdManager* lcd, DisplayManager* display, System
 
 void BlynkLinksSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
 	BlynkManager* blynk = system->getBlynkManager();
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 	
 	if (scan_flag == true) {
 		scan_flag = false;
@@ -850,7 +705,7 @@ void BlynkLinksSettingsWindow::print(LcdManager* lcd, DisplayManager* display, S
 		if (cursor < blynk->getLinksCount()) {
 			switch (value_cursor) {
 			case false:
-				blynk->setLinkPort(cursor, blynk->getLinkPort(cursor) + (enc->isLeftH() ? -1 : 1));
+				blynk->setLinkPort(cursor, blynk->getLinkPort(cursor) + enc->getStep());
 				break;
 
 			case true:
@@ -898,310 +753,9 @@ void BlynkLinksSettingsWindow::print(LcdManager* lcd, DisplayManager* display, S
 }
 
 
-void SolarSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	SolarSystemManager* solar = system->getSolarSystemManager();
-	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
-
-	if (print_flag) {
-		print_flag = false;
-		if (!(cursor / 4)) {
-			lcd->easyPrint(1, 0, "Status [");
-			lcd->print((solar->getWorkFlag()) ? "ON" : "OFF");
-			lcd->print("]");
-
-			lcd->easyPrint(1, 1, "Error on [");
-			lcd->print((solar->getErrorOnFlag()) ? "ON" : "OFF");
-			lcd->print("]");
-
-			lcd->easyPrint(1, 2, "Rele invert [");
-			lcd->print((solar->getReleInvertFlag()) ? "ON" : "OFF");
-			lcd->print("]");
-			
-			lcd->easyPrint(1, 3, "Delta [");
-			lcd->print(solar->getDelta());
-			lcd->print("]");
-		}
-
-		else if (cursor / 4 == 1) {
-			for (uint8_t i = 0;i < 3;i++) {
-				int8_t sensor_index = solar->getSensor(i);
-				
-				switch (i) {
-				case 0:
-					lcd->easyPrint(1, i, "Battery");
-					break;
-				case 1:
-					lcd->easyPrint(1, i, "Boiler");
-					break;
-				case 2:
-					lcd->easyPrint(1, i, "Exit");
-					break;
-				}
-				
-				lcd->print(" [");
-				lcd->print((sensor_index >= 0) ? sensors->getDS18B20Name(sensor_index) : "NONE");
-				lcd->print("]");
-			}
-		}
-	}
-	lcd->easyPrint(0, cursor % 4, ">");
-
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor % 4, " ");
-
-		if (windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 6)) {
-			print_flag = true;
-			lcd->clear();
-		}
-
-		enc->isRight();
-	}
-
-	if (enc->isLeftH(true) || enc->isRightH(true)) {
-		print_flag = true;
-	  	lcd->clearLine(cursor % 4);
-		
-		switch (cursor) {
-		case 3:
-			solar->setDelta(solar->getDelta() + (enc->isLeftH() ? -1 : 1));
-			break;
-		case 4:
-		case 5:
-		case 6:
-			{
-			int8_t sensor_index = solar->getSensor(cursor % 4);
-			solar->setSensor(cursor % 4, sensor_index + (enc->isLeftH() ? -1 : 1));
-			}
-
-			break;
-		}
-
-		enc->isLeftH();
-	  	enc->isRightH();
-	}
-	
-	if (enc->isClick()) {
-		print_flag = true;
-	  	lcd->clearLine(cursor % 4);
-
-		switch (cursor) {
-		case 0:
-			solar->setWorkFlag(!solar->getWorkFlag());
-			break;
-		case 1:
-			solar->setErrorOnFlag(!solar->getErrorOnFlag());
-			break;
-		case 2:
-			solar->setReleInvertFlag(!solar->getReleInvertFlag());
-			break;
-		}
-	}
-	if (enc->isHolded()) {
-	  	system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
-
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
-void SystemSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
-
-	if (print_flag) {
-		print_flag = false;
-
-		if (!(cursor / 4)) {
-			lcd->easyPrint(1, 0, "Time          [ok]");
-			lcd->easyPrint(1, 1, "DS18B20       [ok]");
-			lcd->easyPrint(1, 2, "Reset All     [ok]");
-
-			lcd->easyPrint(1, 3, "Time data [");
-			lcd->print(sensors->getReadDataTime());
-			lcd->print("]");
-		}
-
-		else if (cursor / 4 == 1) {
-			lcd->easyPrint(1, 0, "Auto reset [");
-			lcd->print(display->getAutoResetFlag() ? "ON" : "OFF");
-			lcd->print("]");
-
-			lcd->easyPrint(1, 1, "Time display [");
-			lcd->print(display->getBacklightOffTime());
-			lcd->print("]");
-
-			lcd->easyPrint(1, 2, "Display fps [");
-			lcd->print(display->getFps());
-			lcd->print("]");
-
-			lcd->easyPrint(1, 3, "Buzzer [");
-			lcd->print(system->getBuzzerFlag() ? "ON" : "OFF");
-			lcd->print("]");
-		}
-	}
-	lcd->easyPrint(0, cursor % 4, ">");
-
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor % 4, " ");
-
-		if (windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 7)) {
-			print_flag = true;
-			lcd->clear();
-		}
-
-		enc->isRight();
-	}
-
-	if (enc->isLeftH(true) || enc->isRightH(true)) {
-		print_flag = true;
-		lcd->clearLine(cursor % 4);
-
-		switch (cursor) {
-		case 3:
-			sensors->setReadDataTime(sensors->getReadDataTime() + (enc->isLeftH() ? -1 : 1));
-			break;
-		case 5:
-			display->setBacklightOffTime(display->getBacklightOffTime() + (enc->isLeftH() ? -1 : 1));
-			break;
-		case 6:
-			display->setFps(display->getFps() + (enc->isLeftH() ? -1 : 1));
-			break;
-		}
-
-		enc->isLeftH();
-		enc->isRightH();
-	}
-
-	if (enc->isClick()) {
-		print_flag = true;
-
-		switch(cursor) {
-		case 0:
-			lcd->clear();
-			display->addWindowToStack(new TimeSettingsWindow);
-
-			break; 
-		case 1:
-			lcd->clear();
-			display->addWindowToStack(new DS18B20SensorsSettingsWindow);
-
-			break;
-		case 2:
-			system->resetAll();
-			break;
-
-		case 4:
-			lcd->clearLine(cursor % 4);
-			display->setAutoResetFlag(!display->getAutoResetFlag());
-
-			break;
-		case 7:
-			lcd->clearLine(cursor % 4);
-			system->setBuzzerFlag(!system->getBuzzerFlag());
-
-			break;
-		}
-	}
-
-	if (enc->isHolded()) {
-	  	system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
-
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
-void TimeSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	TimeManager* time = system->getTimeManager();
-	Encoder* enc = system->getEncoder();
-	
-	if (time_to_set != NULL) {
-		time->setTime(time_to_set);
-		free(time_to_set);
-
-		time_to_set = NULL;
-	}
-
-	if (print_flag) {
-		print_flag = false;
-
-		lcd->easyPrint(1, 0, "Ntp sync [");
-		lcd->print(time->getNtpFlag() ? "ON" : "OFF");
-		lcd->print("]");
-
-		lcd->easyPrint(1, 1, "Gmt [");
-		lcd->print(time->getGmt());
-		lcd->print("]");
-		
-		lcd->easyPrint(1, 2, "Time          ");
-		lcd->print(time->getNtpFlag() ? "    " : "[OK]");
-		lcd->easyPrint(0, cursor, ">");
-	}
-	lcd->easyPrint(0, cursor, ">");
-
-	if (enc->isLeft(true) || enc->isRight(true)) {
-		lcd->easyPrint(0, cursor, " ");
-		windowCursorTick(cursor, enc->isLeft() ? -1 : 1, 2);
-		
-		enc->isRight();
-	}
-
-	if (enc->isLeftH(true) || enc->isRightH(true)) {
-		print_flag = true;
-		lcd->clearLine(cursor);
-
-		switch (cursor) {
-		case 1:
-			time->setGmt(time->getGmt() + (enc->isLeftH() ? -1 : 1));
-			break;
-		}
-
-		enc->isLeftH();
-	  	enc->isRightH();
-	}
-
-	if (enc->isClick()) {
-		print_flag = true;
-
-		switch (cursor) {
-		case 0:
-			lcd->clearLine(cursor);
-			time->setNtpFlag(!time->getNtpFlag());
-
-			break;
-		case 2:
-			if (!time->getNtpFlag()) {
-				SetTimeWindow* set_time_window = new SetTimeWindow;
-				TimeT time_now = time->getTime();
-
-				time_to_set = new TimeT;
-
-				memcpy(time_to_set, &time_now, sizeof(TimeT));
-				set_time_window->setTimeT(time_to_set);
-
-				lcd->clear();
-				display->addWindowToStack(set_time_window);
-			}
-
-			break;
-		}
-	}
-	
-	if (enc->isHolded()) {
-	  	system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
-		lcd->clear();
-
-		display->deleteWindowFromStack(this);
-	}
-}
-
-
 void DS18B20SensorsSettingsWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
 	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 
 	if (ds18b20_to_set != NULL) {
 		sensors->setDS18B20(cursor, ds18b20_to_set);
@@ -1224,7 +778,7 @@ void DS18B20SensorsSettingsWindow::print(LcdManager* lcd, DisplayManager* displa
 			if (ds_index < sensors->getDS18B20Count()) {
 				lcd->easyPrint(1, i, sensors->getDS18B20Name(ds_index));
 
-				lcd->easyPrint(8, i, sensors->getDS18B20T(ds_index));
+				lcd->easyPrintCenti(8, i, sensors->getDS18B20TCenti(ds_index));
 				lcd->write(223);
 			}
 
@@ -1291,31 +845,32 @@ void DS18B20SensorsSettingsWindow::print(LcdManager* lcd, DisplayManager* displa
 
 
 void SetTimeWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	Encoder* enc = system->getEncoder();
-
-	if (create_symbol_flag) {
-		create_symbol_flag = false;
+	TimeManager* time = system->getTimeManager();
+	EncoderQueue* enc = system->getEncoder();
+	uint8_t down_code = lcd->loadGlyph(GLYPH_DOWN);
 
-		lcd->createChar(0, down_symbol);
+	if (initialization_flag) {
+		initialization_flag = false;
+		config_time = time->getTime();
 	}
 	
 	if (print_flag) {
 		print_flag = false;
 
-		lcd->easyPrint(5, 1, config_time->hour);
+		lcd->easyPrint(5, 1, config_time.hour);
 		lcd->easyPrint(7, 1, ":");
-		lcd->print(config_time->minute);
+		lcd->print(config_time.minute);
 		lcd->easyPrint(10, 1, ":");
-		lcd->print(config_time->second);
+		lcd->print(config_time.second);
 
-		lcd->easyPrint(5, 3, config_time->day);
+		lcd->easyPrint(5, 3, config_time.day);
 		lcd->easyPrint(7, 3, ".");
-		lcd->print(config_time->month);
+		lcd->print(config_time.month);
 		lcd->easyPrint(10, 3, ".");
-		lcd->print(config_time->year);
+		lcd->print(config_time.year);
 	}
-	lcd->easyWrite(5 + (cursor % 3) * 3, 2, (cursor < 3) ? '^' : (char)0);
-	lcd->easyWrite(6 + (cursor % 3) * 3, 2, (cursor < 3) ? '^' : (char)0);
+	lcd->easyWrite(5 + (cursor % 3) * 3, 2, (cursor < 3) ? '^' : down_code);
+	lcd->easyWrite(6 + (cursor % 3) * 3, 2, (cursor < 3) ? '^' : down_code);
 		
 	if (enc->isLeft(true) || enc->isRight(true)) {
 		lcd->easyPrint(5 + (cursor % 3) * 3, 2, "  ");
@@ -1330,25 +885,26 @@ void SetTimeWindow::print(LcdManager* lcd, DisplayManager* display, SystemManage
 
 		switch (cursor) {
 		case 0:
-			smartIncr(config_time->hour, enc->isLeftH() ? -1 : 1, 0, 23);
+			smartIncr(config_time.hour, enc->getStep(23), 0, 23);
 			break;
 		case 1:
-			smartIncr(config_time->minute, enc->isLeftH() ? -1 : 1, 0, 59);
+			smartIncr(config_time.minute, enc->getStep(59), 0, 59);
 			break;
 		case 2:
-			smartIncr(config_time->second, enc->isLeftH() ? -1 : 1, 0, 59);
+			smartIncr(config_time.second, enc->getStep(59), 0, 59);
 			break;
 		case 3:
-			smartIncr(config_time->day, enc->isLeftH() ? -1 : 1, 1, 31);
+			smartIncr(config_time.day, enc->getStep(31 - 1), 1, 31);
 			break;
 		case 4:
-			smartIncr(config_time->month, enc->isLeftH() ? -1 : 1, 1, 12);
+			smartIncr(config_time.month, enc->getStep(12 - 1), 1, 12);
 			break;
 		case 5:
-			smartIncr(config_time->year, enc->isLeftH() ? -1 : 1, 1970, 2037);
+			smartIncr(config_time.year, enc->getStep(2037 - 1970), 1970, 2037);
 			break;
 		}
 
+		enc->isLeftH();
 		enc->isRightH();
 	}
 
@@ -1356,18 +912,15 @@ void SetTimeWindow::print(LcdManager* lcd, DisplayManager* display, SystemManage
 	  	system->buzzer(SCREEN_EXIT_BUZZER_FREQ, SCREEN_EXIT_BUZZER_TIME);
 		lcd->clear();
 
+		time->setTime(&config_time);
 		display->deleteWindowFromStack(this);
 	}
 }
 
-void SetTimeWindow::setTimeT(TimeT* time) {
-	this->config_time = time;
-}
-
 
 void SetDS18B20Window::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
 	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 
 	if (!update_timer || millis() - update_timer > SEC_TO_MLS(sensors->getReadDataTime()) ) {
 		update_timer = millis();
@@ -1433,7 +986,7 @@ void SetDS18B20Window::print(LcdManager* lcd, DisplayManager* display, SystemMan
 
 		switch (cursor) {
 		case 3:
-			smartIncr(config_ds18b20->correction, enc->isLeftH() ? -0.1 : 0.1, -20, 20);
+			smartIncr(config_ds18b20->correction, enc->getStep() * 0.1, -20, 20);
 			break;
 		case 4:
 			smartIncr(config_ds18b20->resolution, enc->isLeftH() ? -1 : 1, 9, 12);
@@ -1487,7 +1040,7 @@ void SetDS18B20Window::setDS18B20(ds18b20_data_t* ds18b20) {
 
 void SetDS18B20AddressWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
 	SensorsManager* sensors = system->getSensorsManager();
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 
 	if (scan_flag) {
 		scan_flag = false;
@@ -1566,7 +1119,7 @@ void SetDS18B20AddressWindow::setArray(uint8_t* array) {
 
 
 void SetWifiStationWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
 
 	if (scan_flag) {
 		scan_flag = false;
@@ -1628,14 +1181,9 @@ void SetWifiStationWindow::setString(char* string, uint8_t size) {
 
 
 void KeyboardWindow::print(LcdManager* lcd, DisplayManager* display, SystemManager* system) {
-	Encoder* enc = system->getEncoder();
+	EncoderQueue* enc = system->getEncoder();
+	uint8_t down_code = lcd->loadGlyph(GLYPH_DOWN);
 	string_size_now = strlen(config_string);
-	
-	if (create_symbol_flag) {
-		create_symbol_flag = false;
-
-		lcd->createChar(0, down_symbol);
-	}
 
 	if (print_string_flag || cursor < string_size_now) {
 		print_string_flag = false;
@@ -1657,7 +1205,7 @@ void KeyboardWindow::print(LcdManager* lcd, DisplayManager* display, SystemManag
 			lcd->easyWrite(i, 3, (!caps) ? keyboard1[20 + i] : keyboard2[20 + i]);
 		}		
 	}
-	lcd->easyWrite(key_cursor % 20, 2, (key_cursor < 20) ? '^' : (char)0);
+	lcd->easyWrite(key_cursor % 20, 2, (key_cursor < 20) ? '^' : down_code);
 
 	if (enc->isLeft()) {
 		lcd->easyWrite(key_cursor % 20, 2, ' ');
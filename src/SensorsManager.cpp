@@ -7,25 +7,21 @@
  * Date: 04.02.2025
  */
 
-#include "data.h"
+#include "core.h"
 
 SensorsManager::SensorsManager() {
 	makeDefault();
 }
 
 void SensorsManager::begin() {
-	oneWire.begin(DS18B20_PORT);
-	ds18b20_sensor.setOneWire(&oneWire);
-	
-	ds18b20_sensor.begin();
-	ds18b20_sensor.setResolution(12);
+	halDsBegin(DS18B20_PORT);
 }
 
 
 void SensorsManager::tick() {
 	if (getReadDataTime()) {
-		if (!read_data_timer || millis() - read_data_timer >= SEC_TO_MLS(getReadDataTime())) {
-			read_data_timer = millis();
+		if (!read_data_timer || halMillis() - read_data_timer >= SEC_TO_MLS(getReadDataTime())) {
+			read_data_timer = halMillis();
 			updateSensorsData();
 		}
 	}
@@ -41,10 +37,22 @@ void SensorsManager::makeDefault() {
 
 	read_data_time = DEFAULT_READ_DATA_TIME;
 	read_data_timer = 0;
+	read_count = 0;
+
+	filter_median = DEFAULT_FILTER_MEDIAN;
+	filter_rate = DEFAULT_FILTER_RATE;
+	filter_stuck_time = DEFAULT_FILTER_STUCK_TIME;
+	filter_range_min = DEFAULT_FILTER_RANGE_MIN;
+	filter_range_max = DEFAULT_FILTER_RANGE_MAX;
 }
 
 void SensorsManager::writeSettings(char* buffer) {
 	setParameter(buffer, "SSrdt", getReadDataTime());
+	setParameter(buffer, "SSfm", getFilterMedian());
+	setParameter(buffer, "SSfr", getFilterRate());
+	setParameter(buffer, "SSfs", getFilterStuckTime());
+	setParameter(buffer, "SSfl", getFilterRangeMin());
+	setParameter(buffer, "SSfh", getFilterRangeMax());
 
 	for (uint8_t i = 0;i < getDS18B20Count();i++) {
 		setParameter(buffer, String("SSDSn") + i, (const char*) getDS18B20Name(i));
@@ -59,6 +67,11 @@ void SensorsManager::readSettings(char* buffer) {
 	char ds18b20_name[DS_NAME_SIZE];
 
 	getParameter(buffer, "SSrdt", &read_data_time);
+	getParameter(buffer, "SSfm", &filter_median);
+	getParameter(buffer, "SSfr", &filter_rate);
+	getParameter(buffer, "SSfs", &filter_stuck_time);
+	getParameter(buffer, "SSfl", &filter_range_min);
+	getParameter(buffer, "SSfh", &filter_range_max);
 	
 	while (getParameter(buffer, String("SSDSn") + ds18b20_index, ds18b20_name, DS_NAME_SIZE)) {
 		if (addDS18B20()) {
@@ -85,63 +98,21 @@ void SensorsManager::readSettings(char* buffer) {
 	}
 
 	setReadDataTime(read_data_time);
+	setFilterMedian(filter_median);
+	setFilterRate(filter_rate);
+	setFilterStuckTime(filter_stuck_time);
+	setFilterRange(filter_range_min, filter_range_max);
 }
 
-#ifdef MODULE_MANAGER_BLYNK_SUPPORT
-void SensorsManager::addBlynkElementCodes(DynamicArray<String>* array) {
-	if (array == NULL) {
-		return;
-	}
-
-	array->add(String("HSt"));
-	array->add(String("HSh"));
-
-	for (uint8_t i = 0; i < ds18b20_data.size();i++) {
-		array->add(String("HSdst") + getDS18B20Name(i));
-	}
-}
-
-bool SensorsManager::blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link) {
-	if (Blynk == NULL || link == NULL) {
-		return false;
-	}
-
-	if (!strcmp(link->element_code, "HSt")) {
-		Blynk->virtualWrite(link->port, getAM2320T());
-		return true;
-	}
-	
-	if (!strcmp(link->element_code, "HSh")) {
-		Blynk->virtualWrite(link->port, getAM2320H());
-		return true;
-	}
-
-	for (uint8_t i = 0;i < getDS18B20Count();i++) {
-		if (!getDS18B20Status(i)) {
-			char element_code[BLYNK_ELEMENT_CODE_SIZE] = "HSdst";
-			strcat(element_code, getDS18B20Name(i));
-
-			if (!strcmp(link->element_code, element_code)) {
-				Blynk->virtualWrite(link->port, getDS18B20T(i));
-				return true;
-			}
-		}
-	}
-
-	return false;
-}
-
-bool SensorsManager::blynkElementParse(String code, const BlynkParam& param) {
-	return false;
-}
-#endif
-
 
 bool SensorsManager::addDS18B20() {
 	if (ds18b20_data.add()) {
 		setDS18B20Name(ds18b20_data.size() - 1, DEFAULT_DS18B20_NAME);
 		setDS18B20Resolution(ds18b20_data.size() - 1, DEFAULT_DS18B20_RESOLUTION);
 		ds18b20_data[ds18b20_data.size() - 1].status = UNSPECIFIED_STATUS;
+		ds18b20_data[ds18b20_data.size() - 1].history_head = 0;
+		ds18b20_data[ds18b20_data.size() - 1].history_count = 0;
+		resetDS18B20Filter(ds18b20_data.size() - 1);
 
 		return true;
 	}
@@ -166,23 +137,19 @@ bool SensorsManager::deleteDS18B20(uint8_t index) {
 }
 
 void SensorsManager::updateSensorsData() {
-	am2320_data.status = am2320_sensor.read(&am2320_data.t, &am2320_data.h);
-	ds18b20_sensor.requestTemperatures();
+	am2320_data.status = halAm2320Read(&am2320_data.t, &am2320_data.h);
+	am2320_data.t_centi = floatToCenti(am2320_data.t);
+	am2320_data.h_centi = floatToCenti(am2320_data.h);
+	halDsRequest();
 
 	for (uint8_t i = 0;i < getDS18B20Count();i++) {
-		ds18b20_data[i].t = ds18b20_sensor.getTempC(getDS18B20Address(i));
+		filterDS18B20(i, halDsRaw(getDS18B20Address(i)));
 
-		if (getDS18B20T(i) < -100) {
-			ds18b20_data[i].status = 1;
-		}
-		else if (getDS18B20T(i) == 85) {
-			ds18b20_data[i].status = 2;
-		}
-		else {
-			ds18b20_data[i].status = 0;
-			ds18b20_data[i].t += getDS18B20Correction(i);
-		}
+		ds18b20_data[i].t = ds18b20_data[i].t_centi * 0.01f;
+		addDS18B20History(i);
 	}
+
+	read_count++;
 }
 
 
@@ -196,7 +163,7 @@ uint8_t SensorsManager::makeDS18B20AddressList(DynamicArray<DeviceAddress>* arra
 
 	if (t_array != NULL) {
 		t_array->clear();
-		ds18b20_sensor.requestTemperatures();
+		halDsRequest();
 	}
 
 	if (string_array != NULL) {
@@ -210,11 +177,11 @@ uint8_t SensorsManager::makeDS18B20AddressList(DynamicArray<DeviceAddress>* arra
 	for (uint8_t i = 0;i < sensors_count;i++) {
 		DeviceAddress address;
 
-		ds18b20_sensor.getAddress(address, i);
+		halDsAddress(i, address);
 		array->add(&address);
 
 		if (t_array != NULL) {
-			t_array->add(ds18b20_sensor.getTempC(address));
+			t_array->add(DS18B20RawToC(halDsRaw(address)));
 		}
 
 		if (string_array != NULL) {
@@ -243,12 +210,35 @@ int8_t SensorsManager::scanDS18B20AddressIndex(DynamicArray<DeviceAddress>* arra
 }
 
 
-void SensorsManager::setSystemManager(SystemManager* system) {
+void SensorsManager::setSystemManager(CoreManager* system) {
 	this->system = system;
 }
 
 void SensorsManager::setReadDataTime(uint8_t time) {
 	read_data_time = constrain(time, 0, 100);
+
+	// the trend and the rate limit expect one sample per read_data_time
+	for (uint8_t i = 0;i < getDS18B20Count();i++) {
+		resetDS18B20Window(i);
+	}
+}
+
+void SensorsManager::setFilterMedian(uint8_t median) {
+	// even windows have no middle
+	filter_median = constrain(median | 1, 1, DS_MEDIAN_MAX);
+}
+
+void SensorsManager::setFilterRate(uint8_t rate) {
+	filter_rate = constrain(rate, 0, DS_FILTER_RATE_MAX);
+}
+
+void SensorsManager::setFilterStuckTime(uint8_t time) {
+	filter_stuck_time = constrain(time, 0, DS_FILTER_STUCK_TIME_MAX);
+}
+
+void SensorsManager::setFilterRange(int8_t range_min, int8_t range_max) {
+	filter_range_min = constrain(range_min, -55, 125);
+	filter_range_max = constrain(range_max, filter_range_min, 125);
 }
 
 
@@ -278,6 +268,7 @@ void SensorsManager::setDS18B20Address(uint8_t index, uint8_t* address) {
 
 	memcpy(ds18b20_data[index].address, address, 8);
 	setDS18B20Resolution(index, getDS18B20Resolution(index, false));
+	resetDS18B20Filter(index);
 }
 
 void SensorsManager::setDS18B20Resolution(uint8_t index, uint8_t resolution) {
@@ -286,8 +277,8 @@ void SensorsManager::setDS18B20Resolution(uint8_t index, uint8_t resolution) {
 	}
 
 	if (*getDS18B20Address(index)) {
-		ds18b20_sensor.setResolution(getDS18B20Address(index), resolution);
-		ds18b20_data[index].resolution = ds18b20_sensor.getResolution(getDS18B20Address(index));
+		halDsSetResolution(getDS18B20Address(index), resolution);
+		ds18b20_data[index].resolution = halDsResolution(getDS18B20Address(index));
 	}
 	else {
 		ds18b20_data[index].resolution = resolution;
@@ -303,14 +294,35 @@ void SensorsManager::setDS18B20Correction(uint8_t index, float correction) {
 }
 
 
-DallasTemperature* SensorsManager::getDallasTemperature() {
-	return &ds18b20_sensor;
-}
-
 uint8_t SensorsManager::getReadDataTime() {
 	return read_data_time;
 }
 
+// grows by one with every read, so others see a fresh reading without a callback
+uint16_t SensorsManager::getReadCount() {
+	return read_count;
+}
+
+uint8_t SensorsManager::getFilterMedian() {
+	return filter_median;
+}
+
+uint8_t SensorsManager::getFilterRate() {
+	return filter_rate;
+}
+
+uint8_t SensorsManager::getFilterStuckTime() {
+	return filter_stuck_time;
+}
+
+int8_t SensorsManager::getFilterRangeMin() {
+	return filter_range_min;
+}
+
+int8_t SensorsManager::getFilterRangeMax() {
+	return filter_range_max;
+}
+
 
 float SensorsManager::getAM2320T() {
 	return am2320_data.t;
@@ -320,19 +332,26 @@ float SensorsManager::getAM2320H() {
 	return am2320_data.h;
 }
 
+int16_t SensorsManager::getAM2320TCenti() {
+	return am2320_data.t_centi;
+}
+
+int16_t SensorsManager::getAM2320HCenti() {
+	return am2320_data.h_centi;
+}
+
 uint8_t SensorsManager::getAM2320Status() {
 	return am2320_data.status;
 }
 
 
 uint8_t SensorsManager::getGlobalDS18B20Count() {
-	ds18b20_sensor.begin();
-	return ds18b20_sensor.getDS18Count();
+	return halDsScan();
 }
 
 float SensorsManager::getDS18B20TByAddress(uint8_t* address) {
-	ds18b20_sensor.requestTemperaturesByAddress(address);
-	return ds18b20_sensor.getTempC(address);
+	halDsRequest();
+	return DS18B20RawToC(halDsRaw(address));
 }
 
 uint8_t SensorsManager::getDS18B20Count() {
@@ -369,7 +388,7 @@ uint8_t SensorsManager::getDS18B20Resolution(uint8_t index, bool sync_flag) {
 	}
 
 	if (*getDS18B20Address(index) && sync_flag) {
-		ds18b20_data[index].resolution = ds18b20_sensor.getResolution(getDS18B20Address(index));
+		ds18b20_data[index].resolution = halDsResolution(getDS18B20Address(index));
 	}
 
 	return ds18b20_data[index].resolution;
@@ -391,6 +410,14 @@ float SensorsManager::getDS18B20T(uint8_t index) {
 	return ds18b20_data[index].t;
 }
 
+int16_t SensorsManager::getDS18B20TCenti(uint8_t index) {
+	if (!isCorrectDS18B20Index(index)) {
+		return 0;
+	}
+
+	return ds18b20_data[index].t_centi;
+}
+
 uint8_t SensorsManager::getDS18B20Status(uint8_t index) {
 	if (!isCorrectDS18B20Index(index)) {
 		return UNSPECIFIED_STATUS;
@@ -399,6 +426,49 @@ uint8_t SensorsManager::getDS18B20Status(uint8_t index) {
 	return ds18b20_data[index].status;
 }
 
+uint8_t SensorsManager::getDS18B20Health(uint8_t index) {
+	if (!isCorrectDS18B20Index(index)) {
+		return DS_HEALTH_FAULT;
+	}
+
+	return ds18b20_data[index].health;
+}
+
+
+// °C per minute, least squares over the history
+bool SensorsManager::getDS18B20Trend(uint8_t index, float* trend) {
+	if (!isCorrectDS18B20Index(index) || !getReadDataTime()) {
+		return false;
+	}
+
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+	uint8_t count = ds18b20->history_count;
+
+	if (count < DS_TREND_MIN_COUNT) {
+		return false;
+	}
+
+	float x_mean = (count - 1) / 2.0f;
+	float y_mean = 0;
+	float xy = 0;
+	float xx = 0;
+
+	for (uint8_t i = 0;i < count;i++) {
+		y_mean += ds18b20->history[(ds18b20->history_head + DS_HISTORY_SIZE - count + i) % DS_HISTORY_SIZE];
+	}
+	y_mean /= count;
+
+	for (uint8_t i = 0;i < count;i++) {
+		float y = ds18b20->history[(ds18b20->history_head + DS_HISTORY_SIZE - count + i) % DS_HISTORY_SIZE];
+
+		xy += (i - x_mean) * (y - y_mean);
+		xx += (i - x_mean) * (i - x_mean);
+	}
+
+	*trend = xy / xx * 0.01f * 60 / getReadDataTime();
+	return true;
+}
+
 
 bool SensorsManager::isCorrectDS18B20Index(uint8_t index) {
 	if (index >= getDS18B20Count()) {
@@ -420,4 +490,126 @@ void SensorsManager::DS18B20AddressToString(uint8_t* address, String* string) {
 			*string += "-";
 		}
 	}
+}
+
+void SensorsManager::addDS18B20History(uint8_t index) {
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+
+	// a bad reading would bend the line, the trend starts over
+	if (ds18b20->status) {
+		ds18b20->history_count = 0;
+		return;
+	}
+
+	// the held value is not a new sample
+	if (ds18b20->health == DS_HEALTH_SUSPECT) {
+		return;
+	}
+
+	ds18b20->history[ds18b20->history_head] = ds18b20->t_centi;
+	ds18b20->history_head = (ds18b20->history_head + 1) % DS_HISTORY_SIZE;
+	ds18b20->history_count = min((uint8_t) (ds18b20->history_count + 1), (uint8_t) DS_HISTORY_SIZE);
+}
+
+// 0 - ok, 1 - disconnected, 2 - power on 85 °C, 3 - out of range, 4 - stuck
+void SensorsManager::filterDS18B20(uint8_t index, int16_t raw) {
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+	bool good_flag = !ds18b20->status;
+
+	if (raw != ds18b20->stuck_raw) {
+		ds18b20->stuck_raw = raw;
+		ds18b20->stuck_timer = halMillis();
+	}
+
+	if (raw <= HAL_DS_DISCONNECTED_RAW) {
+		ds18b20->status = 1;
+		ds18b20->t_centi = HAL_DS_DISCONNECTED_C * 100;
+	}
+	else if (raw == DS18B20_POWER_ON_RAW) {
+		ds18b20->status = 2;
+		ds18b20->t_centi = rawToCenti(raw);
+	}
+	else {
+		int16_t centi = rawToCenti(raw) + floatToCenti(getDS18B20Correction(index));
+
+		if (centi < getFilterRangeMin() * 100 || centi > getFilterRangeMax() * 100) {
+			ds18b20->status = 3;
+			ds18b20->t_centi = centi;
+		}
+		else if (getFilterStuckTime() && halMillis() - ds18b20->stuck_timer >= MIN_TO_MLS(getFilterStuckTime())) {
+			ds18b20->status = 4;
+		}
+		else {
+			ds18b20->window[ds18b20->window_head] = centi;
+			ds18b20->window_head = (ds18b20->window_head + 1) % DS_MEDIAN_MAX;
+			ds18b20->window_count = min((uint8_t) (ds18b20->window_count + 1), (uint8_t) DS_MEDIAN_MAX);
+
+			int16_t median = makeDS18B20Median(index);
+			int32_t step_max = (int32_t) getFilterRate() * 100 * max(getReadDataTime(), (uint8_t) 1) / 60;
+
+			ds18b20->status = 0;
+
+			if (good_flag && getFilterRate() && abs(median - ds18b20->t_centi) > step_max && ++ds18b20->reject_count < DS_REJECT_MAX_COUNT) {
+				ds18b20->health = DS_HEALTH_SUSPECT;
+				return;
+			}
+
+			ds18b20->reject_count = 0;
+			ds18b20->t_centi = median;
+			ds18b20->health = DS_HEALTH_OK;
+
+			return;
+		}
+	}
+
+	// the next good reading starts a fresh window
+	ds18b20->window_count = 0;
+	ds18b20->reject_count = 0;
+	ds18b20->health = DS_HEALTH_FAULT;
+}
+
+// a new sensor: nothing is known about it until the first good reading
+void SensorsManager::resetDS18B20Filter(uint8_t index) {
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+
+	resetDS18B20Window(index);
+	ds18b20->stuck_raw = HAL_DS_DISCONNECTED_RAW;
+	ds18b20->stuck_timer = halMillis();
+	ds18b20->health = DS_HEALTH_FAULT;
+}
+
+// the same sensor read at another pace: the samples start over, the value and the health stay
+void SensorsManager::resetDS18B20Window(uint8_t index) {
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+
+	ds18b20->window_head = 0;
+	ds18b20->window_count = 0;
+	ds18b20->reject_count = 0;
+	ds18b20->history_count = 0;
+}
+
+int16_t SensorsManager::makeDS18B20Median(uint8_t index) {
+	ds18b20_data_t* ds18b20 = &ds18b20_data[index];
+	uint8_t count = min(ds18b20->window_count, getFilterMedian());
+	int16_t sorted[DS_MEDIAN_MAX];
+
+	for (uint8_t i = 0;i < count;i++) {
+		int16_t value = ds18b20->window[(ds18b20->window_head + DS_MEDIAN_MAX - 1 - i) % DS_MEDIAN_MAX];
+		int8_t j = i - 1;
+
+		for (;j >= 0 && sorted[j] > value;j--) {
+			sorted[j + 1] = sorted[j];
+		}
+		sorted[j + 1] = value;
+	}
+
+	return sorted[count / 2];
+}
+
+float SensorsManager::DS18B20RawToC(int16_t raw) {
+	if (raw <= HAL_DS_DISCONNECTED_RAW) {
+		return HAL_DS_DISCONNECTED_C;
+	}
+
+	return rawToCenti(raw) * 0.01f;
 }
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "core.h"
+
+void SolarController::reset(solar_loop_t* loop) {
+	loop->output = 0;
+}
+
+
+bool BangBangController::tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now) {
+	bool rele_flag = loop->rele_flag;
+
+	if (delta_now >= loop->delta) {
+		rele_flag = true;
+	}
+	else if (delta_now <= loop->delta - SOLAR_BANG_BANG_HYSTERESIS) {
+		rele_flag = false;
+	}
+
+	loop->output = rele_flag ? 100 : 0;
+	return rele_flag;
+}
+
+
+bool HysteresisController::tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now) {
+	bool rele_flag = loop->rele_flag;
+	uint32_t dwell_time = halMillis() - loop->rele_switch_timer;
+
+	if (!rele_flag && delta_now >= loop->delta && dwell_time >= SEC_TO_MLS(solar->getMinOffTime())) {
+		rele_flag = true;
+	}
+	else if (rele_flag && delta_now <= loop->delta - loop->hysteresis && dwell_time >= SEC_TO_MLS(solar->getMinOnTime())) {
+		rele_flag = false;
+	}
+
+	loop->output = rele_flag ? 100 : 0;
+	return rele_flag;
+}
+
+
+void PidController::reset(solar_loop_t* loop) {
+	SolarController::reset(loop);
+	memset(&loop->pid, 0, sizeof(solar_pid_t));
+}
+
+bool PidController::tick(SolarSystemManager* solar, solar_loop_t* loop, float delta_now) {
+	solar_pid_t* pid = &loop->pid;
+	uint32_t now = halMillis();
+
+	if (!pid->update_timer || now - pid->update_timer >= SOLAR_PID_TIME) {
+		float dt = pid->update_timer ? (now - pid->update_timer) / 60000.0f : 0; // min
+		float error = delta_now - loop->delta;
+		float result = solar->getPidKp() * error + pid->integral;
+
+		if (dt > 0) {
+			float integral_step = solar->getPidKi() * error * dt;
+
+			result += solar->getPidKd() * (error - pid->last_error) / dt;
+
+			// no windup: the integral only moves the output back from a limit
+			if ((result < 100 || integral_step < 0) && (result > 0 || integral_step > 0)) {
+				pid->integral = constrain(pid->integral + integral_step, -100.0f, 100.0f);
+				result += integral_step;
+			}
+		}
+
+		loop->output = constrain(result, 0.0f, 100.0f);
+		pid->last_error = error;
+		pid->update_timer = now ? now : 1;
+	}
+
+	// the on time is fixed for the whole window, pulses shorter than the dwell times are dropped
+	uint32_t window = SEC_TO_MLS((uint32_t) solar->getPidWindow());
+
+	if (!pid->window_timer || now - pid->window_timer >= window) {
+		pid->on_time = window / 100 * loop->output;
+
+		if (pid->on_time < SEC_TO_MLS((uint32_t) solar->getMinOnTime())) {
+			pid->on_time = 0;
+		}
+		else if (window - pid->on_time < SEC_TO_MLS((uint32_t) solar->getMinOffTime())) {
+			pid->on_time = window;
+		}
+
+		pid->window_timer = now ? now : 1;
+	}
+
+	return now - pid->window_timer < pid->on_time;
+}
@@ -7,41 +7,38 @@
  * Date: 04.02.2025
  */
 
-#include "data.h"
+#include "core.h"
 
 SolarSystemManager::SolarSystemManager() {
 	makeDefault();
 }
 
 void SolarSystemManager::begin() {
-	pinMode(RELE_PORT, OUTPUT);
-	setReleFlag(false);
+	for (uint8_t i = 0;i < getLoopsCount();i++) {
+		halPinMode(loops[i].pin, OUTPUT);
+		setLoopReleFlag(i, false, RELE_REASON_SYSTEM);
+	}
+
+	journal.begin();
+	watchdog.begin();
+	energy.begin();
 }
 
 
+// every loop is decided in the same pass
 void SolarSystemManager::tick() {
 	releTick();
+	journal.tick();
+	watchdog.tick();
+	energyTick();
 
-	if (!work_flag) {
-		return;
-	}
-	
-	if (getStatus()) {
-		if (getErrorOnFlag()) {
-			setReleFlag(true);
+	if (work_flag) {
+		for (uint8_t i = 0;i < getLoopsCount();i++) {
+			loopTick(i);
 		}
-		
-		return;
 	}
 
-	float delta_now = getBatteryT() - getBoilerT();
-
-	if (delta_now >= delta) {
-		setReleFlag(true);
-	}
-	else if (delta_now <= delta - 2) {
-		setReleFlag(false);
-	}
+	watchdogFeed();
 }
 
 void SolarSystemManager::makeDefault() {
@@ -49,14 +46,25 @@ void SolarSystemManager::makeDefault() {
 
 	work_flag = DEFAULT_SOLAR_WORK_FLAG;
 	error_on_flag = DEFAULT_SOLAR_ERROR_ON_FLAG;
-	rele_invert_flag = DEFAULT_SOLAR_RELE_INVERT_FLAG;
-	delta = DEFAULT_SOLAR_DELTA;
+	min_on_time = DEFAULT_SOLAR_MIN_ON_TIME;
+	min_off_time = DEFAULT_SOLAR_MIN_OFF_TIME;
+	pid_kp = DEFAULT_SOLAR_PID_KP;
+	pid_ki = DEFAULT_SOLAR_PID_KI;
+	pid_kd = DEFAULT_SOLAR_PID_KD;
+	pid_window = DEFAULT_SOLAR_PID_WINDOW;
+	predict_flag = DEFAULT_SOLAR_PREDICT_FLAG;
+	predict_time = DEFAULT_SOLAR_PREDICT_TIME;
+	fluid_cp = DEFAULT_SOLAR_FLUID_CP;
 
-	battery_sensor_index = -1;
-	boiler_sensor_index = -1;
 	exit_sensor_index = -1;
+	energy_read_count = 0;
+	energy_timer = 0;
 
-	rele_flag = false;
+	loops.clear();
+	loops.setMaxSize(SOLAR_LOOPS_MAX);
+	addLoop();
+
+	loops[SOLAR_MAIN_LOOP].invert_flag = DEFAULT_SOLAR_RELE_INVERT_FLAG;
 }
 
 void SolarSystemManager::writeSettings(char* buffer) {
@@ -64,16 +72,61 @@ void SolarSystemManager::writeSettings(char* buffer) {
 	setParameter(buffer, "SSSeo", getErrorOnFlag());
 	setParameter(buffer, "SSSri", getReleInvertFlag());
 	setParameter(buffer, "SSSd", getDelta());
+	setParameter(buffer, "SSSm", getMode());
+	setParameter(buffer, "SSSh", getHysteresis());
+	setParameter(buffer, "SSSon", getMinOnTime());
+	setParameter(buffer, "SSSof", getMinOffTime());
+	setParameter(buffer, "SSSkp", getPidKp());
+	setParameter(buffer, "SSSki", getPidKi());
+	setParameter(buffer, "SSSkd", getPidKd());
+	setParameter(buffer, "SSSpw", getPidWindow());
+	setParameter(buffer, "SSSpr", getPredictFlag());
+	setParameter(buffer, "SSSpt", getPredictTime());
+	setParameter(buffer, "SSScp", getFluidCp());
+	setParameter(buffer, "SSSfl", loops[SOLAR_MAIN_LOOP].flow);
 	setParameter(buffer, "SSSba", getBatterySensor());
 	setParameter(buffer, "SSSbo", getBoilerSensor());
 	setParameter(buffer, "SSSex", getExitSensor());
+
+	// the main loop is kept in the keys above, the others take one packed key each
+	for (uint8_t i = SOLAR_MAIN_LOOP + 1;i < getLoopsCount();i++) {
+		uint8_t loop_settings[SOLAR_LOOP_SETTINGS_SIZE] = {
+			(uint8_t) loops[i].source, (uint8_t) loops[i].sink, loops[i].delta, loops[i].hysteresis,
+			loops[i].mode, loops[i].pin, loops[i].invert_flag
+		};
+
+		setParameter(buffer, String("SSSL") + i, loop_settings, SOLAR_LOOP_SETTINGS_SIZE);
+		setParameter(buffer, String("SSSLf") + i, loops[i].flow);
+	}
 }
 
 void SolarSystemManager::readSettings(char* buffer) {
+	uint8_t loop_index = SOLAR_MAIN_LOOP + 1;
+	uint8_t loop_settings[SOLAR_LOOP_SETTINGS_SIZE];
+	bool rele_invert_flag = getReleInvertFlag();
+	uint8_t delta = getDelta();
+	uint8_t mode = getMode();
+	uint8_t hysteresis = getHysteresis();
+	int8_t battery_sensor_index = getBatterySensor();
+	int8_t boiler_sensor_index = getBoilerSensor();
+	uint8_t flow = loops[SOLAR_MAIN_LOOP].flow;
+
 	getParameter(buffer, "SSSs", &work_flag);
 	getParameter(buffer, "SSSeo", &error_on_flag);
 	getParameter(buffer, "SSSri", &rele_invert_flag);
 	getParameter(buffer, "SSSd", &delta);
+	getParameter(buffer, "SSSm", &mode);
+	getParameter(buffer, "SSSh", &hysteresis);
+	getParameter(buffer, "SSSon", &min_on_time);
+	getParameter(buffer, "SSSof", &min_off_time);
+	getParameter(buffer, "SSSkp", &pid_kp);
+	getParameter(buffer, "SSSki", &pid_ki);
+	getParameter(buffer, "SSSkd", &pid_kd);
+	getParameter(buffer, "SSSpw", &pid_window);
+	getParameter(buffer, "SSSpr", &predict_flag);
+	getParameter(buffer, "SSSpt", &predict_time);
+	getParameter(buffer, "SSScp", &fluid_cp);
+	getParameter(buffer, "SSSfl", &flow);
 	getParameter(buffer, "SSSba", &battery_sensor_index);
 	getParameter(buffer, "SSSbo", &boiler_sensor_index);
 	getParameter(buffer, "SSSex", &exit_sensor_index);
@@ -82,84 +135,294 @@ void SolarSystemManager::readSettings(char* buffer) {
 	setErrorOnFlag(error_on_flag);
 	setReleInvertFlag(rele_invert_flag);
 	setDelta(delta);
+	setMode(mode);
+	setHysteresis(hysteresis);
+	setMinOnTime(min_on_time);
+	setMinOffTime(min_off_time);
+	setPidKp(pid_kp);
+	setPidKi(pid_ki);
+	setPidKd(pid_kd);
+	setPidWindow(pid_window);
+	setPredictFlag(predict_flag);
+	setPredictTime(predict_time);
+	setFluidCp(fluid_cp);
+	setLoopFlow(SOLAR_MAIN_LOOP, flow);
 	setBatterySensor(battery_sensor_index);
 	setBoilerSensor(boiler_sensor_index);
 	setExitSensor(exit_sensor_index);
-}
 
-#ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
-void SolarSystemManager::addBlynkElementCodes(DynamicArray<String>* array) {
-	if (array == NULL) {
-		return;
+	while (getParameter(buffer, String("SSSL") + loop_index, loop_settings, SOLAR_LOOP_SETTINGS_SIZE)) {
+		if (addLoop()) {
+			uint8_t index = getLoopsCount() - 1;
+
+			setLoopSource(index, (int8_t) loop_settings[0]);
+			setLoopSink(index, (int8_t) loop_settings[1]);
+			setLoopDelta(index, loop_settings[2]);
+			setLoopHysteresis(index, loop_settings[3]);
+			setLoopMode(index, loop_settings[4]);
+			setLoopPin(index, loop_settings[5]);
+			setLoopInvertFlag(index, loop_settings[6]);
+
+			if (getParameter(buffer, String("SSSLf") + loop_index, &flow)) {
+				setLoopFlow(index, flow);
+			}
+		}
+
+		loop_index++;
 	}
+}
+
 
-	array->add(String("SSSs"));
-	array->add(String("HSSpu"));
+void SolarSystemManager::setSystemManager(CoreManager* system) {
+	this->system = system;
 }
 
-bool SolarSystemManager::blynkElementSend(BlynkWifi* Blynk, blynk_link_t* link) {
-	if (Blynk == NULL || link == NULL) {
-		return false;
+
+void SolarSystemManager::setReleFlag(bool rele_flag, uint8_t reason) {
+	setLoopReleFlag(SOLAR_MAIN_LOOP, rele_flag, reason);
+}
+
+void SolarSystemManager::setWorkFlag(bool work_flag) {
+	this->work_flag = work_flag;
+	tick();
+}
+
+void SolarSystemManager::setErrorOnFlag(bool error_on_flag) {
+	this->error_on_flag = error_on_flag;
+	tick();
+}
+
+void SolarSystemManager::setReleInvertFlag(bool rele_invert_flag) {
+	setLoopInvertFlag(SOLAR_MAIN_LOOP, rele_invert_flag);
+}
+
+void SolarSystemManager::setDelta(uint8_t delta) {
+	setLoopDelta(SOLAR_MAIN_LOOP, delta);
+}
+
+void SolarSystemManager::setMode(uint8_t mode) {
+	setLoopMode(SOLAR_MAIN_LOOP, mode);
+}
+
+void SolarSystemManager::setHysteresis(uint8_t hysteresis) {
+	setLoopHysteresis(SOLAR_MAIN_LOOP, hysteresis);
+}
+
+void SolarSystemManager::setMinOnTime(uint16_t time) {
+	min_on_time = constrain(time, 0, SOLAR_DWELL_TIME_MAX);
+}
+
+void SolarSystemManager::setMinOffTime(uint16_t time) {
+	min_off_time = constrain(time, 0, SOLAR_DWELL_TIME_MAX);
+}
+
+void SolarSystemManager::setPidKp(float kp) {
+	pid_kp = constrain(kp, 0.0f, (float) SOLAR_PID_GAIN_MAX);
+}
+
+void SolarSystemManager::setPidKi(float ki) {
+	pid_ki = constrain(ki, 0.0f, (float) SOLAR_PID_GAIN_MAX);
+}
+
+void SolarSystemManager::setPidKd(float kd) {
+	pid_kd = constrain(kd, 0.0f, (float) SOLAR_PID_GAIN_MAX);
+}
+
+void SolarSystemManager::setPidWindow(uint16_t window) {
+	pid_window = constrain(window, SOLAR_PID_WINDOW_MIN, SOLAR_PID_WINDOW_MAX);
+}
+
+void SolarSystemManager::setPredictFlag(bool predict_flag) {
+	this->predict_flag = predict_flag;
+}
+
+void SolarSystemManager::setPredictTime(uint8_t time) {
+	predict_time = constrain(time, 1, SOLAR_PREDICT_TIME_MAX);
+}
+
+void SolarSystemManager::setFluidCp(uint16_t cp) {
+	fluid_cp = constrain(cp, SOLAR_FLUID_CP_MIN, SOLAR_FLUID_CP_MAX);
+}
+
+
+bool SolarSystemManager::addLoop() {
+	uint8_t pin = RELE_PORT;
+
+	// the main loop stays on RELE_PORT, the others take the first free port
+	if (getLoopsCount() != SOLAR_MAIN_LOOP) {
+		int8_t port_index = 0;
+
+		while (port_index < LOOP_PORTS_COUNT && !isFreeLoopPin(loop_ports[port_index], getLoopsCount())) {
+			port_index++;
+		}
+
+		if (port_index >= LOOP_PORTS_COUNT) {
+			return false;
+		}
+
+		pin = loop_ports[port_index];
 	}
 
-	if (!strcmp(link->element_code, "SSSs")) {
-		Blynk->virtualWrite(link->port, getWorkFlag());
-		return true;
+	if (!loops.add()) {
+		return false;
 	}
-	
-	if (!strcmp(link->element_code, "HSSpu")) {
-		Blynk->virtualWrite(link->port, getReleFlag());
-		return true;
+
+	solar_loop_t* loop = &loops[loops.size() - 1];
+
+	loop->source = -1;
+	loop->sink = -1;
+	loop->delta = DEFAULT_SOLAR_DELTA;
+	loop->hysteresis = DEFAULT_SOLAR_HYSTERESIS;
+	loop->mode = DEFAULT_SOLAR_MODE;
+	loop->pin = pin;
+	loop->invert_flag = false;
+	loop->flow = DEFAULT_SOLAR_FLOW;
+
+	loop->rele_flag = false;
+	loop->rele_switch_timer = 0;
+	getController(loop->mode)->reset(loop);
+
+	// the main loop pin is set up in begin()
+	if (loops.size() - 1 != SOLAR_MAIN_LOOP) {
+		halPinMode(loop->pin, OUTPUT);
 	}
 
-	return false;
+	return true;
 }
 
-bool SolarSystemManager::blynkElementParse(String code, const BlynkParam& param) {
-	if (!strcmp(code.c_str(), "SSSs")) {
-		setWorkFlag(param.asInt());
-		return true;
+bool SolarSystemManager::deleteLoop(uint8_t index) {
+	if (!isCorrectLoopIndex(index) || index == SOLAR_MAIN_LOOP) {
+		return false;
 	}
-	
-	if (!strcmp(code.c_str(), "HSSpu")) {
-		setReleFlag(param.asInt());
-		return true;
+
+	setLoopReleFlag(index, false, RELE_REASON_SYSTEM);
+
+	if (!loops.del(index)) {
+		return false;
 	}
 
-	return false;
+	journal.deleteLoop(index);
+	return true;
 }
-#endif
 
+void SolarSystemManager::setLoopReleFlag(uint8_t index, bool rele_flag, uint8_t reason) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	if (rele_flag != loops[index].rele_flag) {
+		SensorsManager* sensors = system->getSensorsManager();
+		uint32_t unix = system->getTimeManager()->getUnix();
+		rele_event_t event = {
+			(unix < TIME_MIN_UNIX) ? 0 : unix,
+			sensors->getDS18B20TCenti(loops[index].source), sensors->getDS18B20TCenti(loops[index].sink),
+			index, reason, rele_flag
+		};
+
+		journal.push(&event);
+		loops[index].rele_switch_timer = halMillis();
+	}
 
-void SolarSystemManager::setSystemManager(SystemManager* system) {
-	this->system = system;
+	loops[index].rele_flag = rele_flag;
+	releTick();
 }
 
+void SolarSystemManager::setLoopSource(uint8_t index, int8_t ds18b20_index) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
 
-void SolarSystemManager::setReleFlag(bool rele_flag) {
-	this->rele_flag = rele_flag;
-	releTick();
+	loops[index].source = makeSensorIndex(ds18b20_index);
+	tick();
 }
 
-void SolarSystemManager::setWorkFlag(bool work_flag) {
-	this->work_flag = work_flag;
+void SolarSystemManager::setLoopSink(uint8_t index, int8_t ds18b20_index) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	loops[index].sink = makeSensorIndex(ds18b20_index);
 	tick();
 }
 
-void SolarSystemManager::setErrorOnFlag(bool error_on_flag) {
-	this->error_on_flag = error_on_flag;
+void SolarSystemManager::setLoopDelta(uint8_t index, uint8_t delta) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	loops[index].delta = constrain(delta, SOLAR_DELTA_MIN, SOLAR_DELTA_MAX);
 	tick();
 }
 
-void SolarSystemManager::setReleInvertFlag(bool rele_invert_flag) {
-	this->rele_invert_flag = rele_invert_flag;
+void SolarSystemManager::setLoopHysteresis(uint8_t index, uint8_t hysteresis) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	loops[index].hysteresis = constrain(hysteresis, SOLAR_HYSTERESIS_MIN, SOLAR_HYSTERESIS_MAX);
 }
 
-void SolarSystemManager::setDelta(uint8_t delta) {
-	this->delta = constrain(delta, SOLAR_DELTA_MIN, SOLAR_DELTA_MAX);
+void SolarSystemManager::setLoopMode(uint8_t index, uint8_t mode) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	mode = constrain(mode, SOLAR_MODE_BANG_BANG, SOLAR_MODE_PID);
+
+	if (mode != loops[index].mode) {
+		loops[index].mode = mode;
+		getController(mode)->reset(&loops[index]);
+	}
+
 	tick();
 }
 
+void SolarSystemManager::setLoopPin(uint8_t index, uint8_t pin) {
+	// the main loop stays on RELE_PORT
+	if (!isCorrectLoopIndex(index) || index == SOLAR_MAIN_LOOP) {
+		return;
+	}
+
+	// any other pin drives the flash, the bus or the encoder of the board
+	if (!isFreeLoopPin(pin, index)) {
+		return;
+	}
+
+	if (pin != loops[index].pin) {
+		halDigitalWrite(loops[index].pin, loops[index].invert_flag);
+
+		loops[index].pin = pin;
+		halPinMode(pin, OUTPUT);
+		releTick();
+	}
+}
+
+void SolarSystemManager::setLoopInvertFlag(uint8_t index, bool invert_flag) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	loops[index].invert_flag = invert_flag;
+}
+
+void SolarSystemManager::setLoopFlow(uint8_t index, uint8_t flow) {
+	if (!isCorrectLoopIndex(index)) {
+		return;
+	}
+
+	loops[index].flow = constrain(flow, 0, SOLAR_FLOW_MAX);
+}
+
+int8_t SolarSystemManager::scanLoopPortIndex(uint8_t pin) {
+	for (uint8_t i = 0;i < LOOP_PORTS_COUNT;i++) {
+		if (loop_ports[i] == pin) {
+			return i;
+		}
+	}
+
+	return -1;
+}
+
 
 void SolarSystemManager::setSensor(uint8_t solar_sensor, int8_t ds18b20_index) {
 	switch (solar_sensor) {
@@ -176,31 +439,35 @@ void SolarSystemManager::setSensor(uint8_t solar_sensor, int8_t ds18b20_index) {
 }
 
 void SolarSystemManager::setBatterySensor(int8_t ds18b20_index) {
-	SensorsManager* sensors = system->getSensorsManager();
-
-	battery_sensor_index = constrain(ds18b20_index, -1, sensors->getDS18B20Count() - 1);
-	tick();
+	setLoopSource(SOLAR_MAIN_LOOP, ds18b20_index);
 }
 
 void SolarSystemManager::setBoilerSensor(int8_t ds18b20_index) {
-	SensorsManager* sensors = system->getSensorsManager();
-
-	boiler_sensor_index = constrain(ds18b20_index, -1, sensors->getDS18B20Count() - 1);
-	tick();
+	setLoopSink(SOLAR_MAIN_LOOP, ds18b20_index);
 }
 
 void SolarSystemManager::setExitSensor(int8_t ds18b20_index) {
-	SensorsManager* sensors = system->getSensorsManager();
-
-	exit_sensor_index = constrain(ds18b20_index, -1, sensors->getDS18B20Count() - 1);
+	exit_sensor_index = makeSensorIndex(ds18b20_index);
 	tick();
 }
 
 
-SystemManager* SolarSystemManager::getSystemManager() {
+CoreManager* SolarSystemManager::getSystemManager() {
 	return system;
 }
 
+ReleJournal* SolarSystemManager::getJournal() {
+	return &journal;
+}
+
+SafetyWatchdog* SolarSystemManager::getWatchdog() {
+	return &watchdog;
+}
+
+EnergyMeter* SolarSystemManager::getEnergyMeter() {
+	return &energy;
+}
+
 uint8_t SolarSystemManager::getStatus() {
 	if (!getWorkFlag()) return 1;
 	if (getBatterySensorStatus()) return 2;
@@ -212,7 +479,7 @@ uint8_t SolarSystemManager::getStatus() {
 
 
 bool SolarSystemManager::getReleFlag() {
-	return rele_flag;
+	return loops[SOLAR_MAIN_LOOP].rele_flag;
 }
 
 bool SolarSystemManager::getWorkFlag() {
@@ -224,39 +491,114 @@ bool SolarSystemManager::getErrorOnFlag() {
 }
 
 bool SolarSystemManager::getReleInvertFlag() {
-	return rele_invert_flag;
+	return loops[SOLAR_MAIN_LOOP].invert_flag;
 }
 
 uint8_t SolarSystemManager::getDelta() {
-  	return delta;
+  	return loops[SOLAR_MAIN_LOOP].delta;
 }
 
+uint8_t SolarSystemManager::getMode() {
+	return loops[SOLAR_MAIN_LOOP].mode;
+}
 
-uint8_t SolarSystemManager::getBatterySensorStatus() {
-	SensorsManager* sensors = system->getSensorsManager();
+uint8_t SolarSystemManager::getHysteresis() {
+	return loops[SOLAR_MAIN_LOOP].hysteresis;
+}
 
-	if (getBatterySensor() >= sensors->getDS18B20Count() || getBatterySensor() < 0) return 1;
-	if (sensors->getDS18B20Status(getBatterySensor()) ) return 2;
+uint16_t SolarSystemManager::getMinOnTime() {
+	return min_on_time;
+}
 
-	return 0;
+uint16_t SolarSystemManager::getMinOffTime() {
+	return min_off_time;
 }
 
-uint8_t SolarSystemManager::getBoilerSensorStatus() {
-	SensorsManager* sensors = system->getSensorsManager();
+float SolarSystemManager::getPidKp() {
+	return pid_kp;
+}
+
+float SolarSystemManager::getPidKi() {
+	return pid_ki;
+}
+
+float SolarSystemManager::getPidKd() {
+	return pid_kd;
+}
+
+uint16_t SolarSystemManager::getPidWindow() {
+	return pid_window;
+}
+
+bool SolarSystemManager::getPredictFlag() {
+	return predict_flag;
+}
+
+uint8_t SolarSystemManager::getPredictTime() {
+	return predict_time;
+}
+
+uint16_t SolarSystemManager::getFluidCp() {
+	return fluid_cp;
+}
+
+// the pump share the controller asks for, the relay itself follows getReleFlag()
+uint8_t SolarSystemManager::getOutput() {
+	return loops[SOLAR_MAIN_LOOP].output;
+}
 
-	if (getBoilerSensor() >= sensors->getDS18B20Count() || getBoilerSensor() < 0) return 1;
-	if (sensors->getDS18B20Status(getBoilerSensor()) ) return 2;
+
+uint8_t SolarSystemManager::getLoopsCount() {
+	return loops.size();
+}
+
+solar_loop_t* SolarSystemManager::getLoop(uint8_t index) {
+	if (!isCorrectLoopIndex(index)) {
+		return NULL;
+	}
+
+	return &loops[index];
+}
+
+// 0 - ok, 1 - off, 2 - source, 3 - sink, 4 - exit (main loop only)
+uint8_t SolarSystemManager::getLoopStatus(uint8_t index) {
+	if (!getWorkFlag()) return 1;
+	if (!isCorrectLoopIndex(index)) return 1;
+	if (makeSensorStatus(loops[index].source)) return 2;
+	if (makeSensorStatus(loops[index].sink)) return 3;
+	if (index == SOLAR_MAIN_LOOP && getExitSensorStatus()) return 4;
 
 	return 0;
 }
 
-uint8_t SolarSystemManager::getExitSensorStatus() {
+// °C per minute of source - sink, 0 while the history is short
+float SolarSystemManager::getLoopTrend(uint8_t index) {
 	SensorsManager* sensors = system->getSensorsManager();
+	float source_trend;
+	float sink_trend;
 
-	if (getExitSensor() >= sensors->getDS18B20Count() || getExitSensor() < 0) return 1;
-	if (sensors->getDS18B20Status(getExitSensor()) ) return 2;
+	if (getLoopStatus(index) == 2 || getLoopStatus(index) == 3) {
+		return 0;
+	}
 
-	return 0;
+	if (!sensors->getDS18B20Trend(loops[index].source, &source_trend) || !sensors->getDS18B20Trend(loops[index].sink, &sink_trend)) {
+		return 0;
+	}
+
+	return source_trend - sink_trend;
+}
+
+
+uint8_t SolarSystemManager::getBatterySensorStatus() {
+	return makeSensorStatus(getBatterySensor());
+}
+
+uint8_t SolarSystemManager::getBoilerSensorStatus() {
+	return makeSensorStatus(getBoilerSensor());
+}
+
+uint8_t SolarSystemManager::getExitSensorStatus() {
+	return makeSensorStatus(getExitSensor());
 }
 
 
@@ -277,11 +619,11 @@ int8_t SolarSystemManager::getSensor(uint8_t index) {
 }
 
 int8_t SolarSystemManager::getBatterySensor() {
-  	return battery_sensor_index;
+  	return loops[SOLAR_MAIN_LOOP].source;
 }
 
 int8_t SolarSystemManager::getBoilerSensor() {
-  	return boiler_sensor_index;
+  	return loops[SOLAR_MAIN_LOOP].sink;
 }
 
 int8_t SolarSystemManager::getExitSensor() {
@@ -319,7 +661,167 @@ float SolarSystemManager::getExitT() {
 	return sensors->getDS18B20T(getExitSensor());
 }
 
+int16_t SolarSystemManager::getBatteryTCenti() {
+	SensorsManager* sensors = system->getSensorsManager();
+
+	if (getBatterySensorStatus()) {
+		return 0;
+	}
+
+	return sensors->getDS18B20TCenti(getBatterySensor());
+}
+
+int16_t SolarSystemManager::getBoilerTCenti() {
+	SensorsManager* sensors = system->getSensorsManager();
+
+	if (getBoilerSensorStatus()) {
+		return 0;
+	}
+
+	return sensors->getDS18B20TCenti(getBoilerSensor());
+}
+
+int16_t SolarSystemManager::getExitTCenti() {
+	SensorsManager* sensors = system->getSensorsManager();
+
+	if (getExitSensorStatus()) {
+		return 0;
+	}
+
+	return sensors->getDS18B20TCenti(getExitSensor());
+}
+
 
 void SolarSystemManager::releTick() {
-	digitalWrite(RELE_PORT, getReleInvertFlag() ? !getReleFlag() : getReleFlag());
+	for (uint8_t i = 0;i < getLoopsCount();i++) {
+		halDigitalWrite(loops[i].pin, loops[i].invert_flag ? !loops[i].rele_flag : loops[i].rele_flag);
+	}
+}
+
+void SolarSystemManager::loopTick(uint8_t index) {
+	solar_loop_t* loop = &loops[index];
+
+	if (getLoopStatus(index)) {
+		if (getErrorOnFlag()) {
+			setLoopReleFlag(index, true, RELE_REASON_ERROR_ON);
+		}
+
+		return;
+	}
+
+	SensorsManager* sensors = system->getSensorsManager();
+
+	// a rejected reading keeps the pump as it is until the filter settles
+	if (sensors->getDS18B20Health(loop->source) == DS_HEALTH_SUSPECT || sensors->getDS18B20Health(loop->sink) == DS_HEALTH_SUSPECT) {
+		return;
+	}
+
+	float delta_now = sensors->getDS18B20T(loop->source) - sensors->getDS18B20T(loop->sink);
+	bool rele_flag = getController(loop->mode)->tick(this, loop, makePredictedDelta(index, delta_now));
+	setLoopReleFlag(index, rele_flag, rele_flag ? RELE_REASON_DELTA_ON : RELE_REASON_DELTA_OFF);
+}
+
+// the fail-safe state is the one a sensor error gives, a switched off system keeps the pumps off
+void SolarSystemManager::watchdogFeed() {
+	uint8_t pins[SOLAR_LOOPS_MAX];
+	bool safe_levels[SOLAR_LOOPS_MAX];
+	bool safe_on_flag = getWorkFlag() && getErrorOnFlag();
+
+	for (uint8_t i = 0;i < getLoopsCount();i++) {
+		pins[i] = loops[i].pin;
+		safe_levels[i] = loops[i].invert_flag ? !safe_on_flag : safe_on_flag;
+	}
+
+	watchdog.feed(pins, safe_levels, getLoopsCount());
+}
+
+// once per sensor read: heat moved by every running loop since the last read
+void SolarSystemManager::energyTick() {
+	SensorsManager* sensors = system->getSensorsManager();
+	TimeManager* time = system->getTimeManager();
+
+	energy.tick(time->getUnix(), time->day(), time->month());
+
+	if (sensors->getReadCount() == energy_read_count) {
+		return;
+	}
+
+	uint32_t step = energy_timer ? halMillis() - energy_timer : 0;
+
+	energy_read_count = sensors->getReadCount();
+	energy_timer = halMillis();
+
+	for (uint8_t i = 0;i < getLoopsCount();i++) {
+		solar_loop_t* loop = &loops[i];
+		// the exit pipe is closer to what enters the boiler
+		int8_t supply = (i == SOLAR_MAIN_LOOP && !getExitSensorStatus()) ? getExitSensor() : loop->source;
+		int16_t delta_centi = 0;
+
+		if (loop->rele_flag && !makeSensorStatus(supply) && !makeSensorStatus(loop->sink)) {
+			delta_centi = sensors->getDS18B20TCenti(supply) - sensors->getDS18B20TCenti(loop->sink);
+		}
+
+		energy.add(i, loop->flow, getFluidCp(), delta_centi, (step <= SEC_TO_MLS(ENERGY_STEP_MAX)) ? step : 0);
+	}
+}
+
+bool SolarSystemManager::isCorrectLoopIndex(uint8_t index) {
+	return index < getLoopsCount();
+}
+
+// one of loop_ports not taken by a loop other than index
+bool SolarSystemManager::isFreeLoopPin(uint8_t pin, uint8_t index) {
+	if (scanLoopPortIndex(pin) < 0) {
+		return false;
+	}
+
+	for (uint8_t i = 0;i < getLoopsCount();i++) {
+		if (i != index && loops[i].pin == pin) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int8_t SolarSystemManager::makeSensorIndex(int8_t ds18b20_index) {
+	return constrain(ds18b20_index, -1, system->getSensorsManager()->getDS18B20Count() - 1);
+}
+
+uint8_t SolarSystemManager::makeSensorStatus(int8_t ds18b20_index) {
+	SensorsManager* sensors = system->getSensorsManager();
+
+	if (ds18b20_index >= sensors->getDS18B20Count() || ds18b20_index < 0) return 1;
+	if (sensors->getDS18B20Status(ds18b20_index)) return 2;
+
+	return 0;
+}
+
+// the delta expected predict_time ahead: a rising one starts the pump a bit earlier,
+// a collapsing one stops it before the harvest is gone
+float SolarSystemManager::makePredictedDelta(uint8_t index, float delta_now) {
+	solar_loop_t* loop = &loops[index];
+
+	if (!getPredictFlag() || halMillis() - loop->rele_switch_timer < SEC_TO_MLS(SOLAR_PREDICT_SETTLE_TIME)) {
+		return delta_now;
+	}
+
+	float lead = getLoopTrend(index) * getPredictTime();
+
+	if (loop->rele_flag) {
+		return delta_now + min(lead, 0.0f);
+	}
+
+	return delta_now + constrain(lead, 0.0f, (float) SOLAR_PREDICT_LEAD_MAX);
+}
+
+SolarController* SolarSystemManager::getController(uint8_t mode) {
+	switch (mode) {
+	case SOLAR_MODE_HYSTERESIS:
+		return &hysteresis_controller;
+	case SOLAR_MODE_PID:
+		return &pid;
+	default:
+		return &bang_bang;
+	}
 }
\ No newline at end of file
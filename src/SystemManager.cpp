@@ -14,29 +14,26 @@ SystemManager::SystemManager() {
 }
 
 void SystemManager::begin() {
-	Serial.begin(9600);
+	// RX is left to a loop relay, see loop_ports
+	Serial.begin(9600, SERIAL_8N1, SERIAL_TX_ONLY);
 
-	time.setSystemManager(this);
-	sensors.setSystemManager(this);
-	solar.setSystemManager(this);
 	display.setSystemManager(this);
 	network.setSystemManager(this);
 	blynk.setSystemManager(this);
 
-	LittleFS.begin();
-	time.begin();
-	sensors.begin();
-	solar.begin();
+	halFsBegin();
+	CoreManager::begin();
 	display.begin();
 	network.begin();  
+	blynk.begin();
 
-	pinMode(BUZZER_PORT, OUTPUT);
-	pinMode(SW_PORT, INPUT_PULLUP);
+	halPinMode(BUZZER_PORT, OUTPUT);
+	halPinMode(SW_PORT, INPUT_PULLUP);
 	enc.setType(TYPE2);
 
-	attachInterrupt(CLK_PORT, encoderClkInterrupt, CHANGE);
-	attachInterrupt(DT_PORT, encoderDtInterrupt, CHANGE);
-	attachInterrupt(SW_PORT, encoderSwInterrupt, CHANGE);
+	halAttachInterrupt(CLK_PORT, encoderClkInterrupt, CHANGE);
+	halAttachInterrupt(DT_PORT, encoderDtInterrupt, CHANGE);
+	halAttachInterrupt(SW_PORT, encoderSwInterrupt, CHANGE);
 	
 	readSettings();
 	network.endBegin();
@@ -44,26 +41,33 @@ void SystemManager::begin() {
 
 
 void SystemManager::tick() {
-	// uint32_t tick = millis();
+	PROFILE_BEGIN(&profiler, loop_mark);
 
   	yield();
-	enc.tick();
-	
-	if (enc.isTurn() || enc.isPress()) {
-		if (display.action()) {
-			enc.resetStates();
-		}
-	}
 
-	time.tick();
-	sensors.tick();
-	solar.tick();
-	display.tick();
-	network.tick();
-	blynk.tick();
+	// enc is shared with the interrupts, hold timeout needs a poll from loop too
+	noInterrupts();
+	encoderPoll();
+	interrupts();
+
+	PROFILE(&profiler, PROFILE_TIME, time.tick());
+	PROFILE(&profiler, PROFILE_SENSORS, sensors.tick());
+	PROFILE(&profiler, PROFILE_SOLAR, solar.tick());
+	PROFILE(&profiler, PROFILE_DISPLAY, display.tick());
+	PROFILE(&profiler, PROFILE_NETWORK, network.tick());
+	PROFILE(&profiler, PROFILE_BLYNK, blynk.tick());
 
 	saveSettings();
-	// Serial.println(millis() - tick);
+	PROFILE_END(&profiler, PROFILE_LOOP, loop_mark);
+
+#ifdef PROFILER_SUPPORT
+	if (profiler.tick()) {
+		char buffer[PROFILE_JSON_SIZE];
+
+		Serial.println(profiler.makeJson(buffer, PROFILE_JSON_SIZE));
+		profiler.clear();
+	}
+#endif
 }
 
 void SystemManager::makeDefault() {
@@ -73,13 +77,13 @@ void SystemManager::makeDefault() {
 }
 
 void SystemManager::reset() {
-	ESP.reset();
+	halRestart();
 }
 
 void SystemManager::resetAll() {
-	LittleFS.remove("/config.nztr");
+	halFileRemove(SETTINGS_FILE);
 
-  	ESP.reset();
+  	halRestart();
 }
 
 
@@ -110,52 +114,58 @@ void SystemManager::makeBlynkElementCodesList(DynamicArray<String>* array) {
 #endif
 }
 
-void SystemManager::makeBlynkElementSend(BlynkWifi* Blynk, blynk_link_t* link) {
-	if (Blynk == NULL || link == NULL) {
-		return;
+bool SystemManager::makeBlynkElementValue(blynk_link_t* link, int16_t* centi, uint8_t* decimals) {
+	if (link == NULL) {
+		return false;
 	}
 
 #ifdef TIME_MANAGER_BLYNK_SUPPORT
-	if (time.blynkElementSend(Blynk, link)) return;
+	if (time.blynkElementValue(link, centi, decimals)) return true;
 #endif
 
 #ifdef MODULE_MANAGER_BLYNK_SUPPORT
-	if (sensors.blynkElementSend(Blynk, link)) return;
+	if (sensors.blynkElementValue(link, centi, decimals)) return true;
 #endif
 
 #ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
-	if (solar.blynkElementSend(Blynk, link)) return;
+	if (solar.blynkElementValue(link, centi, decimals)) return true;
 #endif
 
 #ifdef DISPLAY_MANAGER_BLYNK_SUPPORT
-	if (display.blynkElementSend(Blynk, link)) return;
+	if (display.blynkElementValue(link, centi, decimals)) return true;
 #endif
 
 #ifdef NETWORK_MANAGER_BLYNK_SUPPORT
-	if (network.blynkElementSend(Blynk, link)) return;
+	if (network.blynkElementValue(link, centi, decimals)) return true;
 #endif
+
+	return false;
 }
 
-void SystemManager::makeBlynkElementParse(String element_code, const BlynkParam& param) {
+blynk_handler_t SystemManager::makeBlynkElementHandler(const char* element_code) {
+	blynk_handler_t handler = NULL;
+
 #ifdef TIME_MANAGER_BLYNK_SUPPORT
-	if (time.blynkElementParse(element_code, param)) return;
+	if ((handler = time.blynkElementHandler(element_code))) return handler;
 #endif
 
 #ifdef MODULE_MANAGER_BLYNK_SUPPORT
-	if (sensors.blynkElementParse(element_code, param)) return;
+	if ((handler = sensors.blynkElementHandler(element_code))) return handler;
 #endif
 
 #ifdef SOLAR_SYSTEM_MANAGER_BLYNK_SUPPORT
-	if (solar.blynkElementParse(element_code, param)) return;
+	if ((handler = solar.blynkElementHandler(element_code))) return handler;
 #endif
 
 #ifdef DISPLAY_MANAGER_BLYNK_SUPPORT
-	if (display.blynkElementParse(element_code, param)) return;
+	if ((handler = display.blynkElementHandler(element_code))) return handler;
 #endif
 
 #ifdef NETWORK_MANAGER_BLYNK_SUPPORT
-	if (network.blynkElementParse(element_code, param)) return;
+	if ((handler = network.blynkElementHandler(element_code))) return handler;
 #endif
+
+	return handler;
 }
 
 int8_t SystemManager::scanBlynkElemetCodeIndex(DynamicArray<String>* array, String element_code) {
@@ -173,6 +183,10 @@ int8_t SystemManager::scanBlynkElemetCodeIndex(DynamicArray<String>* array, Stri
 }
 
 
+bool SystemManager::ntpSync(TimeManager* time) {
+	return network.ntpSync(time);
+}
+
 bool SystemManager::deleteBlynkLink(String element_code) {
 	return blynk.deleteLink(element_code);
 }
@@ -182,29 +196,52 @@ bool SystemManager::modifyBlynkLinkElementCode(String previous_code, String new_
 }
 
 
-void SystemManager::saveSettingsRequest() {
-	save_settings_request = true;
-}
-
 void SystemManager::buzzer(uint16_t freq, uint16_t duration) {
 	if (!buzzer_flag) {
 		return;
 	}
 
-	tone(BUZZER_PORT, freq, duration);
+	halTone(BUZZER_PORT, freq, duration);
 }
 
 
 ICACHE_RAM_ATTR void SystemManager::encoderClkInterrupt() {
-	enc.tick();
+	encoderPoll();
 }
 
 ICACHE_RAM_ATTR void SystemManager::encoderDtInterrupt() {
-	enc.tick();
+	encoderPoll();
 }
 
 ICACHE_RAM_ATTR void SystemManager::encoderSwInterrupt() {
+	encoderPoll();
+}
+
+ICACHE_RAM_ATTR void SystemManager::encoderPoll() {
 	enc.tick();
+
+	// every detent is moved into the queue right away, so none is overwritten before the window sees it
+	if (enc.isLeft()) {
+		enc_queue.push(ENC_EVENT_LEFT);
+	}
+	if (enc.isRight()) {
+		enc_queue.push(ENC_EVENT_RIGHT);
+	}
+	if (enc.isLeftH()) {
+		enc_queue.push(ENC_EVENT_LEFT_H);
+	}
+	if (enc.isRightH()) {
+		enc_queue.push(ENC_EVENT_RIGHT_H);
+	}
+	if (enc.isPress()) {
+		enc_queue.push(ENC_EVENT_PRESS);
+	}
+	if (enc.isClick()) {
+		enc_queue.push(ENC_EVENT_CLICK);
+	}
+	if (enc.isHolded()) {
+		enc_queue.push(ENC_EVENT_HOLDED);
+	}
 }
 
 
@@ -217,18 +254,6 @@ bool SystemManager::getBuzzerFlag() {
 	return buzzer_flag;
 }
 
-TimeManager* SystemManager::getTimeManager() {
-	return &time;
-}
-
-SensorsManager* SystemManager::getSensorsManager() {
-	return &sensors;
-}
-
-SolarSystemManager* SystemManager::getSolarSystemManager() {
-	return &solar;
-}
-
 DisplayManager* SystemManager::getDisplayManager() {
 	return &display;
 }
@@ -241,10 +266,16 @@ BlynkManager* SystemManager::getBlynkManager() {
 	return &blynk;
 }
 
-Encoder* SystemManager::getEncoder() {
-	return &enc;
+EncoderQueue* SystemManager::getEncoder() {
+	return &enc_queue;
 }
 
+#ifdef PROFILER_SUPPORT
+Profiler* SystemManager::getProfiler() {
+	return &profiler;
+}
+#endif
+
 
 void SystemManager::saveSettings(bool ignore_flag) {
 	if (!ignore_flag) {
@@ -252,57 +283,57 @@ void SystemManager::saveSettings(bool ignore_flag) {
 			return;
 		}
 
-		if (millis() - save_settings_timer < SEC_TO_MLS(SAVE_SETTINGS_TIME)) {
+		if (halMillis() - save_settings_timer < SEC_TO_MLS(SAVE_SETTINGS_TIME)) {
 			return;
 		}
 	}
 	Serial.println("save");
 
-	File file = LittleFS.open("/config.nztr", "w");
-	char buffer[SETTINGS_BUFFER_SIZE + 1] = "";
+	PROFILE_BEGIN(&profiler, mark);
+	// the loop stack is 4 KB, the buffer does not fit it
+	char* buffer = new char[SETTINGS_BUFFER_SIZE + 1];
+	*buffer = 0;
 
 	setParameter(buffer, "SSb", getBuzzerFlag());
 
-	time.writeSettings(buffer);
-	sensors.writeSettings(buffer);
-	solar.writeSettings(buffer);
+	CoreManager::writeSettings(buffer);
 	display.writeSettings(buffer);
 	network.writeSettings(buffer);
 	blynk.writeSettings(buffer);
 
-	file.write(buffer, strlen(buffer));
-  	file.close();
+	halFileWrite(SETTINGS_FILE, buffer, strlen(buffer), false);
+	delete[] buffer;
 
 	save_settings_request = false;
-	save_settings_timer = millis();
+	save_settings_timer = halMillis();
+	PROFILE_END(&profiler, PROFILE_SAVE_SETTINGS, mark);
 }
 
 void SystemManager::readSettings() {
-	File file = LittleFS.open("/config.nztr", "r");
+	int32_t file_size = halFileSize(SETTINGS_FILE);
 
-	if (!file) {
+	if (file_size < 0) {
 		saveSettings(true);
 		return;
 	}
 
-	uint16_t file_size = file.size();
+	PROFILE_BEGIN(&profiler, mark);
 	char* buffer = new char[file_size + 1];
 
-	file.read((uint8_t*) buffer, file_size);
-	buffer[file_size] = 0;
+	file_size = halFileRead(SETTINGS_FILE, buffer, file_size, 0);
+	buffer[max(file_size, (int32_t) 0)] = 0;
 	
 	getParameter(buffer, "SSb", &buzzer_flag);
 	setBuzzerFlag(buzzer_flag);
 
-	time.readSettings(buffer);
-	sensors.readSettings(buffer);
-	solar.readSettings(buffer);
+	CoreManager::readSettings(buffer);
 	display.readSettings(buffer);
 	network.readSettings(buffer);
 	blynk.readSettings(buffer);
 
 	delete[] buffer;
-	file.close();
+	PROFILE_END(&profiler, PROFILE_READ_SETTINGS, mark);
 }
 
-Encoder SystemManager::enc = Encoder(CLK_PORT, DT_PORT, SW_PORT);
\ No newline at end of file
+Encoder SystemManager::enc = Encoder(CLK_PORT, DT_PORT, SW_PORT);
+EncoderQueue SystemManager::enc_queue;
\ No newline at end of file
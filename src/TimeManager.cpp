@@ -7,24 +7,40 @@
  * Date: 04.02.2025
  */
 
-#include "data.h"
+#include "core.h"
 
 TimeManager::TimeManager() {
 	makeDefault();
 }
 
 void TimeManager::begin() {
-	clk.setUnix(0);
+	setUnixMillis(0);
 }
 
 
 void TimeManager::tick() {
+	updateModel();
+
+	// Clock is set on every new second of the model, so it can not run ahead of it
+	if (model_ms / 1000 != model_unix) {
+		model_unix = model_ms / 1000;
+		clk.setUnix(model_unix);
+
+		updateLocalTime();
+	}
+
 	if (ntp_flag) {
-		if (!ntp_sync_timer || millis() - ntp_sync_timer >= MIN_TO_MLS(NTP_SYNC_TIME)) {
-			NetworkManager* network = system->getNetworkManager();
-			
-			if (network->ntpSync(this)) {
-				ntp_sync_timer = millis();
+		if (!ntp_sync_timer || halMillis() - ntp_sync_timer >= MIN_TO_MLS(ntp_poll_time)) {
+			if (system->ntpSync(this)) {
+				ntp_sync_timer = halMillis();
+
+				// a small correction means the clock holds well, so the server is asked less often
+				if (abs(ntp_offset) <= NTP_POLL_OFFSET) {
+					ntp_poll_time = min(ntp_poll_time * 2, NTP_POLL_MAX_TIME);
+				}
+				else {
+					ntp_poll_time = NTP_POLL_MIN_TIME;
+				}
 			}
 		}
 	}
@@ -35,20 +51,47 @@ void TimeManager::makeDefault() {
 
 	ntp_flag = DEFAULT_NTP_FLAG;
 	gmt = DEFAULT_GMT;
+	strcpy(timezone_rule, DEFAULT_TIMEZONE);
+	makeTimezone(HOUR_TO_SEC(gmt), &timezone);
+	memset(&local_time, 0, sizeof(local_time));
+
 	ntp_sync_timer = 0;
+	ntp_poll_time = NTP_POLL_MIN_TIME;
+	ntp_offset = 0;
+
+	model_ms = 0;
+	model_millis = 0;
+	model_unix = 0;
+	drift_ppb = 0;
+	drift_acc = 0;
+	slew_ms = 0;
+	slew_acc = 0;
+
+	drift_sample_flag = false;
+	drift_sample_millis = 0;
+	drift_sample_ms = 0;
 }
 
 void TimeManager::writeSettings(char* buffer) {
 	setParameter(buffer, "STns", getNtpFlag());
 	setParameter(buffer, "STg", getGmt());
+	setParameter(buffer, "STtz", (const char*) getTimezone());
+	setParameter(buffer, "STdr", getDrift());
 }
 
 void TimeManager::readSettings(char* buffer) {
 	getParameter(buffer, "STns", &ntp_flag);
 	getParameter(buffer, "STg", &gmt);
+	getParameter(buffer, "STtz", timezone_rule, TIMEZONE_SIZE);
+	getParameter(buffer, "STdr", &drift_ppb);
+
+	drift_ppb = constrain(drift_ppb, -NTP_DRIFT_MAX, NTP_DRIFT_MAX);
 
 	setNtpFlag(ntp_flag);
-	setGmt(gmt);
+
+	if (!setTimezone(timezone_rule)) {
+		setGmt(gmt);
+	}
 }
 
 uint8_t TimeManager::status() {
@@ -56,35 +99,35 @@ uint8_t TimeManager::status() {
 }
 
 uint8_t TimeManager::hour() {
-	return clk.hour(gmt);
+	return local_time.hour;
 }
 
 uint8_t TimeManager::minute() {
-	return clk.minute(gmt);
+	return local_time.minute;
 }
 
 uint8_t TimeManager::second() {
-	return clk.second(gmt);
+	return local_time.second;
 }
 
 uint8_t TimeManager::weekday() {
-	return clk.weekday(gmt);
+	return local_time.weekday;
 }
 
 uint8_t TimeManager::day() {
-	return clk.day(gmt);
+	return local_time.day;
 }
 
 uint8_t TimeManager::month() {
-	return clk.month(gmt);
+	return local_time.month;
 }
 
 uint16_t TimeManager::year() {
-	return clk.year(gmt);
+	return local_time.year;
 }
 
 
-void TimeManager::setSystemManager(SystemManager* system) {
+void TimeManager::setSystemManager(CoreManager* system) {
 	this->system = system;
 }
 
@@ -95,22 +138,91 @@ void TimeManager::setNtpFlag(bool ntp_flag) {
 
 void TimeManager::setGmt(int8_t gmt) {
 	this->gmt = constrain(gmt, -12, 12);
+
+	*timezone_rule = '\0';
+	makeTimezone(HOUR_TO_SEC(this->gmt), &timezone);
+	updateLocalTime();
+}
+
+bool TimeManager::setTimezone(const char* rule) {
+	if (rule == NULL || !*rule) {
+		setGmt(gmt);
+		return true;
+	}
+
+	if (strlen(rule) >= TIMEZONE_SIZE || !parseTimezone(rule, &timezone)) {
+		return false;
+	}
+
+	if (rule != timezone_rule) {
+		strcpy(timezone_rule, rule);
+	}
+
+	updateLocalTime();
+	return true;
 }
 
 void TimeManager::setTime(TimeT* time) {
-	clk.setTime(gmt, *time);
+	setTime(time->hour, time->minute, time->second, time->day, time->month, time->year);
 }
 
 void TimeManager::setTime(uint8_t hour, uint8_t minute, uint8_t second, uint8_t day, uint8_t month, uint16_t year) {
-	clk.setTime(gmt, hour, minute, second, day, month, year);
+	uint32_t local = makeTime(year, month, day, hour, minute, second);
+
+	// the offset is looked up at the standard time guess, so a time skipped by DST lands after the gap
+	setUnix(local - timezoneOffset(&timezone, local - timezone.std_offset, NULL));
 }
 
 void TimeManager::setUnix(uint32_t unix) {
 	clk.setUnix(unix);
+	syncModel();
+}
+
+void TimeManager::setUnixMillis(uint64_t unix_ms) {
+	model_ms = unix_ms;
+	model_millis = halMillis();
+	slew_ms = 0;
+	drift_sample_flag = false;
+
+	model_unix = model_ms / 1000;
+	clk.setUnix(model_unix);
+
+	updateLocalTime();
+}
+
+void TimeManager::adjustUnixMillis(int64_t offset) {
+	updateModel();
+	ntp_offset = constrain(offset, (int64_t) INT32_MIN, (int64_t) INT32_MAX);
+
+	if (!drift_sample_flag || offset > NTP_STEP_OFFSET || offset < -NTP_STEP_OFFSET) {
+		setUnixMillis(model_ms + offset);
+
+		drift_sample_flag = true;
+		drift_sample_millis = halMillis();
+		drift_sample_ms = 0;
+		return;
+	}
+
+	// with a right drift the new offset equals the part of the last one that is not slewed yet
+	uint32_t sample_time = halMillis() - drift_sample_millis;
+	drift_sample_ms += offset - slew_ms;
+
+	// a shorter sample is too noisy for the drift, it runs on to the next offset
+	if (sample_time >= MIN_TO_MLS(NTP_DRIFT_MIN_TIME)) {
+		int64_t drift_error = (int64_t) drift_sample_ms * 1000000000LL / sample_time;
+
+		drift_ppb = constrain(drift_ppb + drift_error / 2, -NTP_DRIFT_MAX, NTP_DRIFT_MAX);
+		system->saveSettingsRequest();
+
+		drift_sample_millis = halMillis();
+		drift_sample_ms = 0;
+	}
+
+	slew_ms = offset;
 }
 
 
-SystemManager* TimeManager::getSystemManager() {
+CoreManager* TimeManager::getSystemManager() {
 	return system;
 }
 
@@ -126,10 +238,86 @@ int8_t TimeManager::getGmt() {
 	return gmt;
 }
 
+char* TimeManager::getTimezone() {
+	return timezone_rule;
+}
+
+local_time_t* TimeManager::getLocalTime() {
+	return &local_time;
+}
+
 TimeT TimeManager::getTime() {
-	return clk.getTime(gmt);
+	TimeT time = clk.getTime();
+
+	time.second = local_time.second;
+	time.minute = local_time.minute;
+	time.hour = local_time.hour;
+	time.day = local_time.day;
+	time.month = local_time.month;
+	time.year = local_time.year;
+
+	return time;
 }
 
 uint32_t TimeManager::getUnix() {
 	return clk.getUnix();
+}
+
+uint64_t TimeManager::getUnixMillis() {
+	updateModel();
+	return model_ms;
+}
+
+uint8_t TimeManager::getNtpPollTime() {
+	return ntp_poll_time;
+}
+
+int32_t TimeManager::getDrift() {
+	return drift_ppb;
+}
+
+
+void TimeManager::updateModel() {
+	uint32_t elapsed = halMillis() - model_millis;
+	model_millis += elapsed;
+	model_ms += elapsed;
+
+	// drift in ppb, the remainder below 1 mls is carried to the next update
+	drift_acc += (int64_t) elapsed * drift_ppb;
+	int64_t drift_ms = drift_acc / 1000000000LL;
+	drift_acc -= drift_ms * 1000000000LL;
+	model_ms += drift_ms;
+
+	// slew is spread at 1 mls per NTP_SLEW_TIME, so the time never jumps
+	slew_acc += elapsed;
+	while (slew_ms && slew_acc >= NTP_SLEW_TIME) {
+		slew_acc -= NTP_SLEW_TIME;
+
+		model_ms += (slew_ms > 0) ? 1 : -1;
+		slew_ms += (slew_ms > 0) ? -1 : 1;
+	}
+
+	if (!slew_ms) {
+		slew_acc = 0;
+	}
+}
+
+void TimeManager::syncModel() {
+	model_unix = clk.getUnix();
+	model_ms = (uint64_t) model_unix * 1000;
+	model_millis = halMillis();
+	slew_ms = 0;
+	drift_sample_flag = false;
+
+	updateLocalTime();
+}
+
+// calendar fields are broken down once per second, the getters only read them
+void TimeManager::updateLocalTime() {
+	bool dst;
+	int32_t offset = timezoneOffset(&timezone, model_unix, &dst);
+
+	breakTime(model_unix + offset, &local_time);
+	local_time.offset = offset;
+	local_time.dst = dst;
 }
\ No newline at end of file
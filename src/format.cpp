@@ -0,0 +1,66 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "format.h"
+
+char* centiToString(int16_t centi, uint8_t decimals, char* buffer) {
+	char* pointer = buffer;
+	char digits[5];
+	uint8_t digits_count = 0;
+	uint16_t value = (centi < 0) ? -(int32_t) centi : centi;
+
+	if (decimals == 0) {
+		value = (value + 50) / 100;
+	}
+	else if (decimals == 1) {
+		value = (value + 5) / 10;
+	}
+	else {
+		decimals = 2;
+	}
+
+	uint16_t integer = (decimals == 2) ? value / 100 : (decimals == 1) ? value / 10 : value;
+	uint16_t fraction = value - integer * ((decimals == 2) ? 100 : (decimals == 1) ? 10 : 1);
+
+	if (centi < 0 && value) {
+		*pointer++ = '-';
+	}
+
+	do {
+		digits[digits_count++] = '0' + integer % 10;
+		integer /= 10;
+	} while (integer);
+
+	while (digits_count) {
+		*pointer++ = digits[--digits_count];
+	}
+
+	if (decimals) {
+		*pointer++ = '.';
+
+		if (decimals == 2) {
+			*pointer++ = '0' + fraction / 10;
+		}
+		*pointer++ = '0' + fraction % 10;
+	}
+	*pointer = '\0';
+
+	return buffer;
+}
+
+int16_t floatToCenti(float value) {
+	value = constrain(value * 100, -32768.0f, 32767.0f);
+
+	return (int16_t) (value + ((value < 0) ? -0.5f : 0.5f));
+}
+
+int16_t rawToCenti(int16_t raw) {
+	// ds18b20 raw is 1/128 °C, 100/128 == 25/32
+	return ((int32_t) raw * 25 + 16) >> 5;
+}
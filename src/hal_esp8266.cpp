@@ -0,0 +1,181 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#ifndef HAL_LINUX
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <OneWire.h>
+#include <DallasTemperature.h>
+#include <AM2320.h>
+#include <ESP8266WiFi.h>
+#include <Ticker.h>
+#include "hal.h"
+
+static Ticker ticker;
+static OneWire one_wire;
+static DallasTemperature ds18b20_sensor;
+static AM2320 am2320_sensor;
+
+uint32_t halMillis() {
+	return millis();
+}
+
+uint32_t halMicros() {
+	return micros();
+}
+
+
+void halTickerAttach(uint32_t period, void (*handler)(void*), void* arg) {
+	ticker.attach_ms(period, handler, arg);
+}
+
+
+void halRestart() {
+	ESP.reset();
+}
+
+uint8_t halResetReason() {
+	return ESP.getResetInfoPtr()->reason;
+}
+
+// offsets are in 4 byte blocks of the RTC memory
+bool halRtcRead(uint32_t offset, void* data, uint32_t size) {
+	return ESP.rtcUserMemoryRead(offset / 4, (uint32_t*) data, size);
+}
+
+bool halRtcWrite(uint32_t offset, const void* data, uint32_t size) {
+	return ESP.rtcUserMemoryWrite(offset / 4, (uint32_t*) data, size);
+}
+
+
+uint32_t halFreeHeap() {
+	return ESP.getFreeHeap();
+}
+
+uint8_t halHeapFragmentation() {
+	return ESP.getHeapFragmentation();
+}
+
+
+void halPinMode(uint8_t pin, uint8_t mode) {
+	pinMode(pin, mode);
+}
+
+void halDigitalWrite(uint8_t pin, bool value) {
+	digitalWrite(pin, value);
+}
+
+bool halDigitalRead(uint8_t pin) {
+	return digitalRead(pin);
+}
+
+void halAttachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+	attachInterrupt(pin, handler, mode);
+}
+
+void halTone(uint8_t pin, uint16_t freq, uint32_t duration) {
+	tone(pin, freq, duration);
+}
+
+
+bool halFsBegin() {
+	return LittleFS.begin();
+}
+
+int32_t halFileSize(const char* path) {
+	File file = LittleFS.open(path, "r");
+
+	if (!file) {
+		return -1;
+	}
+
+	int32_t size = file.size();
+	file.close();
+
+	return size;
+}
+
+int32_t halFileRead(const char* path, void* buffer, uint32_t size, uint32_t offset) {
+	File file = LittleFS.open(path, "r");
+
+	if (!file) {
+		return -1;
+	}
+
+	int32_t result = file.seek(offset) ? file.read((uint8_t*) buffer, size) : 0;
+	file.close();
+
+	return result;
+}
+
+bool halFileWrite(const char* path, const void* data, uint32_t size, bool append_flag) {
+	File file = LittleFS.open(path, append_flag ? "a" : "w");
+
+	if (!file) {
+		return false;
+	}
+
+	bool result = file.write((const uint8_t*) data, size) == size;
+	file.close();
+
+	return result;
+}
+
+bool halFileRemove(const char* path) {
+	return LittleFS.remove(path);
+}
+
+
+void halDsBegin(uint8_t pin) {
+	one_wire.begin(pin);
+	ds18b20_sensor.setOneWire(&one_wire);
+
+	ds18b20_sensor.begin();
+	ds18b20_sensor.setResolution(12);
+}
+
+uint8_t halDsScan() {
+	ds18b20_sensor.begin();
+	return ds18b20_sensor.getDS18Count();
+}
+
+bool halDsAddress(uint8_t index, uint8_t* address) {
+	return ds18b20_sensor.getAddress(address, index);
+}
+
+void halDsRequest() {
+	ds18b20_sensor.requestTemperatures();
+}
+
+int16_t halDsRaw(const uint8_t* address) {
+	return ds18b20_sensor.getTemp(address);
+}
+
+void halDsSetResolution(const uint8_t* address, uint8_t resolution) {
+	ds18b20_sensor.setResolution(address, resolution);
+}
+
+uint8_t halDsResolution(const uint8_t* address) {
+	return ds18b20_sensor.getResolution(address);
+}
+
+
+uint8_t halAm2320Read(float* t, float* h) {
+	return am2320_sensor.read(t, h);
+}
+
+
+bool halWifiConnected() {
+	return WiFi.status() == WL_CONNECTED;
+}
+
+int8_t halWifiRssi() {
+	return WiFi.RSSI();
+}
+#endif
@@ -0,0 +1,369 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#ifdef HAL_LINUX
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <Arduino.h>
+#include "hal.h"
+#include "hal_linux.h"
+
+static uint8_t pin_modes[HAL_LINUX_PINS_COUNT];
+static bool pin_values[HAL_LINUX_PINS_COUNT];
+static hal_linux_ds_t ds_sensors[HAL_LINUX_DS_MAX_COUNT];
+static uint8_t ds_count = 0;
+static float am2320_t = 0;
+static float am2320_h = 0;
+static uint8_t am2320_status = 0;
+static bool wifi_flag = false;
+
+static bool virtual_time_flag = false;
+static uint32_t virtual_millis = 0;
+
+static void (*ticker_handler)(void*) = NULL;
+static void* ticker_arg = NULL;
+static uint8_t reset_reason = HAL_RESET_POWER;
+static uint8_t rtc_memory[HAL_RTC_SIZE];
+
+static void makePath(const char* path, char* buffer) {
+	snprintf(buffer, HAL_LINUX_PATH_SIZE, "%s%s", HAL_FS_ROOT, path);
+}
+
+static hal_linux_ds_t* findDs(const uint8_t* address) {
+	for (uint8_t i = 0;i < ds_count;i++) {
+		if (!memcmp(ds_sensors[i].address, address, HAL_DS_ADDRESS_SIZE)) {
+			return &ds_sensors[i];
+		}
+	}
+
+	return NULL;
+}
+
+
+uint32_t halMillis() {
+	if (virtual_time_flag) {
+		return virtual_millis;
+	}
+
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint32_t) (now.tv_sec * 1000ULL + now.tv_nsec / 1000000);
+}
+
+uint32_t halMicros() {
+	if (virtual_time_flag) {
+		return virtual_millis * 1000;
+	}
+
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint32_t) (now.tv_sec * 1000000ULL + now.tv_nsec / 1000);
+}
+
+
+// the host Arduino core takes its time from here, so Clock follows the virtual time too
+unsigned long millis() {
+	return halMillis();
+}
+
+unsigned long micros() {
+	return halMicros();
+}
+
+void delay(unsigned long time) {
+	// a busy wait on millis() yields with delay(0), on the board the time runs meanwhile
+	if (virtual_time_flag) {
+		virtual_millis += max(time, 1UL);
+		return;
+	}
+
+	usleep(time * 1000);
+}
+
+void delayMicroseconds(unsigned int time) {
+	if (!virtual_time_flag) {
+		usleep(time);
+	}
+}
+
+void yield() {
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+	halPinMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+	halDigitalWrite(pin, value);
+}
+
+int digitalRead(uint8_t pin) {
+	return halDigitalRead(pin);
+}
+
+// nothing is wired to A0, the pwm is seen as on or off
+int analogRead(uint8_t pin) {
+	return 0;
+}
+
+void analogWrite(uint8_t pin, int value) {
+	halDigitalWrite(pin, value > 0);
+}
+
+
+// there is no timer thread, the host calls halLinuxTicker()
+void halTickerAttach(uint32_t period, void (*handler)(void*), void* arg) {
+	ticker_handler = handler;
+	ticker_arg = arg;
+}
+
+
+// the next begin() sees a software reset, the state is kept like in the RTC memory
+void halRestart() {
+	reset_reason = HAL_RESET_SOFT;
+}
+
+uint8_t halResetReason() {
+	return reset_reason;
+}
+
+bool halRtcRead(uint32_t offset, void* data, uint32_t size) {
+	if (offset + size > HAL_RTC_SIZE) {
+		return false;
+	}
+
+	memcpy(data, &rtc_memory[offset], size);
+	return true;
+}
+
+bool halRtcWrite(uint32_t offset, const void* data, uint32_t size) {
+	if (offset + size > HAL_RTC_SIZE) {
+		return false;
+	}
+
+	memcpy(&rtc_memory[offset], data, size);
+	return true;
+}
+
+
+uint32_t halFreeHeap() {
+	return 0;
+}
+
+uint8_t halHeapFragmentation() {
+	return 0;
+}
+
+
+void halPinMode(uint8_t pin, uint8_t mode) {
+	if (pin < HAL_LINUX_PINS_COUNT) {
+		pin_modes[pin] = mode;
+
+		// an open pin with a pull-up reads high, the encoder button is not pressed
+		if (mode == INPUT_PULLUP) {
+			pin_values[pin] = true;
+		}
+	}
+}
+
+void halDigitalWrite(uint8_t pin, bool value) {
+	if (pin < HAL_LINUX_PINS_COUNT) {
+		pin_values[pin] = value;
+	}
+}
+
+bool halDigitalRead(uint8_t pin) {
+	return (pin < HAL_LINUX_PINS_COUNT) ? pin_values[pin] : false;
+}
+
+void halAttachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+}
+
+void halTone(uint8_t pin, uint16_t freq, uint32_t duration) {
+}
+
+
+bool halFsBegin() {
+	mkdir(HAL_FS_ROOT, 0755);
+	return true;
+}
+
+int32_t halFileSize(const char* path) {
+	char full_path[HAL_LINUX_PATH_SIZE];
+	struct stat info;
+
+	makePath(path, full_path);
+	return stat(full_path, &info) ? -1 : (int32_t) info.st_size;
+}
+
+int32_t halFileRead(const char* path, void* buffer, uint32_t size, uint32_t offset) {
+	char full_path[HAL_LINUX_PATH_SIZE];
+	makePath(path, full_path);
+
+	FILE* file = fopen(full_path, "rb");
+
+	if (file == NULL) {
+		return -1;
+	}
+
+	int32_t result = fseek(file, offset, SEEK_SET) ? 0 : fread(buffer, 1, size, file);
+	fclose(file);
+
+	return result;
+}
+
+bool halFileWrite(const char* path, const void* data, uint32_t size, bool append_flag) {
+	char full_path[HAL_LINUX_PATH_SIZE];
+	makePath(path, full_path);
+
+	FILE* file = fopen(full_path, append_flag ? "ab" : "wb");
+
+	if (file == NULL) {
+		return false;
+	}
+
+	bool result = fwrite(data, 1, size, file) == size;
+	fclose(file);
+
+	return result;
+}
+
+bool halFileRemove(const char* path) {
+	char full_path[HAL_LINUX_PATH_SIZE];
+
+	makePath(path, full_path);
+	return !remove(full_path);
+}
+
+
+void halDsBegin(uint8_t pin) {
+}
+
+uint8_t halDsScan() {
+	return ds_count;
+}
+
+bool halDsAddress(uint8_t index, uint8_t* address) {
+	if (index >= ds_count) {
+		return false;
+	}
+
+	memcpy(address, ds_sensors[index].address, HAL_DS_ADDRESS_SIZE);
+	return true;
+}
+
+void halDsRequest() {
+}
+
+int16_t halDsRaw(const uint8_t* address) {
+	hal_linux_ds_t* sensor = findDs(address);
+
+	return (sensor != NULL && sensor->connected_flag) ? sensor->raw : HAL_DS_DISCONNECTED_RAW;
+}
+
+void halDsSetResolution(const uint8_t* address, uint8_t resolution) {
+	hal_linux_ds_t* sensor = findDs(address);
+
+	if (sensor != NULL) {
+		sensor->resolution = resolution;
+	}
+}
+
+uint8_t halDsResolution(const uint8_t* address) {
+	hal_linux_ds_t* sensor = findDs(address);
+
+	return (sensor != NULL) ? sensor->resolution : 0;
+}
+
+
+uint8_t halAm2320Read(float* t, float* h) {
+	*t = am2320_t;
+	*h = am2320_h;
+
+	return am2320_status;
+}
+
+
+bool halWifiConnected() {
+	return wifi_flag;
+}
+
+int8_t halWifiRssi() {
+	return wifi_flag ? -50 : 0;
+}
+
+
+void halLinuxSetVirtualTime(bool virtual_flag, uint32_t millis) {
+	virtual_time_flag = virtual_flag;
+	virtual_millis = millis;
+}
+
+void halLinuxAdvanceTime(uint32_t millis) {
+	virtual_millis += millis;
+}
+
+uint8_t halLinuxAddDs(const uint8_t* address) {
+	hal_linux_ds_t* sensor = findDs(address);
+
+	// the same sensor may be added again by the next run
+	if (sensor != NULL) {
+		return sensor - ds_sensors;
+	}
+
+	if (ds_count >= HAL_LINUX_DS_MAX_COUNT) {
+		return HAL_LINUX_DS_MAX_COUNT;
+	}
+
+	memcpy(ds_sensors[ds_count].address, address, HAL_DS_ADDRESS_SIZE);
+	ds_sensors[ds_count].raw = HAL_DS_DISCONNECTED_RAW;
+	ds_sensors[ds_count].resolution = 12;
+	ds_sensors[ds_count].connected_flag = true;
+
+	return ds_count++;
+}
+
+void halLinuxSetDs(uint8_t index, float t, bool connected_flag) {
+	if (index >= ds_count) {
+		return;
+	}
+
+	// 1/128 °C steps like the DS18B20 register
+	ds_sensors[index].raw = (int16_t) (t * 128 + ((t < 0) ? -0.5f : 0.5f));
+	ds_sensors[index].connected_flag = connected_flag;
+}
+
+void halLinuxSetAm2320(float t, float h, uint8_t status) {
+	am2320_t = t;
+	am2320_h = h;
+	am2320_status = status;
+}
+
+void halLinuxSetWifi(bool connected_flag) {
+	wifi_flag = connected_flag;
+}
+
+void halLinuxTicker() {
+	if (ticker_handler != NULL) {
+		ticker_handler(ticker_arg);
+	}
+}
+
+void halLinuxSetResetReason(uint8_t reason) {
+	reset_reason = reason;
+}
+
+uint8_t halLinuxGetPinMode(uint8_t pin) {
+	return (pin < HAL_LINUX_PINS_COUNT) ? pin_modes[pin] : 0;
+}
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#ifdef HAL_LINUX
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "sim_plant.h"
+
+static const uint8_t sim_addresses[3][HAL_DS_ADDRESS_SIZE] = {
+	{0x28, 'S', 'I', 'M', 0, 0, 0, 1},
+	{0x28, 'S', 'I', 'M', 0, 0, 0, 2},
+	{0x28, 'S', 'I', 'M', 0, 0, 0, 3},
+};
+
+void simMakeDefault(sim_config_t* config) {
+	config->sun_profile = SIM_SUN_CLEAR;
+	config->sun_peak = 800;
+	config->sunrise = 6;
+	config->sunset = 20;
+	config->seed = 1;
+
+	config->collector_area = 2;
+	config->collector_efficiency = 0.6f;
+	config->collector_mass = 10;
+	config->collector_loss = 8;
+
+	config->boiler_mass = 200;
+	config->boiler_loss = 2;
+	config->boiler_draw = 150;
+
+	config->pump_flow = 0.03f;
+	config->exchanger_efficiency = 0.7f;
+	config->pipe_time = 60;
+
+	config->ambient_t = 15;
+	config->room_t = 20;
+	config->start_t = 20;
+
+	config->rele_pin = RELE_PORT;
+	config->rele_invert_flag = DEFAULT_SOLAR_RELE_INVERT_FLAG;
+	config->chatter_time = 60;
+}
+
+void simBegin(sim_plant_t* plant, const sim_config_t* config) {
+	memset(plant, 0, sizeof(sim_plant_t));
+	plant->config = *config;
+
+	halLinuxSetVirtualTime(true, 0);
+	plant->battery_index = halLinuxAddDs(sim_addresses[0]);
+	plant->boiler_index = halLinuxAddDs(sim_addresses[1]);
+	plant->exit_index = halLinuxAddDs(sim_addresses[2]);
+
+	plant->battery_t = config->start_t;
+	plant->boiler_t = config->start_t;
+	plant->exit_t = config->start_t;
+	plant->boiler_t_max = config->start_t;
+
+	plant->cloud = 1;
+	plant->cloud_hour = UINT32_MAX;
+	plant->random = config->seed;
+
+	halLinuxSetDs(plant->battery_index, plant->battery_t, true);
+	halLinuxSetDs(plant->boiler_index, plant->boiler_t, true);
+	halLinuxSetDs(plant->exit_index, plant->exit_t, true);
+}
+
+
+void simRun(sim_plant_t* plant, uint32_t duration, uint32_t step, sim_tick_t tick, void* context) {
+	for (uint32_t elapsed = 0;elapsed < duration;elapsed += step) {
+		simStep(plant, step);
+
+		if (tick != NULL) {
+			tick(context);
+		}
+	}
+}
+
+void simStep(sim_plant_t* plant, uint32_t step) {
+	sim_config_t* config = &plant->config;
+	float dt = step * 0.001f;
+	bool pump_flag = halDigitalRead(config->rele_pin) != config->rele_invert_flag;
+
+	if (pump_flag != plant->pump_flag) {
+		// the first start has no cycle before it
+		if ((plant->pump_cycles || !pump_flag) && plant->time - plant->pump_switch_time < config->chatter_time * 1000) {
+			plant->chatter_cycles++;
+		}
+
+		if (pump_flag) {
+			plant->pump_cycles++;
+		}
+
+		plant->pump_flag = pump_flag;
+		plant->pump_switch_time = plant->time;
+	}
+
+	float sun = simSun(plant) * config->collector_area * config->collector_efficiency;
+	float battery_loss = config->collector_loss * (plant->battery_t - config->ambient_t);
+	float boiler_loss = config->boiler_loss * (plant->boiler_t - config->room_t);
+	float boiler_draw = (plant->boiler_t > config->room_t) ? config->boiler_draw : 0;
+	float pump = 0;
+
+	if (pump_flag) {
+		pump = config->pump_flow * SIM_WATER_CP * config->exchanger_efficiency * (plant->battery_t - plant->boiler_t);
+	}
+
+	plant->battery_t += (sun - battery_loss - pump) * dt / (config->collector_mass * SIM_WATER_CP);
+	plant->boiler_t += (pump - boiler_loss - boiler_draw) * dt / (config->boiler_mass * SIM_WATER_CP);
+	plant->exit_t += ((pump_flag ? plant->battery_t : config->ambient_t) - plant->exit_t) * fminf(1, dt / config->pipe_time);
+
+	plant->energy_moved += pump * dt / 3600;
+	plant->energy_collected += sun * dt / 3600;
+	plant->boiler_t_max = fmaxf(plant->boiler_t_max, plant->boiler_t);
+
+	plant->time += step;
+	if (pump_flag) {
+		plant->pump_time += plant->time / 1000 - (plant->time - step) / 1000;
+	}
+	halLinuxAdvanceTime(step);
+
+	halLinuxSetDs(plant->battery_index, plant->battery_t, true);
+	halLinuxSetDs(plant->boiler_index, plant->boiler_t, true);
+	halLinuxSetDs(plant->exit_index, plant->exit_t, true);
+}
+
+
+float simSun(sim_plant_t* plant) {
+	sim_config_t* config = &plant->config;
+	float hour = (plant->time / 1000 % 86400) / 3600.0f;
+
+	if (hour < config->sunrise || hour >= config->sunset) {
+		return 0;
+	}
+
+	if (config->sun_profile == SIM_SUN_CONSTANT) {
+		return config->sun_peak;
+	}
+
+	float sun = config->sun_peak * sinf(M_PI * (hour - config->sunrise) / (config->sunset - config->sunrise));
+
+	if (config->sun_profile == SIM_SUN_CLOUDY) {
+		uint32_t cloud_hour = plant->time / 3600000;
+
+		// one cloud cover per hour from a fixed LCG, so runs repeat
+		if (cloud_hour != plant->cloud_hour) {
+			plant->random = plant->random * 1103515245 + 12345;
+			plant->cloud = 0.2f + 0.8f * ((plant->random >> 16) & 0x7FFF) / 32767.0f;
+			plant->cloud_hour = cloud_hour;
+		}
+
+		sun *= plant->cloud;
+	}
+
+	return sun;
+}
+
+char* simReport(sim_plant_t* plant, char* buffer) {
+	snprintf(buffer, SIM_REPORT_SIZE, "{\"time\":%u,\"pump_cycles\":%u,\"chatter_cycles\":%u,\"pump_time\":%u,\"energy_moved\":%.1f,\"energy_collected\":%.1f,\"boiler_t_max\":%.2f}",
+		plant->time / 1000, plant->pump_cycles, plant->chatter_cycles, plant->pump_time,
+		plant->energy_moved, plant->energy_collected, plant->boiler_t_max);
+
+	return buffer;
+}
+#endif
@@ -0,0 +1,238 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include "timezone.h"
+
+static int32_t daysFromCivil(int32_t year, uint8_t month, uint8_t day) {
+	year -= (month <= 2);
+
+	int32_t era = (year >= 0 ? year : year - 399) / 400;
+	uint32_t year_of_era = year - era * 400;
+	uint32_t day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+	uint32_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+	return era * 146097 + (int32_t) day_of_era - 719468;
+}
+
+static uint8_t daysInMonth(uint16_t year, uint8_t month) {
+	static const uint8_t days[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+	bool leap = (!(year % 4) && (year % 100)) || !(year % 400);
+
+	return (month == 2 && leap) ? 29 : days[month - 1];
+}
+
+static bool parseNumber(const char** text, int32_t* value) {
+	if (!isdigit(**text)) {
+		return false;
+	}
+
+	*value = 0;
+	while (isdigit(**text)) {
+		*value = *value * 10 + (**text - '0');
+		(*text)++;
+	}
+
+	return true;
+}
+
+static bool parseName(const char** text) {
+	const char* start = *text;
+
+	if (**text == '<') {
+		while (**text && **text != '>') {
+			(*text)++;
+		}
+		if (**text != '>') {
+			return false;
+		}
+
+		(*text)++;
+		return true;
+	}
+
+	while (isalpha(**text)) {
+		(*text)++;
+	}
+
+	return *text - start >= 3;
+}
+
+// [+-]hh[:mm[:ss]] in sec
+static bool parseTime(const char** text, int32_t* time) {
+	int32_t sign = 1;
+	int32_t value = 0;
+
+	if (**text == '+' || **text == '-') {
+		sign = (**text == '-') ? -1 : 1;
+		(*text)++;
+	}
+
+	if (!parseNumber(text, &value)) {
+		return false;
+	}
+	*time = value * 3600;
+
+	for (int32_t multiplier = 60;multiplier && **text == ':';multiplier /= 60) {
+		(*text)++;
+
+		if (!parseNumber(text, &value)) {
+			return false;
+		}
+		*time += value * multiplier;
+	}
+
+	*time *= sign;
+	return true;
+}
+
+static bool parseRule(const char** text, timezone_rule_t* rule) {
+	int32_t month, week, weekday;
+
+	if (**text != 'M') {
+		return false;
+	}
+	(*text)++;
+
+	if (!parseNumber(text, &month) || *(*text)++ != '.' || !parseNumber(text, &week) || *(*text)++ != '.' || !parseNumber(text, &weekday)) {
+		return false;
+	}
+
+	if (month < 1 || month > 12 || week < 1 || week > 5 || weekday > 6) {
+		return false;
+	}
+
+	rule->month = month;
+	rule->week = week;
+	rule->weekday = weekday;
+	rule->time = 2 * 3600;
+
+	if (**text == '/') {
+		(*text)++;
+		return parseTime(text, &rule->time);
+	}
+
+	return true;
+}
+
+// UTC moment of the rule in the given year
+static int64_t ruleToUnix(const timezone_rule_t* rule, uint16_t year, int32_t offset) {
+	int32_t first_day = daysFromCivil(year, rule->month, 1);
+	uint8_t first_weekday = (first_day % 7 + 11) % 7; // 01.01.1970 is thursday
+	uint8_t day = 1 + (rule->weekday + 7 - first_weekday) % 7 + (rule->week - 1) * 7;
+
+	while (day > daysInMonth(year, rule->month)) {
+		day -= 7;
+	}
+
+	return (int64_t) (first_day + day - 1) * 86400 + rule->time - offset;
+}
+
+
+bool parseTimezone(const char* text, timezone_t* timezone) {
+	timezone_t result;
+	int32_t offset;
+
+	if (text == NULL || !parseName(&text) || !parseTime(&text, &offset)) {
+		return false;
+	}
+
+	// POSIX offsets are west of UTC
+	makeTimezone(-offset, &result);
+
+	if (*text) {
+		if (!parseName(&text)) {
+			return false;
+		}
+
+		result.dst_flag = true;
+		result.dst_offset = result.std_offset + 3600;
+
+		if (*text && *text != ',') {
+			if (!parseTime(&text, &offset)) {
+				return false;
+			}
+
+			result.dst_offset = -offset;
+		}
+
+		// without rules the US ones are the POSIX default
+		result.dst_start = {3, 2, 0, 2 * 3600};
+		result.dst_end = {11, 1, 0, 2 * 3600};
+
+		if (*text == ',') {
+			text++;
+
+			if (!parseRule(&text, &result.dst_start) || *text++ != ',' || !parseRule(&text, &result.dst_end)) {
+				return false;
+			}
+		}
+
+		if (*text) {
+			return false;
+		}
+	}
+
+	*timezone = result;
+	return true;
+}
+
+void makeTimezone(int32_t offset, timezone_t* timezone) {
+	timezone->std_offset = offset;
+	timezone->dst_offset = offset;
+	timezone->dst_flag = false;
+	timezone->dst_start = {0, 0, 0, 0};
+	timezone->dst_end = {0, 0, 0, 0};
+}
+
+int32_t timezoneOffset(const timezone_t* timezone, uint32_t unix, bool* dst) {
+	bool dst_now = false;
+
+	if (timezone->dst_flag) {
+		local_time_t time;
+		breakTime(unix + timezone->std_offset, &time);
+
+		// the start is given in standard time, the end in daylight time
+		int64_t start = ruleToUnix(&timezone->dst_start, time.year, timezone->std_offset);
+		int64_t end = ruleToUnix(&timezone->dst_end, time.year, timezone->dst_offset);
+
+		dst_now = (start < end) ? (unix >= start && unix < end) : (unix >= start || unix < end);
+	}
+
+	if (dst != NULL) {
+		*dst = dst_now;
+	}
+
+	return dst_now ? timezone->dst_offset : timezone->std_offset;
+}
+
+
+void breakTime(uint32_t unix, local_time_t* time) {
+	int32_t days = unix / 86400;
+	uint32_t seconds = unix % 86400;
+
+	time->hour = seconds / 3600;
+	time->minute = seconds / 60 % 60;
+	time->second = seconds % 60;
+	time->weekday = (days + 4) % 7;
+
+	days += 719468;
+	int32_t era = days / 146097;
+	uint32_t day_of_era = days - era * 146097;
+	uint32_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+	uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+	uint32_t month_index = (5 * day_of_year + 2) / 153;
+
+	time->day = day_of_year - (153 * month_index + 2) / 5 + 1;
+	time->month = month_index < 10 ? month_index + 3 : month_index - 9;
+	time->year = year_of_era + era * 400 + (time->month <= 2);
+}
+
+uint32_t makeTime(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+	return (uint32_t) daysFromCivil(year, month, day) * 86400 + hour * 3600UL + minute * 60 + second;
+}
@@ -10,18 +10,24 @@
 #include "data.h"
 
 void NetworkManager::endBegin() {
-	ui.attachBuild(uiBuild);
-	ui.attach(uiAction);
+	ui.attachBuild([]() {
+		PROFILE(system->getProfiler(), PROFILE_WEB_BUILD, uiBuild());
+	});
+	ui.attach([]() {
+		PROFILE(system->getProfiler(), PROFILE_WEB_ACTION, uiAction());
+	});
 	ui.enableOTA();
+	// GP_GZIP_ASSETS: scripts and styles go out gzipped with an ETag
+	ui.caching(true);
 
 	updateWebBlynkBlock();
 	updateWebSensorsBlock();
 
 	web_update_codes = "HSt,HSh,";
-	web_update_codes += "HSSbat,HSSboi,HSSext,HSSpu,";
-	web_update_codes += "SNm,SNWs,SNAs,SNAp,SBs,SBsdt,SBa,";
-	web_update_codes += "STg,STns,SSrdt,";
-	web_update_codes += "SDar,SDbot,SDf,SSSs,SSSeo,SSSri,SSSd,SSSba,SSSbo,SSSex,SSb";
+	web_update_codes += "HSSbat,HSSboi,HSSext,HSSpu,HSSpt,HSSen,";
+	web_update_codes += "SNm,SNWs,SNWc,SNAs,SNAp,SBs,SBsdt,SBsl,SBa,SBq,";
+	web_update_codes += "STg,STtz,STns,STnt,SSrdt,SSfm,SSfr,SSfs,SSfl,SSfh,";
+	web_update_codes += "SDar,SDbot,SDf,SSSs,SSSeo,SSSri,SSSd,SSSm,SSSh,SSSon,SSSof,SSSkp,SSSki,SSSkd,SSSpw,SSSpr,SSSpt,SSScp,SSSfl,SSSba,SSSbo,SSSex,SSb,SSw,";
 }
 
 
@@ -37,6 +43,8 @@ void NetworkManager::uiBuild() {
 	NetworkManager* network = system->getNetworkManager();
 	BlynkManager* blynk = system->getBlynkManager();
 	String update_codes = web_update_codes;
+	char web_value[WEB_VALUE_SIZE];
+	char ip_string[NETWORK_IP_STRING_SIZE];
 	
 	for (byte i = 0;i < sensors->getDS18B20Count();i++) {
 		update_codes += "HSdsn";
@@ -66,11 +74,12 @@ void NetworkManager::uiBuild() {
 		update_codes += ",";
 		update_codes += "SBLe";
 		update_codes += i;
-
-		if (i != blynk->getLinksCount() - 1) {
-			update_codes += ",";
-		}
+		update_codes += ",";
+		update_codes += "SBLdb";
+		update_codes += i;
+		update_codes += ",";
 	}
+	update_codes.remove(update_codes.length() - 1);
 
 	GP.BUILD_BEGIN(550);
 	GP.THEME(GP_DARK);
@@ -92,7 +101,7 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("T:");
 
 				if (!sensors->getAM2320Status()) {
-					GP.PLAIN(String(sensors->getAM2320T(), 1) + "°", "HSt");
+					GP.PLAIN(makeWebValue(web_value, sensors->getAM2320TCenti(), "°"), "HSt");
 				}
 				else {
 					GP.PLAIN("err", "HSt");
@@ -102,7 +111,7 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("H:");
 
 				if (!sensors->getAM2320Status()) {
-					GP.PLAIN(String(sensors->getAM2320H(), 1) + "%", "HSh");
+					GP.PLAIN(makeWebValue(web_value, sensors->getAM2320HCenti(), "%"), "HSh");
 				}
 				else {
 					GP.PLAIN("err", "HSh");
@@ -115,7 +124,7 @@ void NetworkManager::uiBuild() {
 					GP.LABEL(":");
 					
 					if (!sensors->getDS18B20Status(i)) {
-						GP.PLAIN(String(sensors->getDS18B20T(i), 1) + "°", String("HSdst") + i);
+						GP.PLAIN(makeWebValue(web_value, sensors->getDS18B20TCenti(i), "°"), String("HSdst") + i);
 					}
 					else {
 						GP.PLAIN("err", String("HSdst") + i);
@@ -131,7 +140,7 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Battery:");
 
 				if (!solar->getBatterySensorStatus()) {
-					GP.PLAIN(String(solar->getBatteryT(), 1) + "°", "HSSbat");
+					GP.PLAIN(makeWebValue(web_value, solar->getBatteryTCenti(), "°"), "HSSbat");
 				}
 				else {
 					GP.PLAIN("err", "HSSbat");
@@ -141,7 +150,7 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Boiler:");
 
 				if (!solar->getBoilerSensorStatus()) {
-					GP.PLAIN(String(solar->getBoilerT(), 1) + "°", "HSSboi");
+					GP.PLAIN(makeWebValue(web_value, solar->getBoilerTCenti(), "°"), "HSSboi");
 				}
 				else {
 					GP.PLAIN("err", "HSSboi");
@@ -151,7 +160,7 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Exit:");
 
 				if (!solar->getExitSensorStatus()) {
-					GP.PLAIN(String(solar->getExitT(), 1) + "°", "HSSext");
+					GP.PLAIN(makeWebValue(web_value, solar->getExitTCenti(), "°"), "HSSext");
 				}
 				else {
 					GP.PLAIN("err", "HSSext");
@@ -161,6 +170,14 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Pump:");
 				GP.SWITCH("HSSpu", solar->getReleFlag());
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Pump time:");
+				GP.PLAIN(makeWebPumpTime(), "HSSpt");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Energy:");
+				GP.PLAIN(makeWebEnergy(), "HSSen");
+			);
 		);
 
 		GP.HR();
@@ -183,6 +200,20 @@ void NetworkManager::uiBuild() {
 					GP.TEXT("SNWs", "ssid", network->getWifiSsid(), "50%", NETWORK_SSID_PASS_SIZE);
 					GP.PASS_EYE("SNWp", "pass", "", "", NETWORK_SSID_PASS_SIZE);
 					GP.BREAK();
+					GP.PLAIN(makeWebConnectState(), "SNWc");
+					GP.SUBMIT_MINI(" OK ", GP_ORANGE);
+				);
+			);
+			M_FORM2("/SNI",
+				M_BLOCK(GP_THIN,
+					GP.TITLE("IP");
+					GP.SELECT("SNim", "dhcp,static,cached", network->getIpMode());
+					GP.BREAK();
+					GP.TEXT("SNia", "ip", network->getIpConfigString(NETWORK_IP_ADDRESS, ip_string), "50%", NETWORK_IP_STRING_SIZE);
+					GP.TEXT("SNig", "gateway", network->getIpConfigString(NETWORK_IP_GATEWAY, ip_string), "50%", NETWORK_IP_STRING_SIZE);
+					GP.TEXT("SNin", "mask", network->getIpConfigString(NETWORK_IP_SUBNET, ip_string), "50%", NETWORK_IP_STRING_SIZE);
+					GP.TEXT("SNid", "dns", network->getIpConfigString(NETWORK_IP_DNS, ip_string), "50%", NETWORK_IP_STRING_SIZE);
+					GP.BREAK();
 					GP.SUBMIT_MINI(" OK ", GP_ORANGE);
 				);
 			);
@@ -204,10 +235,19 @@ void NetworkManager::uiBuild() {
 				GP.NUMBER("SBsdt", "time", blynk->getSendDataTime(), "25%");
 				GP.PLAIN("sec");
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Max silence:");
+				GP.NUMBER("SBsl", "time", blynk->getSilenceTime(), "25%");
+				GP.PLAIN("sec");
+			);
 			M_BOX(GP_LEFT,
 				GP.LABEL("Auth:");
 				GP.TEXT("SBa", "auth", blynk->getAuth(), "100%", BLYNK_AUTH_SIZE);
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Offline queue:");
+				GP.PLAIN(makeWebBlynkQueue(), "SBq");
+			);
 
 			M_BLOCK(GP_THIN,
 				GP.TITLE("Links");
@@ -221,6 +261,7 @@ void NetworkManager::uiBuild() {
 						GP.LABEL("V");
 						GP.NUMBER(String("SBLp") + i, "port", blynk->getLinkPort(i), "30%");
 						GP.SELECT(String("SBLe") + i, web_blynk.element_codes_string, index);
+						GP.NUMBER_F(String("SBLdb") + i, "deadband", blynk->getLinkDeadband(i) / 100.0f, 2, "20%");
 						GP.BUTTON(String("SBLd") + i, "Delete", "", GP_ORANGE, "20%", false, true);
 					);
 				}
@@ -240,10 +281,29 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Gmt:");
 				GP.NUMBER("STg", "gmt", time->getGmt(), "25%");
 			);
+
+			M_BOX(GP_LEFT,
+				GP.LABEL("Timezone:");
+				GP.TEXT("STtz", "posix tz", time->getTimezone(), "50%", TIMEZONE_SIZE - 1);
+			);
+
+			if (time->getNtpFlag()) {
+				M_FORM2("/STN",
+					M_BLOCK(GP_THIN,
+						GP.TITLE("Ntp servers");
+						for (uint8_t i = 0;i < NTP_SERVERS_COUNT;i++) {
+							GP.TEXT(String("SNns") + i, "host[:port]", network->getNtpClient()->getServer(i), "", NTP_SERVER_SIZE - 1);
+						}
+						GP.BREAK();
+						GP.PLAIN(makeWebNtpState(), "STnt");
+						GP.SUBMIT_MINI(" OK ", GP_ORANGE);
+					);
+				);
+			}
 			
 			if (!time->getNtpFlag()) {
-				GP.TIME("STt", GPtime((uint32_t)time->getUnix(), time->getGmt()) );
-				GP.DATE("STd", GPdate((uint32_t)time->getUnix(), time->getGmt()) );
+				GP.TIME("STt", GPtime(time->hour(), time->minute(), time->second()) );
+				GP.DATE("STd", GPdate(time->year(), time->month(), time->day()) );
 			}
 		);
 		GP.BREAK();
@@ -255,6 +315,31 @@ void NetworkManager::uiBuild() {
 				GP.PLAIN("sec");
 			);
 
+			M_BLOCK(GP_THIN,
+				GP.TITLE("Filter");
+
+				M_BOX(GP_LEFT,
+					GP.LABEL("Median:");
+					GP.NUMBER("SSfm", "readings", sensors->getFilterMedian(), "25%");
+				);
+				M_BOX(GP_LEFT,
+					GP.LABEL("Rate max:");
+					GP.NUMBER("SSfr", "rate", sensors->getFilterRate(), "25%");
+					GP.PLAIN("°/min");
+				);
+				M_BOX(GP_LEFT,
+					GP.LABEL("Stuck time:");
+					GP.NUMBER("SSfs", "time", sensors->getFilterStuckTime(), "25%");
+					GP.PLAIN("min");
+				);
+				M_BOX(GP_LEFT,
+					GP.LABEL("Range:");
+					GP.NUMBER("SSfl", "min", sensors->getFilterRangeMin(), "25%");
+					GP.NUMBER("SSfh", "max", sensors->getFilterRangeMax(), "25%");
+					GP.PLAIN("°");
+				);
+			);
+
 			M_BLOCK(GP_THIN,
 				GP.TITLE("DS18B20");
 				GP.BUTTON("SSDSs", "Scan", "", GP_ORANGE, "45%", false, true);
@@ -313,7 +398,7 @@ void NetworkManager::uiBuild() {
 		GP.BREAK();
 
 		M_SPOILER("Solar system", GP_ORANGE,
-			char select_array[20] = "NONE,";
+			char select_array[WEB_SENSORS_SELECT_SIZE] = "NONE,";
 
 			for (uint8_t i = 0;i < sensors->getDS18B20Count();i++) {
 				strcat(select_array, sensors->getDS18B20Name(i));
@@ -340,6 +425,48 @@ void NetworkManager::uiBuild() {
 				GP.NUMBER("SSSd", "delta", solar->getDelta(), "25%");
 				GP.PLAIN("°");
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Mode:");
+				GP.SELECT("SSSm", "bang-bang,hysteresis,pid", solar->getMode());
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Hysteresis:");
+				GP.NUMBER("SSSh", "hysteresis", solar->getHysteresis(), "25%");
+				GP.PLAIN("°");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Min on/off:");
+				GP.NUMBER("SSSon", "on", solar->getMinOnTime(), "25%");
+				GP.NUMBER("SSSof", "off", solar->getMinOffTime(), "25%");
+				GP.PLAIN("s");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Kp/Ki/Kd:");
+				GP.NUMBER_F("SSSkp", "kp", solar->getPidKp(), 2, "20%");
+				GP.NUMBER_F("SSSki", "ki", solar->getPidKi(), 2, "20%");
+				GP.NUMBER_F("SSSkd", "kd", solar->getPidKd(), 2, "20%");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Window:");
+				GP.NUMBER("SSSpw", "window", solar->getPidWindow(), "25%");
+				GP.PLAIN("s");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Predict:");
+				GP.SWITCH("SSSpr", solar->getPredictFlag());
+				GP.NUMBER("SSSpt", "min", solar->getPredictTime(), "25%");
+				GP.PLAIN("min");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Flow:");
+				GP.NUMBER_F("SSSfl", "flow", solar->getLoop(SOLAR_MAIN_LOOP)->flow / 10.0f, 1, "25%");
+				GP.PLAIN("l/min");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Fluid cp:");
+				GP.NUMBER("SSScp", "cp", solar->getFluidCp(), "25%");
+				GP.PLAIN("J/kgK");
+			);
 			M_BOX(GP_LEFT,
 				GP.LABEL("Battery:");
 				GP.SELECT("SSSba", select_array, solar->getBatterySensor() + 1);
@@ -352,6 +479,49 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Exit:");
 				GP.SELECT("SSSex", select_array, solar->getExitSensor() + 1);
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Pump time:");
+				GP.BUTTON("SSSjc", "Clear", "", GP_ORANGE, "25%");
+			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Energy:");
+				GP.BUTTON("SSSec", "Clear", "", GP_ORANGE, "25%");
+			);
+
+			M_BLOCK(GP_THIN,
+				GP.TITLE("Loops");
+
+				for (uint8_t i = SOLAR_MAIN_LOOP + 1;i < solar->getLoopsCount();i++) {
+					solar_loop_t* loop = solar->getLoop(i);
+
+					M_BOX(GP_LEFT,
+						GP.LABEL("Source:");
+						GP.SELECT(String("SSSLs") + i, select_array, loop->source + 1);
+					);
+					M_BOX(GP_LEFT,
+						GP.LABEL("Sink:");
+						GP.SELECT(String("SSSLk") + i, select_array, loop->sink + 1);
+					);
+					M_BOX(GP_LEFT,
+						GP.NUMBER(String("SSSLd") + i, "delta", loop->delta, "20%");
+						GP.NUMBER(String("SSSLh") + i, "hysteresis", loop->hysteresis, "20%");
+						GP.SELECT(String("SSSLp") + i, LOOP_PORTS_NAMES, solar->scanLoopPortIndex(loop->pin));
+						GP.SWITCH(String("SSSLi") + i, loop->invert_flag);
+					);
+					M_BOX(GP_LEFT,
+						GP.LABEL("Flow:");
+						GP.NUMBER_F(String("SSSLf") + i, "flow", loop->flow / 10.0f, 1, "25%");
+						GP.PLAIN("l/min");
+					);
+					M_BOX(GP_LEFT,
+						GP.SELECT(String("SSSLm") + i, "bang-bang,hysteresis,pid", loop->mode);
+						GP.BUTTON(String("SSSLx") + i, "Delete", "", GP_ORANGE, "20%", false, true);
+					);
+					GP.HR();
+				}
+
+				GP.BUTTON("SSSLn", "New loop", "", GP_ORANGE, "45%", false, true);
+			);
 		);
 		GP.BREAK();
 
@@ -360,6 +530,11 @@ void NetworkManager::uiBuild() {
 				GP.LABEL("Buzzer:");
 				GP.SWITCH("SSb", system->getBuzzerFlag());
 			);
+			M_BOX(GP_LEFT,
+				GP.LABEL("Watchdog:");
+				GP.PLAIN(makeWebWatchdog(), "SSw");
+				GP.BUTTON("SSwc", "Clear", "", GP_ORANGE, "25%");
+			);
 			
 			M_BLOCK(GP_THIN,
 				GP.TITLE("Management");
@@ -390,15 +565,16 @@ void NetworkManager::uiAction() {
 	DisplayManager* display = system->getDisplayManager();
 	NetworkManager* network = system->getNetworkManager();
 	BlynkManager* blynk = system->getBlynkManager();
+	char web_value[WEB_VALUE_SIZE];
 
 	/* --- Home --- */
 	// update
 	if (ui.update("HSt")) {
-		ui.answer(!sensors->getAM2320Status() ? String(sensors->getAM2320T(), 1) + "°" : String("err"));
+		ui.answer(!sensors->getAM2320Status() ? makeWebValue(web_value, sensors->getAM2320TCenti(), "°") : "err");
 		return;
 	}
 	if (ui.update("HSh")) {
-		ui.answer(!sensors->getAM2320Status() ? String(sensors->getAM2320H(), 1) + "%" : String("err"));
+		ui.answer(!sensors->getAM2320Status() ? makeWebValue(web_value, sensors->getAM2320HCenti(), "%") : "err");
 		return;
 	}
 	
@@ -409,32 +585,40 @@ void NetworkManager::uiAction() {
 			return;
 		}
 		if (ui.update(String("HSdst") + i)) {
-			ui.answer(!sensors->getDS18B20Status(i) ? String(sensors->getDS18B20T(i), 1) + "°" : String("err"));
+			ui.answer(!sensors->getDS18B20Status(i) ? makeWebValue(web_value, sensors->getDS18B20TCenti(i), "°") : "err");
 			return;
 		}
 	}
 
 	if (ui.update("HSSbat")) {
-		ui.answer(!solar->getBatterySensorStatus() ? String(solar->getBatteryT(), 1) + "°" : String("err"));
+		ui.answer(!solar->getBatterySensorStatus() ? makeWebValue(web_value, solar->getBatteryTCenti(), "°") : "err");
 		return;
 	}
 	if (ui.update("HSSboi")) {
-		ui.answer(!solar->getBoilerSensorStatus() ? String(solar->getBoilerT(), 1) + "°" : String("err"));
+		ui.answer(!solar->getBoilerSensorStatus() ? makeWebValue(web_value, solar->getBoilerTCenti(), "°") : "err");
 		return;
 	}
 	if (ui.update("HSSext")) {
-		ui.answer(!solar->getExitSensorStatus() ? String(solar->getExitT(), 1) + "°" : String("err"));
+		ui.answer(!solar->getExitSensorStatus() ? makeWebValue(web_value, solar->getExitTCenti(), "°") : "err");
 		return;
 	}
 	if (ui.update("HSSpu")) {
 		ui.answer(solar->getReleFlag());
 		return;
 	}
+	if (ui.update("HSSpt")) {
+		ui.answer(makeWebPumpTime());
+		return;
+	}
+	if (ui.update("HSSen")) {
+		ui.answer(makeWebEnergy());
+		return;
+	}
 
 	// parse
 	if (ui.click("HSSpu")) {
 		bool state = ui.getBool();
-		solar->setReleFlag(state);
+		solar->setReleFlag(state, RELE_REASON_WEB);
 		
 		return;
 	}
@@ -455,6 +639,10 @@ void NetworkManager::uiAction() {
 		ui.answer(network->getWifiSsid());
 		return;
 	}
+	if (ui.update("SNWc")) {
+		ui.answer(makeWebConnectState());
+		return;
+	}
 
 	if (ui.update("SNAs")) {
 		ui.answer(network->getApSsid());
@@ -478,7 +666,21 @@ void NetworkManager::uiAction() {
 		ui.copyStr("SNWs", read_ssid, NETWORK_SSID_PASS_SIZE);
 		ui.copyStr("SNWp", read_pass, NETWORK_SSID_PASS_SIZE);
 
-		network->setWifi(read_ssid, read_pass);
+		network->beginConnect(read_ssid, read_pass, NETWORK_CONNECT_TIME, true);
+		return;
+	}
+
+	if (ui.form("/SNI")) {
+		const char* ip_config_codes[NETWORK_IP_CONFIG_COUNT] = {"SNia", "SNig", "SNin", "SNid"};
+		char read_address[NETWORK_IP_STRING_SIZE];
+
+		network->setIpMode(ui.getInt("SNim"));
+		for (uint8_t i = 0;i < NETWORK_IP_CONFIG_COUNT;i++) {
+			ui.copyStr(ip_config_codes[i], read_address, NETWORK_IP_STRING_SIZE);
+			network->setIpConfig(i, read_address);
+		}
+
+		network->reconnect();
 		return;
 	}
 
@@ -506,10 +708,18 @@ void NetworkManager::uiAction() {
 		ui.answer(blynk->getSendDataTime());
 		return;
 	}
+	if (ui.update("SBsl")) {
+		ui.answer(blynk->getSilenceTime());
+		return;
+	}
 	if (ui.update("SBa")) {
 		ui.answer(blynk->getAuth());
 		return;
 	}
+	if (ui.update("SBq")) {
+		ui.answer(makeWebBlynkQueue());
+		return;
+	}
 
 	for (uint8_t i = 0;i < blynk->getLinksCount();i++) {
 		if (ui.update(String("SBLp") + i)) {
@@ -524,6 +734,10 @@ void NetworkManager::uiAction() {
 			ui.answer(index);
 			return;
 		}
+		if (ui.update(String("SBLdb") + i)) {
+			ui.answer(blynk->getLinkDeadband(i) / 100.0f, 2);
+			return;
+		}
 	}
 
 	// parse
@@ -535,6 +749,10 @@ void NetworkManager::uiAction() {
 		blynk->setSendDataTime(ui.getInt());
 		return;
 	}
+	if (ui.click("SBsl")) {
+		blynk->setSilenceTime(constrain(ui.getInt(), 0, BLYNK_SILENCE_TIME_MAX));
+		return;
+	}
 	if (ui.click("SBa")) {
 		blynk->setAuth(ui.getString());
 		return;
@@ -564,6 +782,10 @@ void NetworkManager::uiAction() {
 			
 			return;
 		}
+		if (ui.click(String("SBLdb") + i)) {
+			blynk->setLinkDeadband(i, constrain(floatToCenti(ui.getFloat()), 0, INT16_MAX));
+			return;
+		}
 		if (ui.click(String("SBLd") + i)) {
 			blynk->deleteLink(i);
 			return;
@@ -581,6 +803,14 @@ void NetworkManager::uiAction() {
 		ui.answer(time->getGmt());
 		return;
 	}
+	if (ui.update("STtz")) {
+		ui.answer(time->getTimezone());
+		return;
+	}
+	if (ui.update("STnt")) {
+		ui.answer(makeWebNtpState());
+		return;
+	}
 
 	// parse
 	if (ui.click("STns")) {
@@ -591,6 +821,21 @@ void NetworkManager::uiAction() {
 		time->setGmt(constrain(ui.getInt(), -12, 12));
 		return;
 	}
+	if (ui.click("STtz")) {
+		time->setTimezone(ui.getString().c_str());
+		return;
+	}
+
+	if (ui.form("/STN")) {
+		char read_server[NTP_SERVER_SIZE];
+
+		for (uint8_t i = 0;i < NTP_SERVERS_COUNT;i++) {
+			ui.copyStr(String("SNns") + i, read_server, NTP_SERVER_SIZE);
+			network->getNtpClient()->setServer(i, read_server);
+		}
+
+		return;
+	}
 
 	if (ui.click("STt")) {
 		GPtime get_time = ui.getTime();
@@ -612,6 +857,26 @@ void NetworkManager::uiAction() {
 		ui.answer(sensors->getReadDataTime());
 		return;
 	}
+	if (ui.update("SSfm")) {
+		ui.answer(sensors->getFilterMedian());
+		return;
+	}
+	if (ui.update("SSfr")) {
+		ui.answer(sensors->getFilterRate());
+		return;
+	}
+	if (ui.update("SSfs")) {
+		ui.answer(sensors->getFilterStuckTime());
+		return;
+	}
+	if (ui.update("SSfl")) {
+		ui.answer(sensors->getFilterRangeMin());
+		return;
+	}
+	if (ui.update("SSfh")) {
+		ui.answer(sensors->getFilterRangeMax());
+		return;
+	}
 
 	for (byte i = 0;i < sensors->getDS18B20Count();i++) {
 		if (ui.update(String("SSDSn") + i)) {
@@ -645,6 +910,26 @@ void NetworkManager::uiAction() {
 		sensors->setReadDataTime(ui.getInt());
 		return;
 	}
+	if (ui.click("SSfm")) {
+		sensors->setFilterMedian(constrain(ui.getInt(), 1, DS_MEDIAN_MAX));
+		return;
+	}
+	if (ui.click("SSfr")) {
+		sensors->setFilterRate(constrain(ui.getInt(), 0, DS_FILTER_RATE_MAX));
+		return;
+	}
+	if (ui.click("SSfs")) {
+		sensors->setFilterStuckTime(constrain(ui.getInt(), 0, DS_FILTER_STUCK_TIME_MAX));
+		return;
+	}
+	if (ui.click("SSfl")) {
+		sensors->setFilterRange(constrain(ui.getInt(), -55, 125), sensors->getFilterRangeMax());
+		return;
+	}
+	if (ui.click("SSfh")) {
+		sensors->setFilterRange(sensors->getFilterRangeMin(), constrain(ui.getInt(), -55, 125));
+		return;
+	}
 	if (ui.click("SSDSs")) {
 		updateWebSensorsBlock();
 		return;
@@ -737,6 +1022,54 @@ void NetworkManager::uiAction() {
 		ui.answer(solar->getDelta());
 		return;
 	}
+	if (ui.update("SSSm")) {
+		ui.answer(solar->getMode());
+		return;
+	}
+	if (ui.update("SSSh")) {
+		ui.answer(solar->getHysteresis());
+		return;
+	}
+	if (ui.update("SSSon")) {
+		ui.answer(solar->getMinOnTime());
+		return;
+	}
+	if (ui.update("SSSof")) {
+		ui.answer(solar->getMinOffTime());
+		return;
+	}
+	if (ui.update("SSSkp")) {
+		ui.answer(solar->getPidKp(), 2);
+		return;
+	}
+	if (ui.update("SSSki")) {
+		ui.answer(solar->getPidKi(), 2);
+		return;
+	}
+	if (ui.update("SSSkd")) {
+		ui.answer(solar->getPidKd(), 2);
+		return;
+	}
+	if (ui.update("SSSpw")) {
+		ui.answer(solar->getPidWindow());
+		return;
+	}
+	if (ui.update("SSSpr")) {
+		ui.answer(solar->getPredictFlag());
+		return;
+	}
+	if (ui.update("SSSpt")) {
+		ui.answer(solar->getPredictTime());
+		return;
+	}
+	if (ui.update("SSSfl")) {
+		ui.answer(solar->getLoop(SOLAR_MAIN_LOOP)->flow / 10.0f, 1);
+		return;
+	}
+	if (ui.update("SSScp")) {
+		ui.answer(solar->getFluidCp());
+		return;
+	}
 
 	if (ui.update("SSSba")) {
 		ui.answer(solar->getBatterySensor() + 1);
@@ -769,6 +1102,54 @@ void NetworkManager::uiAction() {
 		solar->setDelta(ui.getInt());
 		return;
 	}
+	if (ui.click("SSSm")) {
+		solar->setMode(ui.getInt());
+		return;
+	}
+	if (ui.click("SSSh")) {
+		solar->setHysteresis(ui.getInt());
+		return;
+	}
+	if (ui.click("SSSon")) {
+		solar->setMinOnTime(constrain(ui.getInt(), 0, SOLAR_DWELL_TIME_MAX));
+		return;
+	}
+	if (ui.click("SSSof")) {
+		solar->setMinOffTime(constrain(ui.getInt(), 0, SOLAR_DWELL_TIME_MAX));
+		return;
+	}
+	if (ui.click("SSSkp")) {
+		solar->setPidKp(ui.getFloat());
+		return;
+	}
+	if (ui.click("SSSki")) {
+		solar->setPidKi(ui.getFloat());
+		return;
+	}
+	if (ui.click("SSSkd")) {
+		solar->setPidKd(ui.getFloat());
+		return;
+	}
+	if (ui.click("SSSpw")) {
+		solar->setPidWindow(constrain(ui.getInt(), SOLAR_PID_WINDOW_MIN, SOLAR_PID_WINDOW_MAX));
+		return;
+	}
+	if (ui.click("SSSpr")) {
+		solar->setPredictFlag(ui.getBool());
+		return;
+	}
+	if (ui.click("SSSpt")) {
+		solar->setPredictTime(constrain(ui.getInt(), 1, SOLAR_PREDICT_TIME_MAX));
+		return;
+	}
+	if (ui.click("SSSfl")) {
+		solar->setLoopFlow(SOLAR_MAIN_LOOP, constrain(floatToCenti(ui.getFloat()) / 10, 0, SOLAR_FLOW_MAX));
+		return;
+	}
+	if (ui.click("SSScp")) {
+		solar->setFluidCp(constrain(ui.getInt(), SOLAR_FLUID_CP_MIN, SOLAR_FLUID_CP_MAX));
+		return;
+	}
 	
 	if (ui.click("SSSba")) {
 		solar->setBatterySensor(ui.getInt() - 1);
@@ -782,6 +1163,58 @@ void NetworkManager::uiAction() {
 		solar->setExitSensor(ui.getInt() - 1);
 		return;
 	}
+
+	if (ui.click("SSSjc")) {
+		solar->getJournal()->clearCounters();
+		return;
+	}
+	if (ui.click("SSSec")) {
+		solar->getEnergyMeter()->clear();
+		return;
+	}
+	if (ui.click("SSSLn")) {
+		solar->addLoop();
+		return;
+	}
+
+	for (uint8_t i = SOLAR_MAIN_LOOP + 1;i < solar->getLoopsCount();i++) {
+		if (ui.click(String("SSSLs") + i)) {
+			solar->setLoopSource(i, ui.getInt() - 1);
+			return;
+		}
+		if (ui.click(String("SSSLk") + i)) {
+			solar->setLoopSink(i, ui.getInt() - 1);
+			return;
+		}
+		if (ui.click(String("SSSLd") + i)) {
+			solar->setLoopDelta(i, constrain(ui.getInt(), SOLAR_DELTA_MIN, SOLAR_DELTA_MAX));
+			return;
+		}
+		if (ui.click(String("SSSLh") + i)) {
+			solar->setLoopHysteresis(i, constrain(ui.getInt(), SOLAR_HYSTERESIS_MIN, SOLAR_HYSTERESIS_MAX));
+			return;
+		}
+		if (ui.click(String("SSSLp") + i)) {
+			solar->setLoopPin(i, loop_ports[constrain(ui.getInt(), 0, LOOP_PORTS_COUNT - 1)]);
+			return;
+		}
+		if (ui.click(String("SSSLf") + i)) {
+			solar->setLoopFlow(i, constrain(floatToCenti(ui.getFloat()) / 10, 0, SOLAR_FLOW_MAX));
+			return;
+		}
+		if (ui.click(String("SSSLi") + i)) {
+			solar->setLoopInvertFlag(i, ui.getBool());
+			return;
+		}
+		if (ui.click(String("SSSLm") + i)) {
+			solar->setLoopMode(i, ui.getInt());
+			return;
+		}
+		if (ui.click(String("SSSLx") + i)) {
+			solar->deleteLoop(i);
+			return;
+		}
+	}
 	/* --- SolarSystemManager --- */
 
 	/* --- SystemManager --- */
@@ -790,12 +1223,20 @@ void NetworkManager::uiAction() {
 		ui.answer(system->getBuzzerFlag());
 		return;
 	}
+	if (ui.update("SSw")) {
+		ui.answer(makeWebWatchdog());
+		return;
+	}
 
 	// parse
 	if (ui.click("SSb")) {
 		system->setBuzzerFlag(ui.getBool());
 		return;
 	}	
+	if (ui.click("SSwc")) {
+		solar->getWatchdog()->clear();
+		return;
+	}
 
 	if (ui.click("SSMr")) {
 		ESP.reset();
@@ -836,6 +1277,76 @@ void NetworkManager::updateWebSensorsBlock() {
 	}
 }
 
+char* NetworkManager::makeWebValue(char* buffer, int16_t centi, const char* unit) {
+	centiToString(centi, 1, buffer);
+	strcat(buffer, unit);
+
+	return buffer;
+}
+
+const char* NetworkManager::makeWebConnectState() {
+	static char state[16];
+	NetworkManager* network = system->getNetworkManager();
+
+	switch (network->getConnectState()) {
+	case NETWORK_CONNECT_PENDING:
+		sprintf(state, "connecting %us", network->getConnectTimeLeft());
+		return state;
+	case NETWORK_CONNECT_FAIL:
+		return "failed";
+	}
+
+	return (network->getStatus() == WL_CONNECTED) ? "connected" : "offline";
+}
+
+const char* NetworkManager::makeWebBlynkQueue() {
+	static char state[32];
+	BlynkQueue* queue = system->getBlynkManager()->getQueue();
+
+	sprintf(state, "%u records, %u dropped", queue->getCount(), queue->getDropCount());
+	return state;
+}
+
+const char* NetworkManager::makeWebPumpTime() {
+	static char state[32];
+	ReleJournal* journal = system->getSolarSystemManager()->getJournal();
+	uint32_t run_time = journal->getRunTime(SOLAR_MAIN_LOOP);
+
+	sprintf(state, "%lu.%lu h, %lu starts", (unsigned long) (run_time / 3600), (unsigned long) (run_time % 3600 / 360), (unsigned long) journal->getStarts(SOLAR_MAIN_LOOP));
+	return state;
+}
+
+const char* NetworkManager::makeWebEnergy() {
+	static char state[64];
+	EnergyMeter* energy = system->getSolarSystemManager()->getEnergyMeter();
+
+	sprintf(state, "%lu W, day %lu.%02lu, month %lu, total %lu kWh", (unsigned long) energy->getPower(),
+		(unsigned long) (energy->getDayEnergy() / 1000), (unsigned long) (energy->getDayEnergy() % 1000 / 10),
+		(unsigned long) (energy->getMonthEnergy() / 1000), (unsigned long) (energy->getLifetimeEnergy() / 1000));
+	return state;
+}
+
+const char* NetworkManager::makeWebWatchdog() {
+	static char state[WEB_WATCHDOG_STATE_SIZE];
+	SafetyWatchdog* watchdog = system->getSolarSystemManager()->getWatchdog();
+
+	snprintf(state, WEB_WATCHDOG_STATE_SIZE, "%lu stalls (max %lu sec), %lu resets", (unsigned long) watchdog->getStallCount(),
+		(unsigned long) watchdog->getStallTimeMax(), (unsigned long) watchdog->getResetCount());
+	return state;
+}
+
+const char* NetworkManager::makeWebNtpState() {
+	static char state[WEB_NTP_STATE_SIZE];
+	NtpClient* ntp = system->getNetworkManager()->getNtpClient();
+
+	if (!ntp->getStratum()) {
+		return "not synced";
+	}
+
+	snprintf(state, WEB_NTP_STATE_SIZE, "offset %ld ms, rtt %u ms, stratum %u, drift %ld ppb", (long) ntp->getOffset(), ntp->getDelay(), ntp->getStratum(), (long) system->getTimeManager()->getDrift());
+	return state;
+}
+
 String NetworkManager::web_update_codes = String();
 NetworkManager::web_sensors_block_t NetworkManager::web_sensors = web_sensors_block_t();
 NetworkManager::web_blynk_block_t NetworkManager::web_blynk = web_blynk_block_t();
\ No newline at end of file
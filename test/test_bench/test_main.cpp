@@ -0,0 +1,367 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <time.h>
+#include <malloc.h>
+#include <unity.h>
+#include "data.h"
+#include "hal_linux.h"
+#include <ESP8266WebServer.h>
+#include <Wire.h>
+
+/*
+ * The settings, web and render hot paths of the firmware on the host. Every
+ * case runs BENCH_RUNS times and reports the time and the heap calls of one
+ * run. The numbers go out as one JSON line, "pio test -e native -f test_bench"
+ * keeps them for the release they were taken on.
+ */
+
+#define BENCH_RUNS 200
+#define BENCH_SENSORS_COUNT 10
+#define BENCH_LINKS_COUNT 20
+#define BENCH_CASES_MAX 8
+#define BENCH_UNIX 1735689600 // 01.01.2025
+#define BENCH_JSON_SIZE 1024
+
+struct bench_result_t {
+	const char* name;
+	uint32_t runs;
+	uint64_t time; // ns
+	uint64_t time_max; // ns
+	uint64_t allocs;
+	uint64_t alloc_bytes;
+	uint32_t output; // bytes of the file, the page or the LCD frame, records of the send
+};
+
+struct bench_counter_t {
+	uint64_t allocs;
+	uint64_t bytes;
+	bool on_flag;
+};
+
+extern SystemManager systemManager;
+
+static bench_counter_t counter;
+static bench_result_t results[BENCH_CASES_MAX];
+static uint8_t results_count = 0;
+
+/* --- heap --- */
+// every heap call of the firmware and the libs goes through these, a sanitizer build keeps its own heap and counts nothing
+#ifndef __SANITIZE_ADDRESS__
+extern "C" void* __libc_malloc(size_t size);
+extern "C" void* __libc_calloc(size_t count, size_t size);
+extern "C" void* __libc_realloc(void* pointer, size_t size);
+extern "C" void __libc_free(void* pointer);
+
+static void count(size_t size) {
+	if (counter.on_flag) {
+		counter.allocs++;
+		counter.bytes += size;
+	}
+}
+
+extern "C" void* malloc(size_t size) {
+	count(size);
+	return __libc_malloc(size);
+}
+
+extern "C" void* calloc(size_t count_value, size_t size) {
+	count(count_value * size);
+	return __libc_calloc(count_value, size);
+}
+
+extern "C" void* realloc(void* pointer, size_t size) {
+	count(size);
+	return __libc_realloc(pointer, size);
+}
+
+extern "C" void free(void* pointer) {
+	__libc_free(pointer);
+}
+#endif
+
+/* --- measuring --- */
+uint64_t hostNanos() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000ULL + now.tv_nsec;
+}
+
+bench_result_t* beginResult(const char* name) {
+	bench_result_t* result = &results[results_count++];
+
+	memset(result, 0, sizeof(bench_result_t));
+	result->name = name;
+
+	return result;
+}
+
+void beginRun() {
+	counter.allocs = 0;
+	counter.bytes = 0;
+	counter.on_flag = true;
+}
+
+void endRun(bench_result_t* result, uint64_t begin_time) {
+	uint64_t time = hostNanos() - begin_time;
+
+	counter.on_flag = false;
+
+	result->runs++;
+	result->time += time;
+	result->time_max = max(result->time_max, time);
+	result->allocs += counter.allocs;
+	result->alloc_bytes += counter.bytes;
+}
+
+// {"runs":n,"save_settings":{"avg_us":..,"max_us":..,"allocs":..,"alloc_bytes":..,"output":..},...}
+char* makeJson(char* buffer, uint16_t size) {
+	uint16_t length = snprintf(buffer, size, "{\"runs\":%u", BENCH_RUNS);
+
+	for (uint8_t i = 0;i < results_count && length < size;i++) {
+		bench_result_t* result = &results[i];
+		uint32_t runs = max(result->runs, (uint32_t) 1);
+
+		length += snprintf(buffer + length, size - length, ",\"%s\":{\"avg_us\":%.2f,\"max_us\":%.2f,\"allocs\":%.2f,\"alloc_bytes\":%.1f,\"output\":%u}",
+			result->name, result->time / 1000.0 / runs, result->time_max / 1000.0, (double) result->allocs / runs, (double) result->alloc_bytes / runs, result->output);
+	}
+
+	if (length + 1 < size) {
+		strcat(buffer, "}");
+	}
+
+	return buffer;
+}
+
+uint16_t countChar(const String& string, char c) {
+	uint16_t result = 0;
+
+	for (uint16_t i = 0;i < string.length();i++) {
+		result += (string[i] == c);
+	}
+
+	return result;
+}
+
+/* --- firmware --- */
+void run(uint32_t time) {
+	for (uint32_t i = 0;i < time / 100;i++) {
+		halLinuxAdvanceTime(100);
+		systemManager.tick();
+	}
+}
+
+// 10 sensors and 20 links, the page and the settings file at their largest
+void begin() {
+	SensorsManager* sensors = systemManager.getSensorsManager();
+	BlynkManager* blynk = systemManager.getBlynkManager();
+	DynamicArray<String> codes;
+
+	halLinuxSetVirtualTime(true, 1000);
+	halFsBegin();
+	halFileRemove(SETTINGS_FILE);
+	halFileRemove(BLYNK_QUEUE_FILE);
+
+	systemManager.begin();
+	systemManager.getTimeManager()->setUnix(BENCH_UNIX);
+
+	for (uint8_t i = 0;i < BENCH_SENSORS_COUNT;i++) {
+		uint8_t address[HAL_DS_ADDRESS_SIZE] = {0x28, i, 0, 0, 0, 0, 0, (uint8_t) (0x10 + i)};
+		char name[DS_NAME_SIZE];
+
+		halLinuxSetDs(halLinuxAddDs(address), 20 + i * 3.5, true);
+		sensors->addDS18B20();
+		sensors->setDS18B20Address(i, address);
+
+		sprintf(name, "s%u", i);
+		sensors->setDS18B20Name(i, name);
+	}
+
+	systemManager.getSolarSystemManager()->setBatterySensor(0);
+	systemManager.getSolarSystemManager()->setBoilerSensor(1);
+	systemManager.getSolarSystemManager()->setExitSensor(2);
+
+	systemManager.makeBlynkElementCodesList(&codes);
+
+	// 10 sensors give 18 elements, the last links send the first ones to other ports
+	for (uint8_t i = 0;i < BENCH_LINKS_COUNT;i++) {
+		blynk->addLink();
+		blynk->setLinkElementCode(i, codes[i % codes.size()]);
+	}
+
+	// every value goes out on every send, to the queue while there is no server
+	blynk->setAuth("0123456789abcdef0123456789abcdef");
+	blynk->setSendDataTime(1);
+	blynk->setSilenceTime(1);
+	blynk->setWorkFlag(true);
+
+	run(30000);
+}
+
+
+void test_settings() {
+	bench_result_t* save = beginResult("save_settings");
+	bench_result_t* read = beginResult("read_settings");
+
+	for (uint16_t i = 0;i < BENCH_RUNS;i++) {
+		beginRun();
+		uint64_t time = hostNanos();
+
+		systemManager.saveSettings(true);
+		endRun(save, time);
+
+		beginRun();
+		time = hostNanos();
+
+		systemManager.readSettings();
+		endRun(read, time);
+	}
+
+	save->output = halFileSize(SETTINGS_FILE);
+	read->output = save->output;
+
+	TEST_ASSERT_EQUAL(BENCH_SENSORS_COUNT, systemManager.getSensorsManager()->getDS18B20Count());
+	TEST_ASSERT_EQUAL(BENCH_LINKS_COUNT, systemManager.getBlynkManager()->getLinksCount());
+}
+
+void test_web() {
+	ESP8266WebServer* server = ESP8266WebServer::hostFind(80);
+	bench_result_t* build = beginResult("ui_build");
+	bench_result_t* action = beginResult("ui_action");
+
+	TEST_ASSERT_NOT_NULL(server);
+
+	// the page polls its whole update list, it is taken from the page itself
+	server->hostKeepBody(true);
+	server->hostRequest("/");
+	server->hostKeepBody(false);
+
+	String page = server->hostBody();
+	int list_begin = page.indexOf("GP_update('");
+	int list_end = page.indexOf('\'', list_begin + 11);
+
+	TEST_ASSERT_TRUE(list_begin >= 0 && list_end > list_begin);
+	String list = page.substring(list_begin + 11, list_end);
+
+	// every name of the list is an element of one of the tabs and gets an answer
+	String tabs = page;
+
+	server->hostKeepBody(true);
+	server->hostRequest("/settings");
+	tabs += server->hostBody();
+	server->hostRequest("/memory");
+	tabs += server->hostBody();
+	server->hostRequest("/GP_update", list + "=");
+	server->hostKeepBody(false);
+
+	for (int begin = 0;begin < (int) list.length();) {
+		int end = list.indexOf(',', begin);
+		String name = list.substring(begin, (end < 0) ? list.length() : end);
+
+		TEST_ASSERT_TRUE_MESSAGE(tabs.indexOf("id='" + name + "'") >= 0, name.c_str());
+		begin = (end < 0) ? list.length() : end + 1;
+	}
+
+	TEST_ASSERT_EQUAL(countChar(list, ','), countChar(server->hostBody(), '\1'));
+
+	for (uint16_t i = 0;i < BENCH_RUNS;i++) {
+		beginRun();
+		uint64_t time = hostNanos();
+
+		server->hostRequest("/");
+		endRun(build, time);
+		build->output = server->hostBytes();
+
+		beginRun();
+		time = hostNanos();
+
+		server->hostRequest("/GP_update", list + "=");
+		endRun(action, time);
+		action->output = server->hostBytes();
+	}
+
+	TEST_ASSERT_EQUAL(200, server->hostCode());
+	TEST_ASSERT_TRUE(build->output > 0);
+	TEST_ASSERT_TRUE(action->output > 0);
+}
+
+void test_main_window() {
+	DisplayManager* display = systemManager.getDisplayManager();
+	Window* window = display->getWindowFromStack();
+	bench_result_t* render = beginResult("main_window");
+	size_t bytes = Wire.hostBytes();
+
+	TEST_ASSERT_NOT_NULL(window);
+
+	for (uint16_t i = 0;i < BENCH_RUNS;i++) {
+		halLinuxAdvanceTime(1000);
+
+		beginRun();
+		uint64_t time = hostNanos();
+
+		window->print(display->getLcdManager(), display, &systemManager);
+		endRun(render, time);
+	}
+
+	// I2C bytes of one frame
+	render->output = (Wire.hostBytes() - bytes) / BENCH_RUNS;
+	TEST_ASSERT_TRUE(render->output > 0);
+}
+
+void test_send_data() {
+	BlynkManager* blynk = systemManager.getBlynkManager();
+	BlynkQueue* queue = blynk->getQueue();
+	bench_result_t* send = beginResult("send_data");
+	uint32_t records = 0;
+
+	for (uint16_t i = 0;i < BENCH_RUNS;i++) {
+		// the file is kept from filling up, a full queue drops records
+		if (queue->getCount() + BENCH_LINKS_COUNT > BLYNK_QUEUE_FILE_MAX) {
+			queue->clear();
+		}
+
+		uint16_t queued = queue->getCount();
+		halLinuxAdvanceTime(1001);
+
+		beginRun();
+		uint64_t time = hostNanos();
+
+		blynk->tick();
+		endRun(send, time);
+
+		records += queue->getCount() - queued;
+	}
+
+	// records of one send
+	send->output = records / BENCH_RUNS;
+	TEST_ASSERT_EQUAL(BENCH_LINKS_COUNT, send->output);
+	TEST_ASSERT_EQUAL(0, queue->getDropCount());
+}
+
+void setUp() {
+}
+
+void tearDown() {
+}
+
+int main(int argc, char** argv) {
+	char buffer[BENCH_JSON_SIZE];
+
+	begin();
+
+	UNITY_BEGIN();
+	RUN_TEST(test_settings);
+	RUN_TEST(test_web);
+	RUN_TEST(test_main_window);
+	RUN_TEST(test_send_data);
+
+	printf("%s\n", makeJson(buffer, BENCH_JSON_SIZE));
+	return UNITY_END();
+}
@@ -0,0 +1,252 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <unity.h>
+#include "core.h"
+#include "hal_linux.h"
+
+#define TEST_STEP 100 // mls of virtual time per tick
+#define TEST_BATTERY 0
+#define TEST_BOILER 1
+#define TEST_EXIT 2
+#define TEST_SENSORS_COUNT 3
+#define TEST_BUFFER_SIZE 2048
+#define TEST_UNIX 1735689600 // 01.01.2025
+
+const uint8_t test_addresses[TEST_SENSORS_COUNT][HAL_DS_ADDRESS_SIZE] = {
+	{0x28, 0x01, 0, 0, 0, 0, 0, 0x11},
+	{0x28, 0x02, 0, 0, 0, 0, 0, 0x22},
+	{0x28, 0x03, 0, 0, 0, 0, 0, 0x33},
+};
+
+void setUp() {
+	halLinuxSetVirtualTime(true, 1000);
+	halFsBegin();
+
+	halFileRemove(RELE_JOURNAL_FILE_0);
+	halFileRemove(RELE_JOURNAL_FILE_1);
+	halFileRemove(RELE_COUNTERS_FILE);
+	halFileRemove(ENERGY_FILE);
+	halFileRemove(WATCHDOG_FILE);
+
+	halLinuxSetDs(TEST_BATTERY, 40, true);
+	halLinuxSetDs(TEST_BOILER, 40, true);
+	halLinuxSetDs(TEST_EXIT, 40, true);
+}
+
+void tearDown() {
+}
+
+void run(CoreManager* core, uint32_t time) {
+	for (uint32_t i = 0;i < time / TEST_STEP;i++) {
+		halLinuxAdvanceTime(TEST_STEP);
+		core->tick();
+	}
+}
+
+// battery -> boiler with an exit sensor, the way the main loop is wired
+void begin(CoreManager* core) {
+	SensorsManager* sensors = core->getSensorsManager();
+	SolarSystemManager* solar = core->getSolarSystemManager();
+
+	core->begin();
+
+	for (uint8_t i = 0;i < TEST_SENSORS_COUNT;i++) {
+		sensors->addDS18B20();
+		sensors->setDS18B20Address(i, (uint8_t*) test_addresses[i]);
+	}
+
+	solar->setBatterySensor(TEST_BATTERY);
+	solar->setBoilerSensor(TEST_BOILER);
+	solar->setExitSensor(TEST_EXIT);
+}
+
+
+void test_pump_follows_delta() {
+	CoreManager core;
+	SolarSystemManager* solar = core.getSolarSystemManager();
+
+	begin(&core);
+	run(&core, 30000);
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+
+	// until the first read the sensors are in error, error_on runs the pump for a moment
+	uint32_t starts = solar->getJournal()->getStarts(SOLAR_MAIN_LOOP);
+
+	halLinuxSetDs(TEST_BATTERY, 60, true);
+	run(&core, 30000);
+	TEST_ASSERT_TRUE(solar->getReleFlag());
+	TEST_ASSERT_EQUAL(!solar->getReleFlag(), halDigitalRead(RELE_PORT)); // inverted relay by default
+
+	halLinuxSetDs(TEST_BATTERY, 42, true);
+	run(&core, 30000);
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+	TEST_ASSERT_EQUAL(starts + 1, solar->getJournal()->getStarts(SOLAR_MAIN_LOOP));
+}
+
+void test_sensor_fault_turns_pump_on() {
+	CoreManager core;
+	SolarSystemManager* solar = core.getSolarSystemManager();
+
+	begin(&core);
+	run(&core, 30000);
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+
+	halLinuxSetDs(TEST_BOILER, 40, false);
+	run(&core, 10000);
+	TEST_ASSERT_TRUE(solar->getReleFlag());
+
+	solar->setErrorOnFlag(false);
+	halLinuxSetDs(TEST_BOILER, 40, true);
+	run(&core, 30000);
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+}
+
+void test_settings_round_trip() {
+	CoreManager core;
+	CoreManager loaded;
+	char* buffer = new char[TEST_BUFFER_SIZE];
+	*buffer = '\0';
+
+	begin(&core);
+	core.getSensorsManager()->setDS18B20Name(TEST_BOILER, "Bo");
+	core.getSensorsManager()->setDS18B20Correction(TEST_BOILER, -1.5);
+	core.getSolarSystemManager()->setDelta(7);
+	core.getSolarSystemManager()->setMode(SOLAR_MODE_HYSTERESIS);
+	core.getTimeManager()->setTimezone("EET-2EEST,M3.5.0/3,M10.5.0/4");
+	core.writeSettings(buffer);
+
+	loaded.begin();
+	loaded.readSettings(buffer);
+	delete[] buffer;
+
+	SensorsManager* sensors = loaded.getSensorsManager();
+	SolarSystemManager* solar = loaded.getSolarSystemManager();
+
+	TEST_ASSERT_EQUAL(TEST_SENSORS_COUNT, sensors->getDS18B20Count());
+	TEST_ASSERT_EQUAL_STRING("Bo", sensors->getDS18B20Name(TEST_BOILER));
+	TEST_ASSERT_FLOAT_WITHIN(0.01, -1.5, sensors->getDS18B20Correction(TEST_BOILER));
+	TEST_ASSERT_TRUE(!memcmp(test_addresses[TEST_EXIT], sensors->getDS18B20Address(TEST_EXIT), HAL_DS_ADDRESS_SIZE));
+	TEST_ASSERT_EQUAL(7, solar->getDelta());
+	TEST_ASSERT_EQUAL(SOLAR_MODE_HYSTERESIS, solar->getMode());
+	TEST_ASSERT_EQUAL(TEST_BOILER, solar->getBoilerSensor());
+	TEST_ASSERT_EQUAL_STRING("EET-2EEST,M3.5.0/3,M10.5.0/4", loaded.getTimeManager()->getTimezone());
+}
+
+void test_journal_counters_persist() {
+	CoreManager* core = new CoreManager;
+	ReleJournal* journal = core->getSolarSystemManager()->getJournal();
+
+	begin(core);
+	halLinuxSetDs(TEST_BATTERY, 60, true);
+	run(core, 30000);
+	halLinuxSetDs(TEST_BATTERY, 40, true);
+	run(core, 30000);
+	journal->flush();
+
+	uint32_t starts = journal->getStarts(SOLAR_MAIN_LOOP);
+	TEST_ASSERT_EQUAL(sizeof(rele_counters_file_t), halFileSize(RELE_COUNTERS_FILE));
+	delete core;
+
+	core = new CoreManager;
+	core->begin();
+	TEST_ASSERT_EQUAL(starts, core->getSolarSystemManager()->getJournal()->getStarts(SOLAR_MAIN_LOOP));
+	delete core;
+
+	// a cut file is not read
+	halFileWrite(RELE_COUNTERS_FILE, &starts, sizeof(starts), false);
+	core = new CoreManager;
+	core->begin();
+	TEST_ASSERT_EQUAL(0, core->getSolarSystemManager()->getJournal()->getStarts(SOLAR_MAIN_LOOP));
+	delete core;
+}
+
+// a stall runs the pump as a sensor error would, a switched off system stays off
+void test_watchdog_stall_level() {
+	CoreManager core;
+	SolarSystemManager* solar = core.getSolarSystemManager();
+
+	begin(&core);
+	run(&core, 30000);
+	TEST_ASSERT_TRUE(solar->getErrorOnFlag());
+
+	halLinuxAdvanceTime(SEC_TO_MLS(WATCHDOG_DEADLINE));
+	halLinuxTicker();
+	TEST_ASSERT_TRUE(solar->getWatchdog()->getStallFlag());
+	TEST_ASSERT_EQUAL(LOW, halDigitalRead(RELE_PORT)); // inverted relay by default
+
+	solar->setWorkFlag(false);
+	TEST_ASSERT_EQUAL(HIGH, halDigitalRead(RELE_PORT));
+
+	halLinuxAdvanceTime(SEC_TO_MLS(WATCHDOG_DEADLINE));
+	halLinuxTicker();
+	TEST_ASSERT_TRUE(solar->getWatchdog()->getStallFlag());
+	TEST_ASSERT_EQUAL(HIGH, halDigitalRead(RELE_PORT));
+}
+
+// a new read pace restarts the filters, it is not a sensor fault that runs the pump
+void test_read_time_keeps_health() {
+	CoreManager core;
+	SensorsManager* sensors = core.getSensorsManager();
+	SolarSystemManager* solar = core.getSolarSystemManager();
+
+	begin(&core);
+	run(&core, 30000);
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+	TEST_ASSERT_EQUAL(DS_HEALTH_OK, sensors->getDS18B20Health(TEST_BOILER));
+
+	sensors->setReadDataTime(sensors->getReadDataTime() + 1);
+	run(&core, TEST_STEP);
+
+	TEST_ASSERT_EQUAL(DS_HEALTH_OK, sensors->getDS18B20Health(TEST_BOILER));
+	TEST_ASSERT_FALSE(solar->getReleFlag());
+}
+
+// polls shorter than NTP_DRIFT_MIN_TIME add up to one drift sample
+void test_ntp_drift_short_polls() {
+	CoreManager core;
+	TimeManager* time = core.getTimeManager();
+	const int32_t drift = 50000; // ppb the reference runs faster
+	const uint32_t poll_time = MIN_TO_MLS(2);
+
+	core.begin();
+	time->setUnix(TEST_UNIX);
+
+	uint64_t reference_begin = time->getUnixMillis();
+	uint64_t elapsed = 0;
+
+	time->adjustUnixMillis(0);
+
+	for (uint16_t i = 0;i < 360;i++) {
+		halLinuxAdvanceTime(poll_time);
+		elapsed += poll_time;
+
+		uint64_t reference = reference_begin + elapsed + elapsed * drift / 1000000000LL;
+		time->adjustUnixMillis((int64_t) (reference - time->getUnixMillis()));
+	}
+
+	TEST_ASSERT_INT_WITHIN(drift / 10, drift, time->getDrift());
+}
+
+int main(int argc, char** argv) {
+	for (uint8_t i = 0;i < TEST_SENSORS_COUNT;i++) {
+		halLinuxAddDs(test_addresses[i]);
+	}
+
+	UNITY_BEGIN();
+	RUN_TEST(test_pump_follows_delta);
+	RUN_TEST(test_sensor_fault_turns_pump_on);
+	RUN_TEST(test_settings_round_trip);
+	RUN_TEST(test_journal_counters_persist);
+	RUN_TEST(test_watchdog_stall_level);
+	RUN_TEST(test_read_time_keeps_health);
+	RUN_TEST(test_ntp_drift_short_polls);
+
+	return UNITY_END();
+}
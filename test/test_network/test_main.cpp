@@ -0,0 +1,258 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <unity.h>
+#include "data.h"
+#include "hal_linux.h"
+
+#define TEST_UNIX 1735689600 // 01.01.2025
+#define TEST_NTP_SERVER "10.0.0.1"
+#define TEST_NTP_OFFSET 3000 // mls the server is ahead
+#define TEST_NTP_PATH 15 // mls one way
+#define TEST_NTP_HOLD 10 // mls between the server receive and transmit
+#define TEST_NTP_STRATUM 2
+#define TEST_STEP 100 // mls of virtual time per tick
+#define TEST_WIFI_SSID "home"
+#define TEST_WIFI_PASS "password"
+#define TEST_BLYNK_SERVER "10.0.0.2"
+#define TEST_BLYNK_AUTH "0123456789abcdef0123456789abcdef"
+#define TEST_STATE_TIME_MAX 600000 // mls, longer than the longest backoff
+
+extern SystemManager systemManager;
+
+// the login answer of the server: response to message 1, 200 OK
+const uint8_t test_blynk_login_ok[BLYNK_HEADER_SIZE] = {0, 0, 1, 0, 200};
+
+// the time is not set back between the tests, systemManager keeps its timers
+void setUp() {
+}
+
+void tearDown() {
+}
+
+void run(uint32_t time) {
+	for (uint32_t i = 0;i < time / TEST_STEP;i++) {
+		halLinuxAdvanceTime(TEST_STEP);
+		systemManager.tick();
+	}
+}
+
+// runs until the connect of Blynk is in the state, returns the time it took
+uint32_t waitBlynkState(uint8_t state) {
+	BlynkManager* blynk = systemManager.getBlynkManager();
+	uint32_t begin_time = millis();
+
+	while (blynk->getConnectState() != state && millis() - begin_time < TEST_STATE_TIME_MAX) {
+		run(TEST_STEP);
+	}
+
+	TEST_ASSERT_EQUAL(state, blynk->getConnectState());
+	return millis() - begin_time;
+}
+
+// the station on the host network and a new Blynk session: a new auth drops the backoff
+void beginBlynk(const char* auth) {
+	static bool begin_flag = false;
+	BlynkManager* blynk = systemManager.getBlynkManager();
+
+	if (!begin_flag) {
+		begin_flag = true;
+
+		WiFi.hostSetNetwork(TEST_WIFI_SSID, TEST_WIFI_PASS);
+		systemManager.begin();
+		systemManager.getNetworkManager()->setWifi(TEST_WIFI_SSID, TEST_WIFI_PASS);
+		blynk->setWorkFlag(true);
+
+		run(10000);
+		TEST_ASSERT_EQUAL(WL_CONNECTED, systemManager.getNetworkManager()->getStatus());
+	}
+
+	dnsHostClear();
+	WiFiClient::hostClear();
+
+	blynk->setAuth(auth);
+	TEST_ASSERT_EQUAL(BLYNK_CONNECT_IDLE, blynk->getConnectState());
+}
+
+void writeTimestamp(uint8_t* buffer, uint64_t unix_ms) {
+	uint32_t seconds = unix_ms / 1000 + NTP_UNIX_OFFSET;
+	uint32_t fraction = ((uint64_t) (unix_ms % 1000) << 32) / 1000;
+
+	for (uint8_t i = 0;i < 4;i++) {
+		buffer[i] = seconds >> (24 - i * 8);
+		buffer[4 + i] = fraction >> (24 - i * 8);
+	}
+}
+
+// the server answer to the request, the origin is echoed from its transmit time
+void makeNtpReply(uint8_t* packet, const uint8_t* request, uint64_t receive_ms, uint64_t transmit_ms) {
+	memset(packet, 0, NTP_PACKET_SIZE);
+
+	packet[0] = 0b00100100; // LI 0, version 4, mode 4 (server)
+	packet[1] = TEST_NTP_STRATUM;
+	memcpy(&packet[24], &request[40], 8);
+	writeTimestamp(&packet[32], receive_ms);
+	writeTimestamp(&packet[40], transmit_ms);
+}
+
+
+void test_ntp_sample() {
+	CoreManager core;
+	NtpClient ntp;
+	TimeManager* time = core.getTimeManager();
+	IPAddress server_ip;
+	uint8_t reply[NTP_PACKET_SIZE];
+
+	core.begin();
+	time->setUnix(TEST_UNIX);
+	server_ip.fromString(TEST_NTP_SERVER);
+
+	ntp.begin();
+	ntp.setServer(0, TEST_NTP_SERVER);
+	WiFiUDP* udp = WiFiUDP::hostFind(NTP_LOCAL_PORT);
+	TEST_ASSERT_NOT_NULL(udp);
+
+	// a literal address needs no lookup, the request goes out on the next tick
+	TEST_ASSERT_FALSE(ntp.tick(time));
+	uint64_t request_ms = time->getUnixMillis();
+	TEST_ASSERT_FALSE(ntp.tick(time));
+
+	const wifi_udp_host_packet_t& request = udp->hostSent();
+	TEST_ASSERT_EQUAL(NTP_PACKET_SIZE, request.data.size());
+	TEST_ASSERT_EQUAL((uint32_t) server_ip, (uint32_t) request.ip);
+	TEST_ASSERT_EQUAL(NTP_PORT, request.port);
+
+	uint64_t receive_ms = request_ms + TEST_NTP_OFFSET + TEST_NTP_PATH;
+	uint64_t transmit_ms = receive_ms + TEST_NTP_HOLD;
+
+	// a reply to another request: the origin misses the random low bits
+	makeNtpReply(reply, request.data.data(), receive_ms, transmit_ms);
+	reply[31] ^= 0x01;
+	udp->hostReceive(server_ip, NTP_PORT, reply, NTP_PACKET_SIZE);
+
+	// the right reply from another port
+	makeNtpReply(reply, request.data.data(), receive_ms, transmit_ms);
+	udp->hostReceive(server_ip, NTP_PORT + 1, reply, NTP_PACKET_SIZE);
+
+	halLinuxAdvanceTime(TEST_NTP_PATH);
+	TEST_ASSERT_FALSE(ntp.tick(time));
+	TEST_ASSERT_FALSE(ntp.tick(time));
+	TEST_ASSERT_EQUAL(0, ntp.getStratum());
+
+	udp->hostReceive(server_ip, NTP_PORT, reply, NTP_PACKET_SIZE);
+	halLinuxAdvanceTime(TEST_NTP_HOLD + TEST_NTP_PATH);
+	uint64_t reply_ms = time->getUnixMillis();
+
+	// offset ((t2 - t1) + (t3 - t4)) / 2, delay (t4 - t1) - (t3 - t2); a timestamp read back may lose 1 ms
+	TEST_ASSERT_TRUE(ntp.tick(time));
+	TEST_ASSERT_EQUAL(TEST_NTP_STRATUM, ntp.getStratum());
+	TEST_ASSERT_INT_WITHIN(1, TEST_NTP_OFFSET, ntp.getOffset());
+	TEST_ASSERT_INT_WITHIN(1, 2 * TEST_NTP_PATH, ntp.getDelay());
+
+	// the first sample steps the clock
+	TEST_ASSERT_INT_WITHIN(1, TEST_NTP_OFFSET, time->getUnixMillis() - reply_ms);
+}
+
+void test_blynk_dns_fail() {
+	BlynkManager* blynk = systemManager.getBlynkManager();
+
+	beginBlynk(TEST_BLYNK_AUTH);
+	dnsHostSet(BLYNK_DEFAULT_DOMAIN, 0);
+
+	waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	dnsHostPoll();
+	run(TEST_STEP);
+	TEST_ASSERT_EQUAL(BLYNK_CONNECT_IDLE, blynk->getConnectState());
+
+	// no answer at all
+	waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	run(BLYNK_DNS_TIMEOUT + TEST_STEP);
+	TEST_ASSERT_EQUAL(BLYNK_CONNECT_IDLE, blynk->getConnectState());
+	TEST_ASSERT_EQUAL(0, WiFiClient::hostConnectCount());
+}
+
+// every tick makes one short attempt, the next connect waits for the backoff that doubles
+void test_blynk_tcp_refused() {
+	IPAddress server_ip;
+
+	beginBlynk(TEST_BLYNK_AUTH "0");
+	server_ip.fromString(TEST_BLYNK_SERVER);
+	dnsHostSet(BLYNK_DEFAULT_DOMAIN, server_ip);
+
+	waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	dnsHostPoll();
+	waitBlynkState(BLYNK_CONNECT_TCP);
+
+	uint32_t connect_time = waitBlynkState(BLYNK_CONNECT_IDLE);
+	TEST_ASSERT_INT_WITHIN(TEST_STEP, BLYNK_CONNECT_TIMEOUT, connect_time);
+
+	// port 80 and then 8080 on every tick
+	TEST_ASSERT_TRUE(WiFiClient::hostConnectCount() >= 2 * (BLYNK_CONNECT_TIMEOUT / TEST_STEP - 1));
+
+	uint32_t first_time = waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	dnsHostPoll();
+	uint32_t attempt_time = waitBlynkState(BLYNK_CONNECT_IDLE);
+	uint32_t second_time = waitBlynkState(BLYNK_CONNECT_RESOLVE);
+
+	// start to start, the jitter is up to a quarter
+	first_time += connect_time;
+	second_time += attempt_time;
+
+	TEST_ASSERT_TRUE(first_time >= SEC_TO_MLS(BLYNK_RECONNECT_MIN_TIME) * 2 * (100 - BLYNK_RECONNECT_JITTER) / 100);
+	TEST_ASSERT_TRUE(second_time > first_time);
+}
+
+void test_blynk_login_timeout() {
+	IPAddress server_ip;
+
+	beginBlynk(TEST_BLYNK_AUTH "1");
+	server_ip.fromString(TEST_BLYNK_SERVER);
+	dnsHostSet(BLYNK_DEFAULT_DOMAIN, server_ip);
+	WiFiClient::hostListen(server_ip, BLYNK_DEFAULT_PORT);
+
+	waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	dnsHostPoll();
+	waitBlynkState(BLYNK_CONNECT_LOGIN);
+
+	// the server takes the login and is silent
+	uint32_t login_time = waitBlynkState(BLYNK_CONNECT_IDLE);
+	TEST_ASSERT_INT_WITHIN(TEST_STEP, BLYNK_LOGIN_TIMEOUT, login_time);
+	TEST_ASSERT_FALSE(systemManager.getBlynkManager()->getStatus());
+}
+
+void test_blynk_login() {
+	IPAddress server_ip;
+
+	beginBlynk(TEST_BLYNK_AUTH "2");
+	server_ip.fromString(TEST_BLYNK_SERVER);
+	dnsHostSet(BLYNK_DEFAULT_DOMAIN, server_ip);
+	WiFiClient::hostListen(server_ip, BLYNK_DEFAULT_PORT, test_blynk_login_ok, BLYNK_HEADER_SIZE);
+
+	waitBlynkState(BLYNK_CONNECT_RESOLVE);
+	dnsHostPoll();
+	waitBlynkState(BLYNK_CONNECT_READY);
+
+	TEST_ASSERT_TRUE(systemManager.getBlynkManager()->getStatus());
+	TEST_ASSERT_EQUAL(1, WiFiClient::hostConnectCount());
+}
+
+int main(int argc, char** argv) {
+	halLinuxSetVirtualTime(true, 1000);
+	halFsBegin();
+
+	UNITY_BEGIN();
+	// the socket of the NTP test is found by its port, the NTP client of systemManager starts later
+	RUN_TEST(test_ntp_sample);
+	RUN_TEST(test_blynk_dns_fail);
+	RUN_TEST(test_blynk_tcp_refused);
+	RUN_TEST(test_blynk_login_timeout);
+	RUN_TEST(test_blynk_login);
+
+	return UNITY_END();
+}
@@ -0,0 +1,176 @@
+/*
+ * Project: Solar Battery Control System
+ *
+ * Author: Vereshchynskyi Nazar
+ * Email: verechnazar12@gmail.com
+ * Version: 1.3.1
+ * Date: 04.02.2025
+ */
+
+#include <time.h>
+#include <unity.h>
+#include "sim_plant.h"
+
+#define TEST_STEP 1000 // mls, one core tick per plant step
+#define TEST_DAY 86400000UL // mls
+#define TEST_SETTLE_TIME 60000 // mls, the sensors are not read yet and error_on runs the pump
+#define TEST_MARGIN 1.0 // °C, the sensors are read with a lag and rounded
+
+struct test_run_t {
+	CoreManager core;
+	sim_plant_t plant;
+
+	uint32_t wrong_on; // sec the pump ran below the off delta
+	uint32_t missed_on; // sec the pump stood above the on delta
+};
+
+void setUp() {
+	halFsBegin();
+
+	halFileRemove(RELE_JOURNAL_FILE_0);
+	halFileRemove(RELE_JOURNAL_FILE_1);
+	halFileRemove(RELE_COUNTERS_FILE);
+	halFileRemove(ENERGY_FILE);
+	halFileRemove(WATCHDOG_FILE);
+}
+
+void tearDown() {
+}
+
+// checks the relay the core has just set against the real temperatures of the plant
+void tick(void* context) {
+	test_run_t* run = (test_run_t*) context;
+	SolarSystemManager* solar = run->core.getSolarSystemManager();
+	float delta_now = run->plant.battery_t - run->plant.boiler_t;
+
+	run->core.tick();
+
+	if (run->plant.time < TEST_SETTLE_TIME || solar->getMode() != SOLAR_MODE_BANG_BANG) {
+		return;
+	}
+
+	if (solar->getReleFlag() && delta_now < solar->getDelta() - SOLAR_BANG_BANG_HYSTERESIS - TEST_MARGIN) {
+		run->wrong_on++;
+	}
+	if (!solar->getReleFlag() && delta_now > solar->getDelta() + TEST_MARGIN) {
+		run->missed_on++;
+	}
+}
+
+void begin(test_run_t* run, sim_config_t* config) {
+	SensorsManager* sensors = run->core.getSensorsManager();
+	SolarSystemManager* solar = run->core.getSolarSystemManager();
+	uint8_t address[HAL_DS_ADDRESS_SIZE];
+
+	run->wrong_on = 0;
+	run->missed_on = 0;
+
+	simBegin(&run->plant, config);
+	run->core.begin();
+
+	uint8_t indexes[3] = {run->plant.battery_index, run->plant.boiler_index, run->plant.exit_index};
+
+	for (uint8_t i = 0;i < 3;i++) {
+		halDsAddress(indexes[i], address);
+		sensors->addDS18B20();
+		sensors->setDS18B20Address(i, address);
+	}
+
+	solar->setBatterySensor(0);
+	solar->setBoilerSensor(1);
+	solar->setExitSensor(2);
+}
+
+void report(const char* name, test_run_t* run, uint32_t host_time) {
+	char buffer[SIM_REPORT_SIZE];
+
+	printf("%s: %s, host %u ms\n", name, simReport(&run->plant, buffer), host_time);
+}
+
+uint32_t hostMillis() {
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000 + now.tv_nsec / 1000000;
+}
+
+
+void test_bang_bang_follows_plant() {
+	test_run_t* run = new test_run_t;
+	sim_config_t config;
+	uint32_t host_time = hostMillis();
+
+	simMakeDefault(&config);
+	begin(run, &config);
+	simRun(&run->plant, 7 * TEST_DAY, TEST_STEP, tick, run);
+	report("bang_bang_clear", run, hostMillis() - host_time);
+
+	// every pump start the plant saw is a start the core journaled
+	TEST_ASSERT_EQUAL(run->plant.pump_cycles, run->core.getSolarSystemManager()->getJournal()->getStarts(SOLAR_MAIN_LOOP));
+	TEST_ASSERT_EQUAL(0, run->wrong_on);
+	TEST_ASSERT_EQUAL(0, run->missed_on);
+
+	TEST_ASSERT_TRUE(run->plant.pump_cycles >= 7);
+	TEST_ASSERT_TRUE(run->plant.energy_moved > 0.3 * run->plant.energy_collected);
+	TEST_ASSERT_TRUE(run->plant.boiler_t_max > config.start_t + 10);
+
+	delete run;
+}
+
+void test_night_pump_off() {
+	test_run_t* run = new test_run_t;
+	sim_config_t config;
+
+	simMakeDefault(&config);
+	begin(run, &config);
+
+	// two days, then the night up to the sunrise
+	simRun(&run->plant, 2 * TEST_DAY + config.sunrise * 3600000UL - 60000, TEST_STEP, tick, run);
+	uint32_t pump_time = run->plant.pump_time;
+
+	simRun(&run->plant, 3600000, TEST_STEP, tick, run);
+	TEST_ASSERT_FALSE(run->core.getSolarSystemManager()->getReleFlag());
+	TEST_ASSERT_EQUAL(pump_time, run->plant.pump_time);
+
+	delete run;
+}
+
+void test_hysteresis_no_chatter() {
+	test_run_t* bang_bang = new test_run_t;
+	test_run_t* hysteresis = new test_run_t;
+	sim_config_t config;
+
+	simMakeDefault(&config);
+	config.sun_profile = SIM_SUN_CLOUDY;
+	config.chatter_time = DEFAULT_SOLAR_MIN_ON_TIME;
+
+	uint32_t host_time = hostMillis();
+
+	begin(bang_bang, &config);
+	simRun(&bang_bang->plant, 7 * TEST_DAY, TEST_STEP, tick, bang_bang);
+	report("bang_bang_cloudy", bang_bang, hostMillis() - host_time);
+
+	setUp();
+	host_time = hostMillis();
+	begin(hysteresis, &config);
+	hysteresis->core.getSolarSystemManager()->setMode(SOLAR_MODE_HYSTERESIS);
+	simRun(&hysteresis->plant, 7 * TEST_DAY, TEST_STEP, tick, hysteresis);
+	report("hysteresis_cloudy", hysteresis, hostMillis() - host_time);
+
+	// the dwell times are never shorter than the chatter time
+	TEST_ASSERT_EQUAL(0, hysteresis->plant.chatter_cycles);
+	TEST_ASSERT_TRUE(hysteresis->plant.pump_cycles <= bang_bang->plant.pump_cycles);
+	TEST_ASSERT_TRUE(hysteresis->plant.energy_moved > 0.8 * bang_bang->plant.energy_moved);
+
+	delete bang_bang;
+	delete hysteresis;
+}
+
+int main(int argc, char** argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_bang_bang_follows_plant);
+	RUN_TEST(test_night_pump_off);
+	RUN_TEST(test_hysteresis_no_chatter);
+
+	return UNITY_END();
+}